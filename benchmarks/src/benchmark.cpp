@@ -0,0 +1,221 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#include "benchmark.h"
+
+#include "version.h"
+
+#include <pxr/base/tf/stopwatch.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/pxr.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <numeric>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace adobe::usd::benchmarks {
+
+namespace {
+
+std::string
+escapeJson(const std::string& s)
+{
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (char c : s) {
+        switch (c) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buffer[8];
+                    snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                    escaped += buffer;
+                } else {
+                    escaped += c;
+                }
+        }
+    }
+    return escaped;
+}
+
+std::string
+formatMs(double ms)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.3f", ms);
+    return buffer;
+}
+
+}
+
+double
+BenchmarkResult::min() const
+{
+    return samples.empty() ? 0.0 : *std::min_element(samples.begin(), samples.end());
+}
+
+double
+BenchmarkResult::max() const
+{
+    return samples.empty() ? 0.0 : *std::max_element(samples.begin(), samples.end());
+}
+
+double
+BenchmarkResult::mean() const
+{
+    return samples.empty() ? 0.0
+                           : std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+}
+
+double
+BenchmarkResult::median() const
+{
+    if (samples.empty()) {
+        return 0.0;
+    }
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    const size_t half = sorted.size() / 2;
+    return sorted.size() % 2 ? sorted[half] : 0.5 * (sorted[half - 1] + sorted[half]);
+}
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions& options)
+  : mOptions(options)
+{}
+
+bool
+BenchmarkRunner::selected(const std::string& group,
+                          const std::string& stage,
+                          const std::string& scene) const
+{
+    const std::string name = group + "/" + stage + "/" + scene;
+    return mOptions.filter.empty() || name.find(mOptions.filter) != std::string::npos;
+}
+
+void
+BenchmarkRunner::run(const std::string& group,
+                     const std::string& stage,
+                     const std::string& scene,
+                     size_t items,
+                     const std::function<bool()>& body,
+                     const std::function<void()>& setup)
+{
+    if (!selected(group, stage, scene)) {
+        return;
+    }
+    BenchmarkResult result;
+    result.group = group;
+    result.stage = stage;
+    result.scene = scene;
+    result.items = items;
+    result.status = "ok";
+    std::cerr << group << "/" << stage << "/" << scene << "... " << std::flush;
+
+    const int runs = std::max(mOptions.warmup, 0) + std::max(mOptions.iterations, 1);
+    for (int i = 0; i < runs; i++) {
+        if (setup) {
+            setup();
+        }
+        TfStopwatch watch;
+        watch.Start();
+        const bool success = body();
+        watch.Stop();
+        if (!success) {
+            result.status = "failed";
+            result.samples.clear();
+            break;
+        }
+        if (i >= mOptions.warmup) {
+            result.samples.push_back(watch.GetSeconds() * 1000.0);
+        }
+    }
+
+    std::cerr << result.status;
+    if (!result.samples.empty()) {
+        std::cerr << " (median " << formatMs(result.median()) << " ms)";
+    }
+    std::cerr << std::endl;
+    mResults.push_back(std::move(result));
+}
+
+void
+BenchmarkRunner::skip(const std::string& group,
+                      const std::string& stage,
+                      const std::string& scene,
+                      const std::string& reason)
+{
+    if (!selected(group, stage, scene)) {
+        return;
+    }
+    BenchmarkResult result;
+    result.group = group;
+    result.stage = stage;
+    result.scene = scene;
+    result.status = "skipped";
+    result.message = reason;
+    std::cerr << group << "/" << stage << "/" << scene << "... skipped: " << reason << std::endl;
+    mResults.push_back(std::move(result));
+}
+
+void
+BenchmarkRunner::writeJson(std::ostream& out) const
+{
+    out << "{\n";
+    out << "  \"version\": \"" << FILE_FORMATS_VERSION << "\",\n";
+    out << "  \"label\": \"" << escapeJson(mOptions.label) << "\",\n";
+    out << "  \"concurrency\": " << WorkGetConcurrencyLimit() << ",\n";
+    out << "  \"scale\": " << mOptions.scale << ",\n";
+    out << "  \"warmup\": " << mOptions.warmup << ",\n";
+    out << "  \"iterations\": " << mOptions.iterations << ",\n";
+    out << "  \"results\": [";
+    for (size_t i = 0; i < mResults.size(); i++) {
+        const BenchmarkResult& r = mResults[i];
+        out << (i ? ",\n" : "\n");
+        out << "    { \"name\": \"" << escapeJson(r.group + "/" + r.stage + "/" + r.scene) << "\"";
+        out << ", \"group\": \"" << escapeJson(r.group) << "\"";
+        out << ", \"stage\": \"" << escapeJson(r.stage) << "\"";
+        out << ", \"scene\": \"" << escapeJson(r.scene) << "\"";
+        out << ", \"status\": \"" << r.status << "\"";
+        if (!r.message.empty()) {
+            out << ", \"message\": \"" << escapeJson(r.message) << "\"";
+        }
+        if (!r.samples.empty()) {
+            out << ", \"items\": " << r.items;
+            out << ", \"minMs\": " << formatMs(r.min());
+            out << ", \"medianMs\": " << formatMs(r.median());
+            out << ", \"meanMs\": " << formatMs(r.mean());
+            out << ", \"maxMs\": " << formatMs(r.max());
+            out << ", \"samplesMs\": [";
+            for (size_t s = 0; s < r.samples.size(); s++) {
+                out << (s ? ", " : "") << formatMs(r.samples[s]);
+            }
+            out << "]";
+        }
+        out << " }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+}
@@ -0,0 +1,91 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace adobe::usd::benchmarks {
+
+/// Settings shared by all benchmarks of a run
+struct BenchmarkOptions
+{
+    // Multiplier on the size of the synthetic scenes
+    float scale = 1.0f;
+    // Untimed runs before the timed ones, to warm up caches and the plugin registry
+    int warmup = 1;
+    int iterations = 5;
+    // Only benchmarks whose "<group>/<stage>/<scene>" name contains this string are run
+    std::string filter;
+    // Free form string recorded in the report, e.g. a commit hash
+    std::string label;
+    // Directory for the generated assets
+    std::string workDir;
+};
+
+/// Timings of one benchmark, in milliseconds
+struct BenchmarkResult
+{
+    std::string group; // The plugin extension, or "utils"
+    std::string stage; // For example "read", "write" or "triangulateMesh"
+    std::string scene;
+    std::string status; // "ok", "skipped" or "failed"
+    std::string message;
+    size_t items = 0; // Scene size measure (points, materials, ...) to derive throughput
+    std::vector<double> samples;
+
+    double min() const;
+    double max() const;
+    double mean() const;
+    double median() const;
+};
+
+/// Runs the benchmarks and collects their results
+class BenchmarkRunner
+{
+public:
+    explicit BenchmarkRunner(const BenchmarkOptions& options);
+
+    const BenchmarkOptions& options() const { return mOptions; }
+
+    /// Whether a benchmark is selected by the filter
+    bool selected(const std::string& group,
+                  const std::string& stage,
+                  const std::string& scene) const;
+
+    /// Times `body`, which returns false on failure. `setup` runs untimed before each call of
+    /// `body`, for example to reset the data it consumes.
+    void run(const std::string& group,
+             const std::string& stage,
+             const std::string& scene,
+             size_t items,
+             const std::function<bool()>& body,
+             const std::function<void()>& setup = {});
+
+    /// Records a benchmark that was not run, with the reason
+    void skip(const std::string& group,
+              const std::string& stage,
+              const std::string& scene,
+              const std::string& reason);
+
+    /// Writes the results as a JSON document
+    void writeJson(std::ostream& out) const;
+
+private:
+    BenchmarkOptions mOptions;
+    std::vector<BenchmarkResult> mResults;
+};
+
+}
@@ -0,0 +1,333 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#include "benchmark.h"
+#include "syntheticScenes.h"
+
+#include <fileformatutils/geometry.h>
+#include <fileformatutils/layerRead.h>
+#include <fileformatutils/layerWriteSdfData.h>
+#include <fileformatutils/materials.h>
+
+#include <pxr/usd/sdf/data.h>
+#include <pxr/usd/sdf/fileFormat.h>
+#include <pxr/usd/sdf/layer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+using namespace adobe::usd;
+using namespace adobe::usd::benchmarks;
+
+namespace {
+
+// Gives access to the protected SdfFileFormat::_SetLayerData, which writeLayer needs
+class BenchmarkFileFormat : public SdfFileFormat
+{
+public:
+    static void SetLayerData(SdfLayer* layer, SdfAbstractDataRefPtr& data)
+    {
+        SdfFileFormat::_SetLayerData(layer, data);
+    }
+};
+
+// The plugins and the synthetic scenes that each of them can represent
+struct FormatBenchmarks
+{
+    std::string extension;
+    std::vector<std::string> scenes;
+};
+
+const std::vector<FormatBenchmarks> formats = {
+    { "gltf", { "largeMesh", "manyMaterials", "skinnedAnimation" } },
+    { "fbx", { "largeMesh", "manyMaterials", "skinnedAnimation" } },
+    { "obj", { "largeMesh", "manyMaterials" } },
+    { "ply", { "largeMesh", "gsplatCloud" } },
+    { "stl", { "largeMesh" } },
+    { "spz", { "gsplatCloud" } },
+};
+
+void
+printUsage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --output <file>     Write the JSON report to <file> instead of stdout\n"
+              << "  --scale <float>     Multiplier on the size of the synthetic scenes (1)\n"
+              << "  --iterations <int>  Number of timed runs per benchmark (5)\n"
+              << "  --warmup <int>      Number of untimed runs per benchmark (1)\n"
+              << "  --filter <string>   Only run benchmarks whose name contains <string>\n"
+              << "  --label <string>    Free form label recorded in the report\n"
+              << "  --work-dir <dir>    Directory for the generated assets\n";
+}
+
+bool
+parseArguments(int argc, char** argv, BenchmarkOptions& options, std::string& output)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (!strcmp(arg, "--help") || !strcmp(arg, "-h")) {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+        const char* value = argv[++i];
+        if (!strcmp(arg, "--output")) {
+            output = value;
+        } else if (!strcmp(arg, "--scale")) {
+            options.scale = std::strtof(value, nullptr);
+        } else if (!strcmp(arg, "--iterations")) {
+            options.iterations = std::atoi(value);
+        } else if (!strcmp(arg, "--warmup")) {
+            options.warmup = std::atoi(value);
+        } else if (!strcmp(arg, "--filter")) {
+            options.filter = value;
+        } else if (!strcmp(arg, "--label")) {
+            options.label = value;
+        } else if (!strcmp(arg, "--work-dir")) {
+            options.workDir = value;
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return false;
+        }
+    }
+    if (options.scale <= 0.0f) {
+        std::cerr << "The scale must be positive" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Writes the scene to a new anonymous layer
+SdfLayerRefPtr
+writeSceneLayer(const UsdData& scene)
+{
+    UsdData data = scene; // writeLayer may modify the data it's given
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous(".usda");
+    SdfAbstractDataRefPtr sdfData(new SdfData());
+    WriteLayerOptions options;
+    if (!writeLayer(options,
+                    data,
+                    &*layer,
+                    sdfData,
+                    "Benchmark",
+                    "Benchmark",
+                    BenchmarkFileFormat::SetLayerData)) {
+        return {};
+    }
+    return layer;
+}
+
+void
+benchmarkLayerStages(BenchmarkRunner& runner, const SyntheticScene& scene)
+{
+    UsdData data;
+    runner.run(
+      "utils",
+      "writeLayer",
+      scene.name,
+      scene.items,
+      [&]() {
+          SdfLayerRefPtr layer = SdfLayer::CreateAnonymous(".usda");
+          SdfAbstractDataRefPtr sdfData(new SdfData());
+          return writeLayer(WriteLayerOptions(),
+                            data,
+                            &*layer,
+                            sdfData,
+                            "Benchmark",
+                            "Benchmark",
+                            BenchmarkFileFormat::SetLayerData);
+      },
+      [&]() { data = scene.data; });
+
+    if (!runner.selected("utils", "readLayer", scene.name)) {
+        return;
+    }
+    SdfLayerRefPtr layer = writeSceneLayer(scene.data);
+    if (!layer) {
+        runner.skip("utils", "readLayer", scene.name, "Failed to write the scene layer");
+        return;
+    }
+    runner.run("utils", "readLayer", scene.name, scene.items, [&]() {
+        UsdData read;
+        return readLayer(ReadLayerOptions(), *layer, read, "Benchmark");
+    });
+}
+
+void
+benchmarkTriangulation(BenchmarkRunner& runner, const SyntheticScene& scene)
+{
+    Mesh mesh;
+    runner.run(
+      "utils",
+      "triangulateMesh",
+      scene.name,
+      scene.items,
+      [&]() { return triangulateMesh(mesh); },
+      [&]() { mesh = scene.data.meshes[0]; });
+}
+
+void
+benchmarkInputTranslator(BenchmarkRunner& runner, float scale)
+{
+    const int size = std::max(16, static_cast<int>(1024 * std::sqrt(scale)));
+    const Image noise0 = generateNoiseImage(size, 3, 0);
+    const Image noise1 = generateNoiseImage(size, 3, 1);
+    const std::string scene = "noise" + std::to_string(size);
+    const size_t pixels = static_cast<size_t>(size) * size;
+
+    // The translator consumes its images, so each run starts from a fresh one
+    std::vector<ImageAsset> images;
+    std::unique_ptr<InputTranslator> translator;
+    Input in0, in1;
+    auto setup = [&]() {
+        translator.reset();
+        images.clear();
+        translator = std::make_unique<InputTranslator>(true, images, "Benchmark");
+        Image image0 = noise0;
+        Image image1 = noise1;
+        in0 = Input();
+        in0.image =
+          translator->addImage(std::move(image0), "noise0", "noise0.png", ImageFormatPng, true);
+        in0.channel = AdobeTokens->rgb;
+        in1 = Input();
+        in1.image =
+          translator->addImage(std::move(image1), "noise1", "noise1.png", ImageFormatPng, true);
+        in1.channel = AdobeTokens->rgb;
+    };
+
+    runner.run(
+      "utils",
+      "InputTranslator.max",
+      scene,
+      pixels,
+      [&]() {
+          Input out;
+          return translator->translateMax("max", in0, in1, out);
+      },
+      setup);
+    runner.run(
+      "utils",
+      "InputTranslator.product",
+      scene,
+      pixels,
+      [&]() {
+          Input out;
+          return translator->translateProduct("product", in0, in1, out);
+      },
+      setup);
+}
+
+void
+benchmarkFormat(BenchmarkRunner& runner,
+                const FormatBenchmarks& format,
+                const SyntheticScene& scene,
+                const std::filesystem::path& workDir)
+{
+    const std::string& ext = format.extension;
+    const bool readSelected = runner.selected(ext, "read", scene.name);
+    const bool writeSelected = runner.selected(ext, "write", scene.name);
+    if (!readSelected && !writeSelected) {
+        return;
+    }
+    if (!SdfFileFormat::FindByExtension(ext)) {
+        const std::string reason = "No " + ext + " file format plugin is registered";
+        runner.skip(ext, "write", scene.name, reason);
+        runner.skip(ext, "read", scene.name, reason);
+        return;
+    }
+    SdfLayerRefPtr layer = writeSceneLayer(scene.data);
+    if (!layer) {
+        runner.skip(ext, "write", scene.name, "Failed to write the scene layer");
+        runner.skip(ext, "read", scene.name, "Failed to write the scene layer");
+        return;
+    }
+
+    // The write benchmark also produces the file for the read benchmark
+    const std::string path = (workDir / (scene.name + "." + ext)).string();
+    runner.run(ext, "write", scene.name, scene.items, [&]() { return layer->Export(path); });
+    if (!readSelected) {
+        return;
+    }
+    if (!writeSelected && !layer->Export(path)) {
+        runner.skip(ext, "read", scene.name, "Failed to export " + path);
+        return;
+    }
+    runner.run(ext, "read", scene.name, scene.items, [&]() {
+        return static_cast<bool>(SdfLayer::OpenAsAnonymous(path));
+    });
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    std::string output;
+    if (!parseArguments(argc, argv, options, output)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    const std::filesystem::path workDir =
+      options.workDir.empty()
+        ? std::filesystem::temp_directory_path() / "usdFileFormatsBenchmarks"
+        : std::filesystem::path(options.workDir);
+    std::error_code ec;
+    std::filesystem::create_directories(workDir, ec);
+    if (ec) {
+        std::cerr << "Failed to create " << workDir << ": " << ec.message() << std::endl;
+        return 1;
+    }
+
+    BenchmarkRunner runner(options);
+    std::vector<SyntheticScene> scenes;
+    scenes.push_back(generateLargeMesh(options.scale));
+    scenes.push_back(generateManyMaterials(options.scale));
+    scenes.push_back(generateSkinnedAnimation(options.scale));
+    scenes.push_back(generateGsplatCloud(options.scale));
+
+    for (const SyntheticScene& scene : scenes) {
+        benchmarkLayerStages(runner, scene);
+    }
+    benchmarkTriangulation(runner, scenes[0]);
+    benchmarkInputTranslator(runner, options.scale);
+    for (const FormatBenchmarks& format : formats) {
+        for (const SyntheticScene& scene : scenes) {
+            if (std::find(format.scenes.begin(), format.scenes.end(), scene.name) !=
+                format.scenes.end()) {
+                benchmarkFormat(runner, format, scene, workDir);
+            }
+        }
+    }
+
+    if (output.empty()) {
+        runner.writeJson(std::cout);
+    } else {
+        std::ofstream file(output);
+        if (!file) {
+            std::cerr << "Failed to open " << output << std::endl;
+            return 1;
+        }
+        runner.writeJson(file);
+    }
+    return 0;
+}
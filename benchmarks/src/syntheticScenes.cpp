@@ -0,0 +1,288 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#include "syntheticScenes.h"
+
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/rotation.h>
+#include <pxr/base/gf/vec3h.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace adobe::usd::benchmarks {
+
+namespace {
+
+// Fixed seed, so that every run of a given scale generates the same scene
+constexpr unsigned int kSeed = 20240601;
+
+int
+scaledCount(int count, float scale, int minimum = 1)
+{
+    return std::max(minimum, static_cast<int>(std::lround(count * scale)));
+}
+
+// Fills `mesh` with a wavy grid of `cells` x `cells` quads spanning `size` units in x and y
+void
+fillGrid(Mesh& mesh, int cells, float size)
+{
+    const int side = cells + 1;
+    const float step = size / cells;
+    mesh.points.resize(side * side);
+    mesh.normals.values.resize(side * side);
+    mesh.normals.interpolation = UsdGeomTokens->vertex;
+    mesh.uvs.values.resize(side * side);
+    mesh.uvs.interpolation = UsdGeomTokens->vertex;
+    for (int y = 0; y < side; y++) {
+        for (int x = 0; x < side; x++) {
+            const int i = y * side + x;
+            const float px = x * step;
+            const float py = y * step;
+            const float pz = 0.1f * std::sin(px) * std::cos(py);
+            mesh.points[i] = GfVec3f(px, py, pz);
+            const float dzdx = 0.1f * std::cos(px) * std::cos(py);
+            const float dzdy = -0.1f * std::sin(px) * std::sin(py);
+            mesh.normals.values[i] = GfVec3f(-dzdx, -dzdy, 1.0f).GetNormalized();
+            mesh.uvs.values[i] = GfVec2f(float(x) / cells, float(y) / cells);
+        }
+    }
+    mesh.faces.assign(cells * cells, 4);
+    mesh.indices.resize(cells * cells * 4);
+    for (int y = 0; y < cells; y++) {
+        for (int x = 0; x < cells; x++) {
+            int* quad = &mesh.indices[(y * cells + x) * 4];
+            quad[0] = y * side + x;
+            quad[1] = y * side + x + 1;
+            quad[2] = (y + 1) * side + x + 1;
+            quad[3] = (y + 1) * side + x;
+        }
+    }
+}
+
+}
+
+SyntheticScene
+generateLargeMesh(float scale)
+{
+    SyntheticScene scene;
+    scene.name = "largeMesh";
+    const int cells = scaledCount(512, std::sqrt(scale), 2);
+
+    auto [meshIndex, mesh] = scene.data.addMesh();
+    mesh.name = "Grid";
+    fillGrid(mesh, cells, 100.0f);
+    auto [nodeIndex, node] = scene.data.addNode(-1);
+    node.name = "Grid";
+    node.staticMeshes.push_back(meshIndex);
+
+    scene.items = mesh.points.size();
+    return scene;
+}
+
+SyntheticScene
+generateManyMaterials(float scale)
+{
+    SyntheticScene scene;
+    scene.name = "manyMaterials";
+    const int count = scaledCount(256, scale);
+    const int columns = static_cast<int>(std::ceil(std::sqrt(count)));
+
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (int i = 0; i < count; i++) {
+        auto [materialIndex, material] = scene.data.addMaterial();
+        material.name = "Material" + std::to_string(i);
+        material.diffuseColor.value = VtValue(GfVec3f(unit(rng), unit(rng), unit(rng)));
+        material.roughness.value = VtValue(unit(rng));
+        material.metallic.value = VtValue(unit(rng));
+
+        auto [meshIndex, mesh] = scene.data.addMesh();
+        mesh.name = "Tile" + std::to_string(i);
+        fillGrid(mesh, 4, 1.0f);
+        mesh.material = materialIndex;
+
+        auto [nodeIndex, node] = scene.data.addNode(-1);
+        node.name = mesh.name;
+        node.translation = GfVec3d(1.5 * (i % columns), 1.5 * (i / columns), 0.0);
+        node.staticMeshes.push_back(meshIndex);
+    }
+
+    scene.items = count;
+    return scene;
+}
+
+SyntheticScene
+generateSkinnedAnimation(float scale)
+{
+    SyntheticScene scene;
+    scene.name = "skinnedAnimation";
+    const int jointCount = scaledCount(64, std::sqrt(scale), 2);
+    const int frameCount = scaledCount(120, std::sqrt(scale), 2);
+    const int cells = scaledCount(128, std::sqrt(scale), 2);
+    const float segment = 1.0f;
+    const float height = segment * jointCount;
+
+    // A chain of joints going up the y axis
+    auto [skeletonIndex, skeleton] = scene.data.addSkeleton();
+    skeleton.name = "Chain";
+    std::string path;
+    for (int j = 0; j < jointCount; j++) {
+        const std::string jointName = "joint" + std::to_string(j);
+        path = j ? path + "/" + jointName : jointName;
+        skeleton.joints.push_back(TfToken(path));
+        skeleton.jointNames.push_back(TfToken(jointName));
+        skeleton.jointParents.push_back(j - 1);
+        GfMatrix4d rest(1.0);
+        rest.SetTranslate(GfVec3d(0.0, j ? segment : 0.0, 0.0));
+        skeleton.restTransforms.push_back(rest);
+        GfMatrix4d bind(1.0);
+        bind.SetTranslate(GfVec3d(0.0, segment * j, 0.0));
+        skeleton.bindTransforms.push_back(bind);
+        skeleton.inverseBindTransforms.push_back(bind.GetInverse());
+    }
+    skeleton.animatedJoints = skeleton.joints;
+
+    // Every joint sways around z, with a phase offset along the chain
+    SkeletonAnimation animation;
+    for (int f = 0; f < frameCount; f++) {
+        animation.times.push_back(static_cast<float>(f));
+        VtArray<GfQuatf> rotations(jointCount);
+        VtArray<GfVec3f> translations(jointCount);
+        VtArray<GfVec3h> scales(jointCount, GfVec3h(1.0f));
+        for (int j = 0; j < jointCount; j++) {
+            const double angle = 10.0 * std::sin(0.1 * f + 0.3 * j);
+            rotations[j] = GfQuatf(GfRotation(GfVec3d(0.0, 0.0, 1.0), angle).GetQuat());
+            translations[j] = GfVec3f(0.0f, j ? segment : 0.0f, 0.0f);
+        }
+        animation.rotations.push_back(rotations);
+        animation.translations.push_back(translations);
+        animation.scales.push_back(scales);
+    }
+    skeleton.skeletonAnimations.push_back(std::move(animation));
+
+    // A vertical grid, each vertex blended between the two joints closest to its height
+    auto [meshIndex, mesh] = scene.data.addMesh();
+    mesh.name = "Skin";
+    fillGrid(mesh, cells, height);
+    mesh.influenceCount = 2;
+    mesh.joints.resize(mesh.points.size() * 2);
+    mesh.weights.resize(mesh.points.size() * 2);
+    for (size_t i = 0; i < mesh.points.size(); i++) {
+        const float t = std::clamp(mesh.points[i][1] / segment, 0.0f, jointCount - 1.0f);
+        const int lower = std::min(static_cast<int>(t), jointCount - 2);
+        const float blend = t - lower;
+        mesh.joints[i * 2] = lower;
+        mesh.joints[i * 2 + 1] = lower + 1;
+        mesh.weights[i * 2] = 1.0f - blend;
+        mesh.weights[i * 2 + 1] = blend;
+    }
+    skeleton.meshSkinningTargets.push_back(meshIndex);
+
+    AnimationTrack track;
+    track.name = "Sway";
+    track.displayName = "Sway";
+    track.minTime = 0.0f;
+    track.maxTime = frameCount - 1.0f;
+    track.hasTimepoints = true;
+    scene.data.animationTracks.push_back(track);
+    scene.data.hasAnimations = true;
+    scene.data.timeCodesPerSecond = 24.0;
+
+    scene.items = static_cast<size_t>(frameCount) * jointCount;
+    return scene;
+}
+
+SyntheticScene
+generateGsplatCloud(float scale)
+{
+    SyntheticScene scene;
+    scene.name = "gsplatCloud";
+    const int count = scaledCount(200000, scale);
+    constexpr int shCoeffSets = 9; // first order, 3 coefficients for each of the 3 colors
+
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> symmetric(-1.0f, 1.0f);
+    std::normal_distribution<float> gaussian(0.0f, 1.0f);
+
+    auto [meshIndex, mesh] = scene.data.addMesh();
+    mesh.name = "Splats";
+    mesh.asPoints = true;
+    mesh.asGsplats = true;
+    mesh.points.resize(count);
+    mesh.pointWidths.resize(count);
+    mesh.pointRotations.interpolation = UsdGeomTokens->vertex;
+    mesh.pointRotations.values.resize(count);
+    for (int i = 0; i < count; i++) {
+        mesh.points[i] = GfVec3f(symmetric(rng), symmetric(rng), symmetric(rng));
+        mesh.pointWidths[i] = 0.01f + 0.02f * unit(rng);
+        GfQuatf rotation(gaussian(rng), gaussian(rng), gaussian(rng), gaussian(rng));
+        mesh.pointRotations.values[i] = rotation.GetNormalized();
+    }
+
+    for (int w = 0; w < 2; w++) {
+        auto [widthIndex, widths] = scene.data.addExtraPointWidthSet(meshIndex);
+        widths.interpolation = UsdGeomTokens->vertex;
+        widths.values.resize(count);
+        for (float& width : widths.values) {
+            width = 0.01f + 0.02f * unit(rng);
+        }
+    }
+
+    auto [colorIndex, colors] = scene.data.addColorSet(meshIndex);
+    colors.interpolation = UsdGeomTokens->vertex;
+    colors.values.resize(count);
+    for (GfVec3f& color : colors.values) {
+        color = GfVec3f(unit(rng), unit(rng), unit(rng));
+    }
+
+    auto [opacityIndex, opacities] = scene.data.addOpacitySet(meshIndex);
+    opacities.interpolation = UsdGeomTokens->vertex;
+    opacities.values.resize(count);
+    for (float& opacity : opacities.values) {
+        opacity = unit(rng);
+    }
+
+    for (int s = 0; s < shCoeffSets; s++) {
+        auto [shIndex, shCoeffs] = scene.data.addPointSHCoeffSet(meshIndex);
+        shCoeffs.interpolation = UsdGeomTokens->vertex;
+        shCoeffs.values.resize(count);
+        for (float& coeff : shCoeffs.values) {
+            coeff = 0.1f * symmetric(rng);
+        }
+    }
+
+    auto [nodeIndex, node] = scene.data.addNode(-1);
+    node.name = "Splats";
+    node.staticMeshes.push_back(meshIndex);
+
+    scene.items = count;
+    return scene;
+}
+
+Image
+generateNoiseImage(int size, int channels, unsigned int seed)
+{
+    std::mt19937 rng(kSeed + seed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    Image image;
+    image.allocate(size, size, channels);
+    for (float& pixel : image.pixels) {
+        pixel = unit(rng);
+    }
+    return image;
+}
+
+}
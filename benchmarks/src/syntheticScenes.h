@@ -0,0 +1,54 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#pragma once
+
+#include <fileformatutils/images.h>
+#include <fileformatutils/usdData.h>
+
+#include <string>
+
+/// \file syntheticScenes.h
+/// \brief Procedural scenes for the benchmarks. They only depend on the scale and a fixed seed,
+/// so the same scale always generates the same data.
+
+namespace adobe::usd::benchmarks {
+
+/// A generated scene, with a measure of its size
+struct SyntheticScene
+{
+    std::string name;
+    UsdData data;
+    size_t items = 0;
+};
+
+/// A single quad grid with normals and uvs. Items are points.
+SyntheticScene
+generateLargeMesh(float scale);
+
+/// Small meshes, each bound to its own material. Items are materials.
+SyntheticScene
+generateManyMaterials(float scale);
+
+/// A grid skinned to a chain of joints, with an animation of the chain. Items are keyframes times
+/// joints.
+SyntheticScene
+generateSkinnedAnimation(float scale);
+
+/// A gaussian splat cloud with first order spherical harmonics. Items are splats.
+SyntheticScene
+generateGsplatCloud(float scale);
+
+/// A noise texture of `size` x `size` pixels, used by the InputTranslator benchmarks
+Image
+generateNoiseImage(int size, int channels, unsigned int seed);
+
+}
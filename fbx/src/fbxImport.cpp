@@ -18,6 +18,7 @@ governing permissions and limitations under the License.
 #include <fileformatutils/featureFlags.h>
 #include <fileformatutils/images.h>
 #include <fileformatutils/materials.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/usdData.h>
 #include <filesystem>
 #include <fstream>
@@ -2567,8 +2568,8 @@ importFbxMaterials(ImportFbxContext& ctx)
         if (ctx.options->importImages) {
             if (isEmbedded) {
                 const std::vector<char>& data = embedded->second;
-                image.image.resize(data.size());
-                memcpy(image.image.data(), data.data(), data.size());
+                image.image =
+                  ImageBuffer(reinterpret_cast<const uint8_t*>(data.data()), data.size());
             } else {
                 std::ifstream file(absFileName, std::ios::binary);
                 if (!file.is_open()) {
@@ -2578,14 +2579,23 @@ importFbxMaterials(ImportFbxContext& ctx)
                 file.seekg(0, file.end);
                 int length = file.tellg();
                 file.seekg(0, file.beg);
-                image.image.resize(length);
-                file.read(reinterpret_cast<char*>(image.image.data()), length);
+                std::vector<uint8_t> bytes(length);
+                file.read(reinterpret_cast<char*>(bytes.data()), length);
                 file.close();
+                image.image = std::move(bytes);
             }
         }
     }
 
+    // Textures with identical images, for example embedded multiple times, are translated once
+    const std::vector<int> imageRemap = deduplicateImages(images);
+    for (auto& [texture, index] : textures) {
+        index = imageRemap[index];
+    }
+
     InputTranslator inputTranslator(ctx.options->importImages, images, DEBUG_TAG);
+    // Texture translations of all the materials are generated together at the end
+    inputTranslator.beginBatch();
     size_t materialsCount = ctx.scene->GetSrcObjectCount<FbxSurfaceMaterial>();
     const bool useOpenPbr = isNativeOpenPbrProcessingEnabled();
     if (useOpenPbr) {
@@ -2965,6 +2975,7 @@ importFbxMaterials(ImportFbxContext& ctx)
                     material->GetName());
         }
     }
+    inputTranslator.endBatch();
     ctx.usd->images = std::move(inputTranslator.getImages());
 }
 
@@ -3955,6 +3966,7 @@ importFbx(const ImportFbxOptions& options, Fbx& fbx, UsdData& usd)
     importMeshUVSets(ctx);
 
     if (options.importMaterials) {
+        ProfilePhase materialsPhase("materials");
         importFbxMaterials(ctx);
     }
     if (options.importGeometry) {
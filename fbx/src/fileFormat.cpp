@@ -20,6 +20,7 @@ governing permissions and limitations under the License.
 #include <fileformatutils/common.h>
 #include <fileformatutils/layerRead.h>
 #include <fileformatutils/layerWriteSdfData.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/resolver.h>
 #include <fileformatutils/usdData.h>
 
@@ -111,6 +112,7 @@ UsdFbxFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool me
     TfStopwatch w;
     w.Start();
     TF_DEBUG_MSG(FILE_FORMAT_FBX, "Read: %s\n", resolvedPath.c_str());
+    ProfileScope profile("fbx", "read", resolvedPath);
     std::string fileType = getFileExtension(resolvedPath, DEBUG_TAG);
     SdfAbstractDataRefPtr layerData = InitData(layer->GetFileFormatArguments());
     FbxDataConstPtr data = TfDynamic_cast<const FbxDataConstPtr>(layerData);
@@ -128,9 +130,12 @@ UsdFbxFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool me
     {
         const std::lock_guard<std::mutex> lock(mutex); // FBX SDK is not thread safe
         Fbx fbx;
+        ProfilePhase parsePhase("parse");
         GUARD(readFbx(fbx, resolvedPath, options.importImages, false),
               "Error reading FBX from %s\n",
               resolvedPath.c_str());
+        parsePhase.stop();
+        ProfilePhase importPhase("import");
         GUARD(importFbx(options, fbx, usd), "Error translating FBX to USD\n");
     }
     GUARD(writeLayer(
@@ -183,6 +188,7 @@ UsdFbxFileFormat::WriteToFile(const SdfLayer& layer,
     TfStopwatch w;
     w.Start();
     TF_DEBUG_MSG(FILE_FORMAT_FBX, "WriteToFile: %s\n", filename.c_str());
+    ProfileScope profile("fbx", "write", filename);
     UsdData usd;
     ReadLayerOptions layerOptions;
     ExportFbxOptions exportOptions;
@@ -200,7 +206,10 @@ UsdFbxFileFormat::WriteToFile(const SdfLayer& layer,
     {
         const std::lock_guard<std::mutex> lock(mutex); // FBX SDK is not thread safe
         Fbx fbx;
+        ProfilePhase exportPhase("export");
         GUARD(exportFbx(exportOptions, usd, fbx), "Error translating USD to FBX\n");
+        exportPhase.stop();
+        ProfilePhase writePhase("write");
         GUARD(
           writeFbx(exportOptions, fbx, filename), "Error writing FBX to %s\n", filename.c_str());
     }
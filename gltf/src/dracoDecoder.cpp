@@ -0,0 +1,319 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#include "dracoDecoder.h"
+#include <algorithm>
+#include <cstring>
+#include <draco/compression/decode.h>
+#include <draco/core/decoder_buffer.h>
+#include <draco/mesh/mesh.h>
+#include <limits>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/work/loops.h>
+#include <unordered_set>
+#include <vector>
+
+namespace adobe::usd {
+
+namespace {
+
+constexpr const char* DRACO_EXTENSION = "KHR_draco_mesh_compression";
+constexpr int kMaxComponents = 4;
+
+struct DracoAttribute
+{
+    int accessor = -1;
+    int uniqueId = -1;
+    std::vector<unsigned char> data;
+};
+
+// One compressed buffer view, along with the accessors of the primitive it decodes into. The data
+// is decoded in parallel into the vectors, and moved into the model afterwards.
+struct DracoPrimitive
+{
+    int bufferView = -1;
+    int indices = -1;
+    int indexComponentType = 0;
+    std::vector<DracoAttribute> attributes;
+    std::vector<unsigned char> indexData;
+    size_t pointCount = 0;
+    size_t indexCount = 0;
+    bool decoded = false;
+};
+
+template<typename T>
+void
+writeIndices(const draco::Mesh& mesh, std::vector<unsigned char>& dst)
+{
+    dst.resize(mesh.num_faces() * 3 * sizeof(T));
+    unsigned char* ptr = dst.data();
+    for (draco::FaceIndex f(0); f < mesh.num_faces(); ++f) {
+        const draco::Mesh::Face& face = mesh.face(f);
+        for (int k = 0; k < 3; ++k) {
+            const T index = static_cast<T>(face[k].value());
+            memcpy(ptr, &index, sizeof(T));
+            ptr += sizeof(T);
+        }
+    }
+}
+
+template<typename T>
+bool
+writeAttribute(const draco::Mesh& mesh,
+               const draco::PointAttribute& attribute,
+               std::vector<unsigned char>& dst)
+{
+    const int componentCount = attribute.num_components();
+    if (componentCount > kMaxComponents) {
+        return false;
+    }
+    dst.resize(mesh.num_points() * componentCount * sizeof(T));
+    unsigned char* ptr = dst.data();
+    T values[kMaxComponents] = {};
+    for (draco::PointIndex i(0); i < mesh.num_points(); ++i) {
+        if (!attribute.ConvertValue<T>(attribute.mapped_index(i), componentCount, values)) {
+            return false;
+        }
+        memcpy(ptr, values, componentCount * sizeof(T));
+        ptr += componentCount * sizeof(T);
+    }
+    return true;
+}
+
+bool
+writeAttribute(const draco::Mesh& mesh,
+               const draco::PointAttribute& attribute,
+               int componentType,
+               std::vector<unsigned char>& dst)
+{
+    switch (componentType) {
+        case TINYGLTF_COMPONENT_TYPE_BYTE:
+            return writeAttribute<int8_t>(mesh, attribute, dst);
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+            return writeAttribute<uint8_t>(mesh, attribute, dst);
+        case TINYGLTF_COMPONENT_TYPE_SHORT:
+            return writeAttribute<int16_t>(mesh, attribute, dst);
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+            return writeAttribute<uint16_t>(mesh, attribute, dst);
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+            return writeAttribute<uint32_t>(mesh, attribute, dst);
+        case TINYGLTF_COMPONENT_TYPE_FLOAT:
+            return writeAttribute<float>(mesh, attribute, dst);
+        default:
+            return false;
+    }
+}
+
+// Reads the extension of a primitive, and validates its references into the model
+bool
+parseDracoPrimitive(const tinygltf::Model& gltf,
+                    const tinygltf::Primitive& primitive,
+                    const tinygltf::Value& extension,
+                    DracoPrimitive& draco)
+{
+    const tinygltf::Value& bufferView = extension.Get("bufferView");
+    const tinygltf::Value& attributes = extension.Get("attributes");
+    if (!bufferView.IsInt() || !attributes.IsObject()) {
+        return false;
+    }
+    draco.bufferView = bufferView.GetNumberAsInt();
+    if (draco.bufferView < 0 || static_cast<size_t>(draco.bufferView) >= gltf.bufferViews.size()) {
+        return false;
+    }
+    const tinygltf::BufferView& view = gltf.bufferViews[draco.bufferView];
+    if (view.buffer < 0 || static_cast<size_t>(view.buffer) >= gltf.buffers.size() ||
+        view.byteOffset > gltf.buffers[view.buffer].data.size() ||
+        view.byteLength > gltf.buffers[view.buffer].data.size() - view.byteOffset) {
+        return false;
+    }
+
+    if (primitive.indices >= 0) {
+        if (static_cast<size_t>(primitive.indices) >= gltf.accessors.size()) {
+            return false;
+        }
+        draco.indices = primitive.indices;
+        draco.indexComponentType = gltf.accessors[primitive.indices].componentType;
+    }
+    for (const std::string& name : attributes.Keys()) {
+        const tinygltf::Value& uniqueId = attributes.Get(name);
+        auto it = primitive.attributes.find(name);
+        if (!uniqueId.IsInt() || it == primitive.attributes.end() || it->second < 0 ||
+            static_cast<size_t>(it->second) >= gltf.accessors.size()) {
+            return false;
+        }
+        DracoAttribute attribute;
+        attribute.accessor = it->second;
+        attribute.uniqueId = uniqueId.GetNumberAsInt();
+        draco.attributes.push_back(std::move(attribute));
+    }
+    return true;
+}
+
+// Decodes the compressed buffer view of the primitive. Only reads from the model.
+bool
+decodeDracoPrimitive(const tinygltf::Model& gltf, DracoPrimitive& draco)
+{
+    const tinygltf::BufferView& view = gltf.bufferViews[draco.bufferView];
+    const tinygltf::Buffer& buffer = gltf.buffers[view.buffer];
+    draco::DecoderBuffer decoderBuffer;
+    decoderBuffer.Init(reinterpret_cast<const char*>(buffer.data.data() + view.byteOffset),
+                       view.byteLength);
+    draco::Decoder decoder;
+    auto result = decoder.DecodeMeshFromBuffer(&decoderBuffer);
+    if (!result.ok()) {
+        TF_WARN("Failed to decode buffer view %d with %s: %s",
+                draco.bufferView,
+                DRACO_EXTENSION,
+                result.status().error_msg());
+        return false;
+    }
+    const std::unique_ptr<draco::Mesh>& mesh = result.value();
+    draco.pointCount = mesh->num_points();
+
+    if (draco.indices >= 0) {
+        // The indices accessor may declare a component type that is too small for the decoded
+        // point count. Widen it rather than truncating the indices.
+        int componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT;
+        if (draco.pointCount <= std::numeric_limits<uint8_t>::max()) {
+            componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
+        } else if (draco.pointCount <= std::numeric_limits<uint16_t>::max()) {
+            componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
+        }
+        draco.indexComponentType = std::max(draco.indexComponentType, componentType);
+        draco.indexCount = mesh->num_faces() * 3;
+        switch (draco.indexComponentType) {
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                writeIndices<uint8_t>(*mesh, draco.indexData);
+                break;
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+                writeIndices<uint16_t>(*mesh, draco.indexData);
+                break;
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+                writeIndices<uint32_t>(*mesh, draco.indexData);
+                break;
+            default:
+                TF_WARN("Invalid indices component type %d for %s buffer view %d",
+                        draco.indexComponentType,
+                        DRACO_EXTENSION,
+                        draco.bufferView);
+                return false;
+        }
+    }
+
+    for (DracoAttribute& attribute : draco.attributes) {
+        const tinygltf::Accessor& accessor = gltf.accessors[attribute.accessor];
+        const draco::PointAttribute* pointAttribute =
+          mesh->GetAttributeByUniqueId(static_cast<uint32_t>(attribute.uniqueId));
+        // Attributes are converted through a scratch array of kMaxComponents values, which is
+        // enough for every vertex attribute glTF allows. Matrix accessors are rejected.
+        if (!pointAttribute || pointAttribute->num_components() > kMaxComponents ||
+            pointAttribute->num_components() != tinygltf::GetNumComponentsInType(accessor.type) ||
+            !writeAttribute(*mesh, *pointAttribute, accessor.componentType, attribute.data)) {
+            TF_WARN("Failed to decode attribute %d of %s buffer view %d",
+                    attribute.uniqueId,
+                    DRACO_EXTENSION,
+                    draco.bufferView);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Appends a buffer and a tightly packed view over it, and points the accessor at that view
+void
+addDecodedAccessor(tinygltf::Model& gltf,
+                   int accessorIndex,
+                   size_t count,
+                   int target,
+                   std::vector<unsigned char>&& data)
+{
+    tinygltf::BufferView view;
+    view.buffer = static_cast<int>(gltf.buffers.size());
+    view.byteOffset = 0;
+    view.byteLength = data.size();
+    view.byteStride = 0;
+    view.target = target;
+
+    tinygltf::Buffer buffer;
+    buffer.data = std::move(data);
+    gltf.buffers.push_back(std::move(buffer));
+    gltf.bufferViews.push_back(std::move(view));
+
+    tinygltf::Accessor& accessor = gltf.accessors[accessorIndex];
+    accessor.bufferView = static_cast<int>(gltf.bufferViews.size() - 1);
+    accessor.byteOffset = 0;
+    accessor.count = count;
+}
+
+}
+
+void
+decodeDracoPrimitives(tinygltf::Model& gltf)
+{
+    // Gather the compressed buffer views first. A view shared by several primitives is only
+    // decoded once, for the first primitive that references it, which is what tinygltf does.
+    std::vector<DracoPrimitive> primitives;
+    std::unordered_set<int> bufferViews;
+    for (const tinygltf::Mesh& mesh : gltf.meshes) {
+        for (const tinygltf::Primitive& primitive : mesh.primitives) {
+            auto it = primitive.extensions.find(DRACO_EXTENSION);
+            if (it == primitive.extensions.end()) {
+                continue;
+            }
+            DracoPrimitive draco;
+            if (!parseDracoPrimitive(gltf, primitive, it->second, draco)) {
+                TF_WARN(
+                  "Mesh '%s' has an invalid %s extension", mesh.name.c_str(), DRACO_EXTENSION);
+                continue;
+            }
+            if (gltf.bufferViews[draco.bufferView].dracoDecoded ||
+                !bufferViews.insert(draco.bufferView).second) {
+                continue;
+            }
+            primitives.push_back(std::move(draco));
+        }
+    }
+    if (primitives.empty()) {
+        return;
+    }
+
+    // Each primitive decodes into its own vectors, reading only from the model
+    PXR_NS::WorkParallelForN(primitives.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            primitives[i].decoded = decodeDracoPrimitive(gltf, primitives[i]);
+        }
+    });
+
+    // Add the decoded data to the model in primitive order, so that the result is deterministic
+    for (DracoPrimitive& draco : primitives) {
+        if (!draco.decoded) {
+            continue;
+        }
+        gltf.bufferViews[draco.bufferView].dracoDecoded = true;
+        if (draco.indices >= 0) {
+            gltf.accessors[draco.indices].componentType = draco.indexComponentType;
+            addDecodedAccessor(gltf,
+                               draco.indices,
+                               draco.indexCount,
+                               TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER,
+                               std::move(draco.indexData));
+        }
+        for (DracoAttribute& attribute : draco.attributes) {
+            addDecodedAccessor(gltf,
+                               attribute.accessor,
+                               draco.pointCount,
+                               TINYGLTF_TARGET_ARRAY_BUFFER,
+                               std::move(attribute.data));
+        }
+    }
+}
+
+}
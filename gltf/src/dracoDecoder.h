@@ -0,0 +1,30 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#pragma once
+#include <tiny_gltf.h>
+
+/// \file dracoDecoder.h
+///
+/// Decoding of the KHR_draco_mesh_compression glTF extension. tinygltf is able to decode Draco
+/// primitives itself, but does so one after another while parsing the meshes. The plugin
+/// instead decodes all the compressed primitives of the loaded model concurrently.
+
+namespace adobe::usd {
+
+/// Decodes the Draco compressed primitives of `gltf` in parallel. The decoded indices and
+/// attributes are appended as new buffers and buffer views, and the accessors of the primitive
+/// are pointed at them, the same way tinygltf does when it is built with Draco. Compressed buffer
+/// views that were already decoded are skipped, and primitives that fail to decode are left as is.
+void
+decodeDracoPrimitives(tinygltf::Model& gltf);
+
+}
@@ -19,6 +19,7 @@ governing permissions and limitations under the License.
 #include <fileformatutils/common.h>
 #include <fileformatutils/layerRead.h>
 #include <fileformatutils/layerWriteSdfData.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/resolver.h>
 #include <fileformatutils/usdData.h>
 
@@ -139,6 +140,7 @@ UsdGltfFileFormat::Read(PXR_NS::SdfLayer* layer,
     TfStopwatch w;
     w.Start();
     TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Read: %s\n", resolvedPath.c_str());
+    ProfileScope profile("gltf", "read", resolvedPath);
 
     SdfAbstractDataRefPtr layerData = InitData(layer->GetFileFormatArguments());
     GltfDataConstPtr data = TfDynamic_cast<const GltfDataConstPtr>(layerData);
@@ -157,33 +159,46 @@ UsdGltfFileFormat::Read(PXR_NS::SdfLayer* layer,
                  isAscii ? "GLTF" : "GLB",
                  baseDir.c_str(),
                  bufferSize >> 10);
+    profileAddCounter("sourceBytes", bufferSize);
 
+    // A metadata-only read skips the meshes, materials, images and buffers altogether
     tinygltf::Model gltf;
-    GUARD(readGltfFromMemory(gltf, baseDir, isAscii, &*buffer, bufferSize),
-          "Error reading glTF file\n");
+    ProfilePhase parsePhase("parse");
+    if (metadataOnly) {
+        GUARD(readGltfMetadataFromMemory(gltf, baseDir, isAscii, &*buffer, bufferSize),
+              "Error reading glTF file\n");
+    } else {
+        GUARD(readGltfFromMemory(gltf, baseDir, isAscii, &*buffer, bufferSize),
+              "Error reading glTF file\n");
+    }
+    parsePhase.stop();
 
     UsdData usd;
     ImportGltfOptions options;
-    options.importGeometry = true;
-    options.importMaterials = true;
-    options.importImages = true;
-    options.importLights = data->importLights;
+    options.importGeometry = !metadataOnly;
+    options.importMaterials = !metadataOnly;
+    options.importImages = !metadataOnly;
+    options.importLights = data->importLights && !metadataOnly;
     options.computeBitangents = data->computeBitangents;
+    options.metadataOnly = metadataOnly;
+    ProfilePhase importPhase("import");
     GUARD(importGltf(options, gltf, usd, resolvedPath), "Error translating glTF to USD\n");
+    importPhase.stop();
 
     WriteLayerOptions layerOptions(*data);
     layerOptions.pruneJoints = false;
     layerOptions.animationTracks = data->animationTracks;
+    layerOptions.metadataOnly = metadataOnly;
     std::string ext = isAscii ? "GLTF" : "GLB";
     GUARD(
       writeLayer(layerOptions, usd, layer, layerData, ext, DEBUG_TAG, SdfFileFormat::_SetLayerData),
       "Error writing to the USD layer\n");
 
     // Populate the GLTF resolver with the images we just parsed from the asset, so that we don't
-    // have to open the asset again.
+    // have to open the asset again. A metadata-only read leaves the cache untouched.
     if (options.importImages) {
         Resolver::populateCache(resolvedPath, std::move(usd.images));
-    } else {
+    } else if (!metadataOnly) {
         Resolver::clearCache(resolvedPath);
     }
 
@@ -248,6 +263,7 @@ UsdGltfFileFormat::WriteToFile(const SdfLayer& layer,
     TfStopwatch w;
     w.Start();
     TF_DEBUG_MSG(FILE_FORMAT_GLTF, "WriteToFile: %s\n", filename.c_str());
+    ProfileScope profile("gltf", "write", filename);
     for (const auto& [k, v] : args) {
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "  ARG: %s -> %s\n", k.c_str(), v.c_str());
     }
@@ -275,11 +291,15 @@ UsdGltfFileFormat::WriteToFile(const SdfLayer& layer,
     exportOptions.embedImages = embedImages;
     exportOptions.useMaterialExtensions = useMaterialExtensions;
     tinygltf::Model gltf;
+    ProfilePhase exportPhase("export");
     GUARD(exportGltf(exportOptions, usd, gltf), "Error translating USD to glTF\n");
+    exportPhase.stop();
 
     WriteGltfOptions writeOptions;
     writeOptions.embedImages = embedImages;
+    ProfilePhase writePhase("write");
     GUARD(writeGltf(writeOptions, gltf, filename), "Error writing glTF file\n");
+    writePhase.stop();
 
     w.Stop();
     TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Total time: %ld\n", static_cast<long int>(w.GetMilliseconds()));
@@ -11,16 +11,27 @@ governing permissions and limitations under the License.
 */
 #include "gltf.h"
 #include "debugCodes.h"
+#include "meshoptDecoder.h"
+#ifdef USD_FILEFORMATS_ENABLE_DRACO
+#include "dracoDecoder.h"
+#endif
+#include <algorithm>
+#include <atomic>
 #include <fileformatutils/common.h>
 #include <fileformatutils/neuralAssetsHelper.h>
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <nlohmann/json.hpp>
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdSkel/utils.h>
+#include <string_view>
+#include <type_traits>
 #include <tiny_gltf.h>
+#include <unordered_map>
 
 // Defined in IMPLEMENTATION sector in tinygltf.h but needed here
 namespace tinygltf {
@@ -179,6 +190,342 @@ preValidateGLB(const unsigned char* buffer, size_t bufferSize)
     return true;
 }
 
+namespace {
+
+constexpr uint32_t GLB_MAGIC = 0x46546C67;      // "glTF"
+constexpr uint32_t GLB_CHUNK_JSON = 0x4E4F534A; // "JSON"
+constexpr uint32_t GLB_CHUNK_BIN = 0x004E4942;  // "BIN\0"
+constexpr size_t GLB_HEADER_SIZE = 12;
+constexpr size_t GLB_CHUNK_HEADER_SIZE = 8;
+
+// Top level glTF properties needed to import materials and their images. Meshes, accessors, the
+// scene graph and animations are dropped from the image-only read.
+const char* const imageOnlyProperties[] = {
+    "asset",     "extensions", "extensionsRequired", "extensionsUsed",
+    "materials", "textures",   "images",             "samplers",
+};
+
+// Top level glTF properties needed to import the layer metadata: the asset description and the
+// animations, whose time ranges are taken from the bounds of their input accessors.
+const char* const metadataOnlyProperties[] = {
+    "asset",          "extensions", "extensionsRequired",
+    "extensionsUsed", "accessors",  "animations",
+};
+
+size_t
+alignTo4(size_t size)
+{
+    return (size + 3) & ~size_t(3);
+}
+
+// Locate the JSON and BIN chunks of a GLB in place, without copying them
+bool
+locateGlbChunks(const char* buffer,
+                size_t bufferSize,
+                const char*& json,
+                size_t& jsonSize,
+                const char*& bin,
+                size_t& binSize)
+{
+    auto readU32 = [&](size_t offset) {
+        uint32_t value;
+        memcpy(&value, buffer + offset, sizeof(value));
+        return value;
+    };
+    if (bufferSize < GLB_HEADER_SIZE + GLB_CHUNK_HEADER_SIZE || readU32(0) != GLB_MAGIC) {
+        return false;
+    }
+    size_t offset = GLB_HEADER_SIZE;
+    jsonSize = readU32(offset);
+    if (readU32(offset + 4) != GLB_CHUNK_JSON ||
+        jsonSize > bufferSize - offset - GLB_CHUNK_HEADER_SIZE) {
+        return false;
+    }
+    json = buffer + offset + GLB_CHUNK_HEADER_SIZE;
+    offset += GLB_CHUNK_HEADER_SIZE + alignTo4(jsonSize);
+
+    bin = nullptr;
+    binSize = 0;
+    if (offset + GLB_CHUNK_HEADER_SIZE <= bufferSize && readU32(offset + 4) == GLB_CHUNK_BIN) {
+        binSize = readU32(offset);
+        if (binSize > bufferSize - offset - GLB_CHUNK_HEADER_SIZE) {
+            return false;
+        }
+        bin = buffer + offset + GLB_CHUNK_HEADER_SIZE;
+    }
+    return true;
+}
+
+// Append the bytes of a buffer view to dst. GLB-stored bytes are copied straight from the mapped
+// binary chunk and external buffers are only read over the range of the view.
+bool
+appendBufferViewBytes(const nlohmann::json& doc,
+                      int viewIndex,
+                      const std::string& baseDir,
+                      const char* bin,
+                      size_t binSize,
+                      std::unordered_map<int, std::string>& decodedBuffers,
+                      std::vector<uint8_t>& dst)
+{
+    const nlohmann::json& views = doc.at("bufferViews");
+    if (viewIndex < 0 || static_cast<size_t>(viewIndex) >= views.size()) {
+        return false;
+    }
+    const nlohmann::json& view = views.at(viewIndex);
+    const int bufferIndex = view.at("buffer").get<int>();
+    const size_t byteOffset = view.value("byteOffset", size_t(0));
+    const size_t byteLength = view.at("byteLength").get<size_t>();
+    const nlohmann::json& buffers = doc.at("buffers");
+    if (bufferIndex < 0 || static_cast<size_t>(bufferIndex) >= buffers.size()) {
+        return false;
+    }
+    const std::string uri = buffers.at(bufferIndex).value("uri", std::string());
+
+    const size_t dstOffset = dst.size();
+    if (uri.empty()) {
+        if (!bin || bufferIndex != 0 || byteOffset > binSize || byteLength > binSize - byteOffset) {
+            return false;
+        }
+        dst.insert(dst.end(), bin + byteOffset, bin + byteOffset + byteLength);
+    } else if (uri.compare(0, 5, "data:") == 0) {
+        auto [it, inserted] = decodedBuffers.insert({ bufferIndex, std::string() });
+        if (inserted) {
+            it->second = tinygltf::base64_decode(uri.substr(uri.find(',') + 1));
+        }
+        const std::string& decoded = it->second;
+        if (byteOffset > decoded.size() || byteLength > decoded.size() - byteOffset) {
+            return false;
+        }
+        const char* bytes = decoded.data() + byteOffset;
+        dst.insert(dst.end(), bytes, bytes + byteLength);
+    } else {
+        if (baseDir.empty()) {
+            return false;
+        }
+        std::ifstream file(TfStringCatPaths(baseDir, uri), std::ios::in | std::ios::binary);
+        if (!file.is_open() || !file.seekg(static_cast<std::streamoff>(byteOffset))) {
+            return false;
+        }
+        dst.resize(dstOffset + byteLength);
+        file.read(reinterpret_cast<char*>(dst.data() + dstOffset),
+                  static_cast<std::streamsize>(byteLength));
+        if (static_cast<size_t>(file.gcount()) != byteLength) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Pack a JSON document and binary bytes as a GLB, padding both chunks to 4 bytes
+bool
+packGlb(std::string json, const char* bin, size_t binSize, std::vector<char>& glb)
+{
+    json.resize(alignTo4(json.size()), ' ');
+    const size_t binChunkSize = alignTo4(binSize);
+    const size_t glbSize = GLB_HEADER_SIZE + GLB_CHUNK_HEADER_SIZE + json.size() +
+                           (binSize ? GLB_CHUNK_HEADER_SIZE + binChunkSize : 0);
+    if (glbSize > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    glb.assign(glbSize, 0);
+    auto writeU32 = [&](size_t offset, uint32_t value) {
+        memcpy(glb.data() + offset, &value, sizeof(value));
+    };
+    size_t offset = 0;
+    writeU32(offset, GLB_MAGIC);
+    writeU32(offset + 4, 2);
+    writeU32(offset + 8, static_cast<uint32_t>(glbSize));
+    offset += GLB_HEADER_SIZE;
+    writeU32(offset, static_cast<uint32_t>(json.size()));
+    writeU32(offset + 4, GLB_CHUNK_JSON);
+    offset += GLB_CHUNK_HEADER_SIZE;
+    memcpy(glb.data() + offset, json.data(), json.size());
+    offset += json.size();
+    if (binSize) {
+        writeU32(offset, static_cast<uint32_t>(binChunkSize));
+        writeU32(offset + 4, GLB_CHUNK_BIN);
+        offset += GLB_CHUNK_HEADER_SIZE;
+        memcpy(glb.data() + offset, bin, binSize);
+    }
+    return true;
+}
+
+constexpr const char* MESHOPT_EXTENSION = "EXT_meshopt_compression";
+
+// Base64 of 3 zero bytes, the data of the fallback buffers while tinygltf loads the file
+constexpr const char* MESHOPT_PLACEHOLDER_URI = "data:application/octet-stream;base64,AAAA";
+constexpr size_t MESHOPT_PLACEHOLDER_SIZE = 3;
+
+// A buffer view compressed with EXT_meshopt_compression. The view itself points at the range of
+// its fallback buffer receiving the decoded data.
+struct MeshoptBufferView
+{
+    int view = -1;
+    int buffer = -1;
+    size_t byteOffset = 0;
+    size_t byteLength = 0;
+    size_t byteStride = 0;
+    size_t count = 0;
+    MeshoptMode mode = MeshoptMode::Attributes;
+    MeshoptFilter filter = MeshoptFilter::None;
+};
+
+struct MeshoptBuffers
+{
+    // Index and byte length of the fallback buffers that have no data of their own
+    std::vector<std::pair<int, size_t>> fallbackBuffers;
+    std::vector<MeshoptBufferView> views;
+};
+
+// Compressed files leave the fallback buffers without a uri, which tinygltf can't load. Such
+// buffers are replaced by a placeholder in `rewritten`, a copy of the file for the load, and the
+// views to decode into them are gathered in `meshopt`. `rewritten` stays empty when the file can
+// be loaded as is.
+bool
+prepareMeshoptBuffers(bool isAscii,
+                      const char* buffer,
+                      size_t bufferSize,
+                      std::vector<char>& rewritten,
+                      MeshoptBuffers& meshopt)
+{
+    const char* json = buffer;
+    size_t jsonSize = bufferSize;
+    const char* bin = nullptr;
+    size_t binSize = 0;
+    if (!isAscii && !locateGlbChunks(buffer, bufferSize, json, jsonSize, bin, binSize)) {
+        // Left to tinygltf to report
+        return true;
+    }
+    if (std::string_view(json, jsonSize).find(MESHOPT_EXTENSION) == std::string_view::npos) {
+        return true;
+    }
+
+    std::string rewrittenJson;
+    try {
+        nlohmann::json doc = nlohmann::json::parse(json, json + jsonSize);
+        auto buffers = doc.find("buffers");
+        if (!doc.is_object() || buffers == doc.end() || !buffers->is_array()) {
+            return true;
+        }
+        std::unordered_map<int, size_t> fallbackSizes;
+        for (size_t i = 0; i < buffers->size(); ++i) {
+            nlohmann::json& gltfBuffer = (*buffers)[i];
+            if (!gltfBuffer.is_object() || gltfBuffer.contains("uri")) {
+                continue;
+            }
+            auto extensions = gltfBuffer.find("extensions");
+            if (extensions == gltfBuffer.end() || !extensions->contains(MESHOPT_EXTENSION) ||
+                !extensions->at(MESHOPT_EXTENSION).value("fallback", false)) {
+                continue;
+            }
+            const size_t byteLength = gltfBuffer.at("byteLength").get<size_t>();
+            fallbackSizes[static_cast<int>(i)] = byteLength;
+            meshopt.fallbackBuffers.push_back({ static_cast<int>(i), byteLength });
+            gltfBuffer["uri"] = MESHOPT_PLACEHOLDER_URI;
+            gltfBuffer["byteLength"] = MESHOPT_PLACEHOLDER_SIZE;
+        }
+        if (fallbackSizes.empty()) {
+            return true;
+        }
+
+        auto views = doc.find("bufferViews");
+        if (views != doc.end() && views->is_array()) {
+            for (size_t i = 0; i < views->size(); ++i) {
+                const nlohmann::json& view = (*views)[i];
+                if (!view.is_object() || !fallbackSizes.count(view.value("buffer", -1))) {
+                    continue;
+                }
+                auto extensions = view.find("extensions");
+                if (extensions == view.end() || !extensions->contains(MESHOPT_EXTENSION)) {
+                    continue;
+                }
+                const nlohmann::json& ext = extensions->at(MESHOPT_EXTENSION);
+                MeshoptBufferView meshoptView;
+                meshoptView.view = static_cast<int>(i);
+                meshoptView.buffer = ext.at("buffer").get<int>();
+                meshoptView.byteOffset = ext.value("byteOffset", size_t(0));
+                meshoptView.byteLength = ext.at("byteLength").get<size_t>();
+                meshoptView.byteStride = ext.at("byteStride").get<size_t>();
+                meshoptView.count = ext.at("count").get<size_t>();
+                if (!parseMeshoptMode(ext.at("mode").get<std::string>(), meshoptView.mode) ||
+                    !parseMeshoptFilter(ext.value("filter", std::string()), meshoptView.filter)) {
+                    TF_WARN("Unsupported %s mode or filter on buffer view %zu",
+                            MESHOPT_EXTENSION,
+                            i);
+                    return false;
+                }
+                meshopt.views.push_back(meshoptView);
+            }
+        }
+        rewrittenJson = doc.dump();
+    } catch (const std::exception& e) {
+        TF_WARN("Invalid %s properties: %s", MESHOPT_EXTENSION, e.what());
+        return false;
+    }
+
+    if (isAscii) {
+        rewritten.assign(rewrittenJson.begin(), rewrittenJson.end());
+        return true;
+    }
+    // The binary chunk is unchanged, only the JSON chunk is rewritten
+    return packGlb(std::move(rewrittenJson), bin, binSize, rewritten);
+}
+
+// Restore the fallback buffers to their size and decode the compressed views into them
+bool
+decodeMeshoptBuffers(tinygltf::Model& gltf, const MeshoptBuffers& meshopt)
+{
+    for (const auto& [bufferIndex, byteLength] : meshopt.fallbackBuffers) {
+        if (static_cast<size_t>(bufferIndex) >= gltf.buffers.size()) {
+            return false;
+        }
+        gltf.buffers[bufferIndex].data.assign(byteLength, 0);
+    }
+
+    for (const MeshoptBufferView& view : meshopt.views) {
+        if (view.buffer < 0 || static_cast<size_t>(view.buffer) >= gltf.buffers.size()) {
+            TF_WARN("Buffer view %d has an invalid %s buffer", view.view, MESHOPT_EXTENSION);
+            return false;
+        }
+        const tinygltf::Buffer& src = gltf.buffers[view.buffer];
+        const tinygltf::BufferView& dstView = gltf.bufferViews[view.view];
+        const tinygltf::Buffer& dst = gltf.buffers[dstView.buffer];
+        const size_t decodedSize = view.count * view.byteStride;
+        if (view.byteOffset > src.data.size() ||
+            view.byteLength > src.data.size() - view.byteOffset ||
+            (view.byteStride && decodedSize / view.byteStride != view.count) ||
+            decodedSize > dstView.byteLength || dstView.byteOffset > dst.data.size() ||
+            decodedSize > dst.data.size() - dstView.byteOffset) {
+            TF_WARN("Buffer view %d has an invalid %s range", view.view, MESHOPT_EXTENSION);
+            return false;
+        }
+    }
+
+    // Views decode into distinct ranges of the fallback buffers, independently of each other
+    std::atomic<bool> success{ true };
+    WorkParallelForN(meshopt.views.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const MeshoptBufferView& view = meshopt.views[i];
+            const tinygltf::BufferView& dstView = gltf.bufferViews[view.view];
+            uint8_t* dst = gltf.buffers[dstView.buffer].data.data() + dstView.byteOffset;
+            const uint8_t* src = gltf.buffers[view.buffer].data.data() + view.byteOffset;
+            if (!decodeMeshoptBufferView(dst,
+                                         view.count,
+                                         view.byteStride,
+                                         view.mode,
+                                         view.filter,
+                                         src,
+                                         view.byteLength)) {
+                TF_WARN("Failed to decode buffer view %d with %s", view.view, MESHOPT_EXTENSION);
+                success = false;
+            }
+        }
+    });
+    return success;
+}
+
+}
+
 bool
 readGltfFromMemory(tinygltf::Model& gltf,
                    const std::string& baseDir,
@@ -192,6 +539,16 @@ readGltfFromMemory(tinygltf::Model& gltf,
         return false;
     }
 
+    std::vector<char> meshoptInput;
+    MeshoptBuffers meshopt;
+    if (!prepareMeshoptBuffers(isAscii, buffer, bufferSize, meshoptInput, meshopt)) {
+        return false;
+    }
+    if (!meshoptInput.empty()) {
+        buffer = meshoptInput.data();
+        bufferSize = meshoptInput.size();
+    }
+
     tinygltf::TinyGLTF loader;
     loader.SetImageLoader(CustomLoadImageData, nullptr);
 
@@ -215,10 +572,193 @@ readGltfFromMemory(tinygltf::Model& gltf,
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Failed to read glTF\n");
         return false;
     }
+    if (!meshopt.fallbackBuffers.empty() && !decodeMeshoptBuffers(gltf, meshopt)) {
+        return false;
+    }
+#ifdef USD_FILEFORMATS_ENABLE_DRACO
+    decodeDracoPrimitives(gltf);
+#endif
 
     return true;
 }
 
+bool
+readGltfImagesFromMemory(tinygltf::Model& gltf,
+                         const std::string& baseDir,
+                         bool isAscii,
+                         const char* buffer,
+                         size_t bufferSize)
+{
+    const char* json = buffer;
+    size_t jsonSize = bufferSize;
+    const char* bin = nullptr;
+    size_t binSize = 0;
+    if (!isAscii && !locateGlbChunks(buffer, bufferSize, json, jsonSize, bin, binSize)) {
+        TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Image-only read: invalid GLB chunks\n");
+        return false;
+    }
+
+    std::string reducedJson;
+    std::vector<uint8_t> imageBytes;
+    try {
+        nlohmann::json doc = nlohmann::json::parse(json, json + jsonSize);
+        if (!doc.is_object()) {
+            return false;
+        }
+        nlohmann::json reduced = nlohmann::json::object();
+        for (const char* property : imageOnlyProperties) {
+            if (auto it = doc.find(property); it != doc.end()) {
+                reduced[property] = *it;
+            }
+        }
+
+        // Gather the buffer views referenced by images into a single buffer holding only image
+        // bytes, and point the images at the re-packed views
+        nlohmann::json bufferViews = nlohmann::json::array();
+        std::unordered_map<int, int> bufferViewRemap;
+        std::unordered_map<int, std::string> decodedBuffers;
+        if (auto images = reduced.find("images"); images != reduced.end() && images->is_array()) {
+            for (nlohmann::json& image : *images) {
+                auto viewIt = image.find("bufferView");
+                if (viewIt == image.end()) {
+                    continue;
+                }
+                const int viewIndex = viewIt->get<int>();
+                auto [remapIt, inserted] =
+                  bufferViewRemap.insert({ viewIndex, static_cast<int>(bufferViews.size()) });
+                if (inserted) {
+                    imageBytes.resize(alignTo4(imageBytes.size()));
+                    const size_t byteOffset = imageBytes.size();
+                    if (!appendBufferViewBytes(
+                          doc, viewIndex, baseDir, bin, binSize, decodedBuffers, imageBytes)) {
+                        TF_DEBUG_MSG(FILE_FORMAT_GLTF,
+                                     "Image-only read: can't read buffer view %d\n",
+                                     viewIndex);
+                        return false;
+                    }
+                    nlohmann::json bufferView = nlohmann::json::object();
+                    bufferView["buffer"] = 0;
+                    bufferView["byteOffset"] = byteOffset;
+                    bufferView["byteLength"] = imageBytes.size() - byteOffset;
+                    bufferViews.push_back(std::move(bufferView));
+                }
+                *viewIt = remapIt->second;
+            }
+        }
+        if (!bufferViews.empty()) {
+            nlohmann::json imageBuffer = nlohmann::json::object();
+            imageBuffer["byteLength"] = imageBytes.size();
+            reduced["buffers"] = nlohmann::json::array();
+            reduced["buffers"].push_back(std::move(imageBuffer));
+            reduced["bufferViews"] = std::move(bufferViews);
+        }
+        reducedJson = reduced.dump();
+    } catch (const std::exception& e) {
+        TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Image-only read: invalid JSON: %s\n", e.what());
+        return false;
+    }
+
+    if (imageBytes.empty()) {
+        return readGltfFromMemory(gltf, baseDir, true, reducedJson.data(), reducedJson.size());
+    }
+
+    // Re-pack the reduced JSON and the image bytes as a GLB, so tinygltf resolves the embedded
+    // images the same way it does for a full read
+    std::vector<char> glb;
+    if (!packGlb(reducedJson,
+                 reinterpret_cast<const char*>(imageBytes.data()),
+                 imageBytes.size(),
+                 glb)) {
+        return false;
+    }
+    return readGltfFromMemory(gltf, baseDir, false, glb.data(), glb.size());
+}
+
+bool
+readGltfMetadataFromMemory(tinygltf::Model& gltf,
+                           const std::string& baseDir,
+                           bool isAscii,
+                           const char* buffer,
+                           size_t bufferSize)
+{
+    const char* json = buffer;
+    size_t jsonSize = bufferSize;
+    const char* bin = nullptr;
+    size_t binSize = 0;
+    if (!isAscii && !locateGlbChunks(buffer, bufferSize, json, jsonSize, bin, binSize)) {
+        TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Metadata-only read: invalid GLB chunks\n");
+        return false;
+    }
+
+    std::string reducedJson;
+    std::vector<std::string> bufferUris;
+    std::vector<std::string> imageUris;
+    try {
+        nlohmann::json doc = nlohmann::json::parse(json, json + jsonSize);
+        if (!doc.is_object()) {
+            return false;
+        }
+        nlohmann::json reduced = nlohmann::json::object();
+        for (const char* property : metadataOnlyProperties) {
+            if (auto it = doc.find(property); it != doc.end()) {
+                reduced[property] = *it;
+            }
+        }
+        // Accessors are kept for their min/max bounds only, detach them from any buffer data
+        if (auto accessors = reduced.find("accessors");
+            accessors != reduced.end() && accessors->is_array()) {
+            for (nlohmann::json& accessor : *accessors) {
+                if (accessor.is_object()) {
+                    accessor.erase("bufferView");
+                    accessor.erase("byteOffset");
+                    accessor.erase("sparse");
+                }
+            }
+        }
+        // External buffers are not loaded, but their uris still feed the layer's filenames
+        if (auto buffers = doc.find("buffers"); buffers != doc.end() && buffers->is_array()) {
+            for (const nlohmann::json& gltfBuffer : *buffers) {
+                std::string uri = gltfBuffer.is_object() ? gltfBuffer.value("uri", std::string())
+                                                         : std::string();
+                if (uri.compare(0, 5, "data:") == 0) {
+                    uri.clear();
+                }
+                bufferUris.push_back(std::move(uri));
+            }
+        }
+        // Images are not loaded either, but the full read adds the uris of the external ones to
+        // the filenames when it imports the materials
+        if (auto images = doc.find("images"); images != doc.end() && images->is_array()) {
+            for (const nlohmann::json& gltfImage : *images) {
+                if (!gltfImage.is_object() || gltfImage.contains("bufferView")) {
+                    continue;
+                }
+                std::string uri = gltfImage.value("uri", std::string());
+                if (!uri.empty() && uri.compare(0, 5, "data:") != 0) {
+                    imageUris.push_back(std::move(uri));
+                }
+            }
+        }
+        reducedJson = reduced.dump();
+    } catch (const std::exception& e) {
+        TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Metadata-only read: invalid JSON: %s\n", e.what());
+        return false;
+    }
+
+    if (!readGltfFromMemory(gltf, baseDir, true, reducedJson.data(), reducedJson.size())) {
+        return false;
+    }
+    for (std::string& uri : bufferUris) {
+        gltf.buffers.emplace_back();
+        gltf.buffers.back().uri = std::move(uri);
+    }
+    for (std::string& uri : imageUris) {
+        gltf.images.emplace_back();
+        gltf.images.back().uri = std::move(uri);
+    }
+    return true;
+}
+
 bool
 writeGltf(const WriteGltfOptions& options, tinygltf::Model& gltf, const std::string& filename)
 {
@@ -638,6 +1178,47 @@ normalizedFloat<float>(float value)
     return value;
 }
 
+// Converts integer components to floats, as stored by KHR_mesh_quantization. Normalized values are
+// scaled to [0.0f, 1.0f], or to [-1.0f, 1.0f] for signed types where the lowest value is clamped
+// to -1.0f as the glTF spec requires. The divisor and the clamp are the same for all components, so
+// the loops have no per-component branch and tightly packed data is converted in a single pass.
+template<typename T>
+void
+dequantize(const uint8_t* src,
+           size_t elementStride,
+           size_t elementCount,
+           size_t componentCount,
+           bool normalized,
+           float* dst)
+{
+    // A division rather than a multiplication by the reciprocal, which is off by one ulp for some
+    // values
+    const float divisor = normalized ? static_cast<float>(std::numeric_limits<T>::max()) : 1.0f;
+    const float lowest = normalized && std::is_signed_v<T>
+                           ? -1.0f
+                           : static_cast<float>(std::numeric_limits<T>::lowest());
+    auto convert = [&](const uint8_t* p) {
+        T value;
+        memcpy(&value, p, sizeof(T));
+        return std::max(static_cast<float>(value) / divisor, lowest);
+    };
+    const size_t elementSize = componentCount * sizeof(T);
+    if (elementStride == elementSize) {
+        const size_t valueCount = elementCount * componentCount;
+        for (size_t i = 0; i < valueCount; i++) {
+            dst[i] = convert(src + i * sizeof(T));
+        }
+    } else {
+        for (size_t i = 0; i < elementCount; i++) {
+            for (size_t j = 0; j < componentCount; j++) {
+                dst[j] = convert(src + j * sizeof(T));
+            }
+            src += elementStride;
+            dst += componentCount;
+        }
+    }
+}
+
 // This function copies/converts a buffer of an accessor component type to a buffer of floats.
 // dstFloatCount is the number of floats the destination buffer can hold; it is validated against
 // the element count and component count declared by the file before any write, so a caller that
@@ -745,85 +1326,13 @@ readAccessorDataToFloat(const tinygltf::Model& model,
             }
         }
     } else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_BYTE) {
-        if (normalized) {
-            for (size_t i = 0; i < elementCount; i++) {
-                int8_t* p = (int8_t*)src;
-                for (size_t j = 0; j < componentCount; j++) {
-                    dst[j] = normalizedFloat(p[j]);
-                }
-                src += elementStride;
-                dst += componentCount;
-            }
-        } else {
-            for (size_t i = 0; i < elementCount; i++) {
-                int8_t* p = (int8_t*)src;
-                for (size_t j = 0; j < componentCount; j++) {
-                    dst[j] = p[j];
-                }
-                src += elementStride;
-                dst += componentCount;
-            }
-        }
+        dequantize<int8_t>(src, elementStride, elementCount, componentCount, normalized, dst);
     } else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
-        if (normalized) {
-            for (size_t i = 0; i < elementCount; i++) {
-                uint8_t* p = (uint8_t*)src;
-                for (size_t j = 0; j < componentCount; j++) {
-                    dst[j] = normalizedFloat(p[j]);
-                }
-                src += elementStride;
-                dst += componentCount;
-            }
-        } else {
-            for (size_t i = 0; i < elementCount; i++) {
-                uint8_t* p = (uint8_t*)src;
-                for (size_t j = 0; j < componentCount; j++) {
-                    dst[j] = p[j];
-                }
-                src += elementStride;
-                dst += componentCount;
-            }
-        }
+        dequantize<uint8_t>(src, elementStride, elementCount, componentCount, normalized, dst);
     } else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_SHORT) {
-        if (normalized) {
-            for (size_t i = 0; i < elementCount; i++) {
-                int16_t* p = (int16_t*)src;
-                for (size_t j = 0; j < componentCount; j++) {
-                    dst[j] = normalizedFloat(p[j]);
-                }
-                src += elementStride;
-                dst += componentCount;
-            }
-        } else {
-            for (size_t i = 0; i < elementCount; i++) {
-                int16_t* p = (int16_t*)src;
-                for (size_t j = 0; j < componentCount; j++) {
-                    dst[j] = p[j];
-                }
-                src += elementStride;
-                dst += componentCount;
-            }
-        }
+        dequantize<int16_t>(src, elementStride, elementCount, componentCount, normalized, dst);
     } else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-        if (normalized) {
-            for (size_t i = 0; i < elementCount; i++) {
-                uint16_t* p = (uint16_t*)src;
-                for (size_t j = 0; j < componentCount; j++) {
-                    dst[j] = normalizedFloat(p[j]);
-                }
-                src += elementStride;
-                dst += componentCount;
-            }
-        } else {
-            for (size_t i = 0; i < elementCount; i++) {
-                uint16_t* p = (uint16_t*)src;
-                for (size_t j = 0; j < componentCount; j++) {
-                    dst[j] = p[j];
-                }
-                src += elementStride;
-                dst += componentCount;
-            }
-        }
+        dequantize<uint16_t>(src, elementStride, elementCount, componentCount, normalized, dst);
     } else {
         TF_WARN("Unsigned Int and Double component types are not supported when converting to "
                 "float arrays");
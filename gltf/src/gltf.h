@@ -43,6 +43,27 @@ readGltfFromMemory(tinygltf::Model& gltf,
                    bool isAscii,
                    const char* buffer,
                    size_t bufferSize);
+/// Reads only the parts of a glTF needed to import its materials and images: the JSON properties
+/// describing materials, textures, images and samplers, and the buffer views referenced by images.
+/// The binary chunk of a GLB is read in place and external buffers only over the image ranges, so
+/// the cost is proportional to the image bytes rather than the size of the scene.
+bool
+readGltfImagesFromMemory(tinygltf::Model& gltf,
+                         const std::string& baseDir,
+                         bool isAscii,
+                         const char* buffer,
+                         size_t bufferSize);
+
+/// Reads only the parts of a glTF needed to import the layer metadata: the asset description, the
+/// animations and the accessors they reference, without any buffer data. The returned buffers,
+/// and the images with an external uri, only carry their uris.
+bool
+readGltfMetadataFromMemory(tinygltf::Model& gltf,
+                           const std::string& baseDir,
+                           bool isAscii,
+                           const char* buffer,
+                           size_t bufferSize);
+
 bool
 writeGltf(const WriteGltfOptions& options, tinygltf::Model& gltf, const std::string& filename);
 
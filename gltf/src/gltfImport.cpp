@@ -21,10 +21,12 @@ governing permissions and limitations under the License.
 #include <fileformatutils/images.h>
 #include <fileformatutils/materials.h>
 #include <fileformatutils/neuralAssetsHelper.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/usdData.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
 
 #include <algorithm>
 #include <cmath>
@@ -593,7 +595,7 @@ importImage(ImportGltfContext& ctx,
           FILE_FORMAT_GLTF, "Could not read image with extension %s\n", uriExtension.c_str());
         return -1;
     }
-    // make a copy of the image data
+    // make a copy of the image data, which is then shared by every user of the ImageAsset
     usdImage.image = image.image;
     // Cache the new USD image index
     it->second = usdImageIndex;
@@ -2673,328 +2675,344 @@ validateAttributeAccessorType(const tinygltf::Model& model,
     return true;
 }
 
-void
-importMeshes(ImportGltfContext& ctx)
+// Decodes one glTF primitive into the already allocated mesh at meshIndex. This only reads the
+// glTF model and writes to its own mesh, so primitives can be imported concurrently.
+static void
+importPrimitive(ImportGltfContext& ctx, const tinygltf::Mesh& gmesh, size_t j, int meshIndex)
 {
-    ctx.meshes.resize(ctx.gltf->meshes.size());
-    ctx.meshUseCount.resize(ctx.gltf->meshes.size(), 0);
-    for (size_t i = 0; i < ctx.gltf->meshes.size(); i++) {
-        const tinygltf::Mesh& gmesh = ctx.gltf->meshes[i];
-        ctx.meshes[i].resize(gmesh.primitives.size());
-        for (size_t j = 0; j < gmesh.primitives.size(); j++) {
+    // TODO: Combine primitives into a single large mesh if possible. When different
+    // primitives have different materials, use a mesh subset to store this information.
+    // Be aware of properly combining UV subsets
 
-            // TODO: Combine primitives into a single large mesh if possible. When different
-            // primitives have different materials, use a mesh subset to store this information.
-            // Be aware of properly combining UV subsets
+    const tinygltf::Primitive& primitive = gmesh.primitives[j];
 
-            const tinygltf::Primitive& primitive = gmesh.primitives[j];
+    // Get accessor indices before loading the mesh data (for early validation)
+    int positionsIndex = getPrimitiveAttribute(primitive, "POSITION");
+    int normalsIndex = getPrimitiveAttribute(primitive, "NORMAL");
+    int tangentsIndex = getPrimitiveAttribute(primitive, "TANGENT");
+    int uvsIndex = getPrimitiveAttribute(primitive, "TEXCOORD_0");
+    int indicesIndex = primitive.indices;
 
-            // Get accessor indices before adding mesh (for early validation)
-            int positionsIndex = getPrimitiveAttribute(primitive, "POSITION");
-            int normalsIndex = getPrimitiveAttribute(primitive, "NORMAL");
-            int tangentsIndex = getPrimitiveAttribute(primitive, "TANGENT");
-            int uvsIndex = getPrimitiveAttribute(primitive, "TEXCOORD_0");
-            int indicesIndex = primitive.indices;
+    // Get vertex count for validation
+    size_t vertexCount = getAccessorElementCount(*ctx.gltf, positionsIndex);
 
-            // Get vertex count for validation
-            size_t vertexCount = getAccessorElementCount(*ctx.gltf, positionsIndex);
+    // Pre-validate indices before loading mesh data
+    bool skipLoadingData = false;
 
-            // Pre-validate indices before loading mesh data
-            bool skipLoadingData = false;
+    // POSITION must be VEC3; its accessor sizes mesh.points and is read as float. A
+    // mismatched accessor.type would overflow the destination, so skip the whole mesh.
+    if (positionsIndex >= 0 &&
+        !validateAttributeAccessorType(
+          *ctx.gltf, positionsIndex, TINYGLTF_TYPE_VEC3, "POSITION", gmesh.name)) {
+        skipLoadingData = true;
+    }
 
-            // POSITION must be VEC3; its accessor sizes mesh.points and is read as float. A
-            // mismatched accessor.type would overflow the destination, so skip the whole mesh.
-            if (positionsIndex >= 0 &&
-                !validateAttributeAccessorType(
-                  *ctx.gltf, positionsIndex, TINYGLTF_TYPE_VEC3, "POSITION", gmesh.name)) {
+    if (indicesIndex >= 0) {
+        PXR_NS::VtArray<int> tempIndices;
+        getIndices(*ctx.gltf, indicesIndex, vertexCount, tempIndices);
+
+        if (!tempIndices.empty() && vertexCount > 0) {
+            int maxIndex = *std::max_element(tempIndices.begin(), tempIndices.end());
+            if (maxIndex >= static_cast<int>(vertexCount)) {
+                TF_WARN("Mesh '%s' primitive %zu has indices (max %d) exceeding vertex "
+                        "count (%zu). Creating empty mesh to prevent crash.",
+                        gmesh.name.c_str(),
+                        j,
+                        maxIndex,
+                        vertexCount);
                 skipLoadingData = true;
             }
+        }
+    }
 
-            if (indicesIndex >= 0) {
-                PXR_NS::VtArray<int> tempIndices;
-                getIndices(*ctx.gltf, indicesIndex, vertexCount, tempIndices);
-
-                if (!tempIndices.empty() && vertexCount > 0) {
-                    int maxIndex = *std::max_element(tempIndices.begin(), tempIndices.end());
-                    if (maxIndex >= static_cast<int>(vertexCount)) {
-                        TF_WARN("Mesh '%s' primitive %zu has indices (max %d) exceeding vertex "
-                                "count (%zu). Creating empty mesh to prevent crash.",
-                                gmesh.name.c_str(),
-                                j,
-                                maxIndex,
-                                vertexCount);
-                        skipLoadingData = true;
-                    }
+    // Skip loading data if validation failed - leave mesh empty
+    if (skipLoadingData) {
+        return;
+    }
+    Mesh& mesh = ctx.usd->meshes[meshIndex];
+    mesh.displayName = gmesh.name;
+    // When we have multiple GLTF primitives that we turn into meshes, we create names that
+    // are derived from the primitive index instead of just duplicating the name.
+    if (gmesh.primitives.size() > 1) {
+        mesh.displayName = mesh.displayName + "_primitive" + std::to_string(j);
+    }
+
+    // POSITION is required in GLTF (accessor type validated as VEC3 above)
+    mesh.points =
+      PXR_NS::VtArray<PXR_NS::GfVec3f>(getAccessorElementCount(*ctx.gltf, positionsIndex));
+    readAccessorDataToFloat(*ctx.gltf,
+                            positionsIndex,
+                            reinterpret_cast<float*>(mesh.points.data()),
+                            mesh.points.size() * 3);
+
+    // NORMAL is optional - only read if present
+    if (normalsIndex >= 0 &&
+        validateAttributeAccessorType(
+          *ctx.gltf, normalsIndex, TINYGLTF_TYPE_VEC3, "NORMAL", mesh.displayName)) {
+        mesh.normals.values = PXR_NS::VtArray<PXR_NS::GfVec3f>(
+          getAccessorElementCount(*ctx.gltf, normalsIndex));
+        readAccessorDataToFloat(*ctx.gltf,
+                                normalsIndex,
+                                reinterpret_cast<float*>(mesh.normals.values.data()),
+                                mesh.normals.values.size() * 3);
+        mesh.normals.interpolation = UsdGeomTokens->vertex;
+    }
+
+    // TANGENT is optional - only read if present
+    if (tangentsIndex >= 0 &&
+        validateAttributeAccessorType(
+          *ctx.gltf, tangentsIndex, TINYGLTF_TYPE_VEC4, "TANGENT", mesh.displayName)) {
+        mesh.tangents.values = PXR_NS::VtArray<PXR_NS::GfVec4f>(
+          getAccessorElementCount(*ctx.gltf, tangentsIndex));
+        readAccessorDataToFloat(*ctx.gltf,
+                                tangentsIndex,
+                                reinterpret_cast<float*>(mesh.tangents.values.data()),
+                                mesh.tangents.values.size() * 4);
+        mesh.tangents.interpolation = UsdGeomTokens->vertex;
+
+        // GLTF tangent format: (x, y, z, w) where w is handedness (+1 or -1)
+        // Binormal = cross(normal, tangent.xyz) * tangent.w
+        // Only compute bitangents if explicitly requested
+        if (ctx.options->computeBitangents &&
+            mesh.normals.values.size() == mesh.tangents.values.size()) {
+            mesh.bitangents.values.resize(mesh.tangents.values.size());
+            for (size_t k = 0; k < mesh.tangents.values.size(); k++) {
+                const PXR_NS::GfVec3f& normal = mesh.normals.values[k];
+                const PXR_NS::GfVec4f& tangent = mesh.tangents.values[k];
+                PXR_NS::GfVec3f tangentXYZ(tangent[0], tangent[1], tangent[2]);
+                float handedness = tangent[3];
+
+                if (std::abs(handedness) < 0.5f) {
+                    TF_WARN("Invalid handedness value %f in tangent data, assuming +1",
+                            handedness);
+                    handedness = 1.0f;
+                } else {
+                    handedness = handedness >= 0.0f ? 1.0f : -1.0f;
                 }
+
+                // Compute bitangent using cross product: normal × tangentXYZ
+                PXR_NS::GfVec3f crossProduct(
+                  normal[1] * tangentXYZ[2] -
+                    normal[2] * tangentXYZ[1], // x = ny*tz - nz*ty
+                  normal[2] * tangentXYZ[0] -
+                    normal[0] * tangentXYZ[2],                          // y = nz*tx - nx*tz
+                  normal[0] * tangentXYZ[1] - normal[1] * tangentXYZ[0] // z = nx*ty - ny*tx
+                );
+                mesh.bitangents.values[k] = crossProduct * handedness;
+            }
+            mesh.bitangents.interpolation = UsdGeomTokens->vertex;
+        } else if (ctx.options->computeBitangents && mesh.normals.values.size() > 0) {
+            TF_WARN(
+              "Tangent and normal vertex counts don't match (%zu tangents, %zu normals). "
+              "Skipping bitangent computation.",
+              mesh.tangents.values.size(),
+              mesh.normals.values.size());
+        }
+    }
+
+    // TEXCOORD_0 is optional - only read if present
+    if (uvsIndex >= 0 &&
+        validateAttributeAccessorType(
+          *ctx.gltf, uvsIndex, TINYGLTF_TYPE_VEC2, "TEXCOORD_0", mesh.displayName)) {
+        mesh.uvs.values =
+          PXR_NS::VtArray<PXR_NS::GfVec2f>(getAccessorElementCount(*ctx.gltf, uvsIndex));
+        readAccessorDataToFloat(*ctx.gltf,
+                                uvsIndex,
+                                reinterpret_cast<float*>(mesh.uvs.values.data()),
+                                mesh.uvs.values.size() * 2);
+
+        // Validate UV coordinates - clean out NaN/Inf values
+        size_t invalidCount = 0;
+        for (auto& uv : mesh.uvs.values) {
+            bool invalid = std::isnan(uv[0]) || std::isinf(uv[0]) || std::isnan(uv[1]) ||
+                           std::isinf(uv[1]);
+            if (invalid) {
+                uv[0] = 0.0f;
+                uv[1] = 0.0f;
+                invalidCount++;
             }
+        }
+        if (invalidCount > 0) {
+            TF_WARN("Mesh '%s' has %zu invalid UV coordinates (NaN/Inf). "
+                    "These have been reset to (0,0) to prevent rendering issues.",
+                    mesh.displayName.c_str(),
+                    invalidCount);
+        }
 
-            // Always add mesh (even if invalid) to maintain index consistency
-            // If invalid, we'll leave it empty
-            auto [meshIndex, mesh] = ctx.usd->addMesh();
-            ctx.meshes[i][j] = meshIndex;
+        // Flip V coordinates for glTF files to match USD convention
+        for (auto& uv : mesh.uvs.values) {
+            uv[1] = 1.0f - uv[1];
+        }
+        mesh.uvs.interpolation = UsdGeomTokens->vertex;
+    }
 
-            // Skip loading data if validation failed - leave mesh empty
-            if (skipLoadingData) {
-                continue;
+    // if there is one uv set, check for more
+    if (uvsIndex >= 0 && mesh.uvs.values.size()) {
+        // this is an infinite loop but will exit when TEXCOORD_n is not found
+        for (int n = 1; true; n++) {
+            int uvsIndex =
+              getPrimitiveAttribute(primitive, "TEXCOORD_" + std::to_string(n));
+            if (uvsIndex < 0)
+                break;
+
+            // Stop reading additional UV sets on a type mismatch; continuing would
+            // misalign extraUVSets indices and an invalid accessor.type would overflow.
+            if (!validateAttributeAccessorType(*ctx.gltf,
+                                               uvsIndex,
+                                               TINYGLTF_TYPE_VEC2,
+                                               ("TEXCOORD_" + std::to_string(n)).c_str(),
+                                               mesh.displayName))
+                break;
+
+            // add a new primvar for the additional UV set
+            mesh.extraUVSets.push_back(Primvar<PXR_NS::GfVec2f>());
+            Primvar<PXR_NS::GfVec2f>& uvs = mesh.extraUVSets[n - 1];
+            uvs.values = PXR_NS::VtArray<PXR_NS::GfVec2f>(
+              getAccessorElementCount(*ctx.gltf, uvsIndex));
+            readAccessorDataToFloat(*ctx.gltf,
+                                    uvsIndex,
+                                    reinterpret_cast<float*>(uvs.values.data()),
+                                    uvs.values.size() * 2);
+
+            // Validate UV coordinates for extra UV sets - clean out NaN/Inf values
+            size_t invalidCount = 0;
+            for (auto& uv : uvs.values) {
+                bool invalid = std::isnan(uv[0]) || std::isinf(uv[0]) ||
+                               std::isnan(uv[1]) || std::isinf(uv[1]);
+                if (invalid) {
+                    uv[0] = 0.0f;
+                    uv[1] = 0.0f;
+                    invalidCount++;
+                }
             }
-            mesh.displayName = gmesh.name;
-            // When we have multiple GLTF primitives that we turn into meshes, we create names that
-            // are derived from the primitive index instead of just duplicating the name.
-            if (gmesh.primitives.size() > 1) {
-                mesh.displayName = mesh.displayName + "_primitive" + std::to_string(j);
+            if (invalidCount > 0) {
+                TF_WARN("Mesh '%s' TEXCOORD_%d has %zu invalid UV coordinates (NaN/Inf). "
+                        "These have been reset to (0,0).",
+                        mesh.displayName.c_str(),
+                        n,
+                        invalidCount);
             }
 
-            // POSITION is required in GLTF (accessor type validated as VEC3 above)
-            mesh.points =
-              PXR_NS::VtArray<PXR_NS::GfVec3f>(getAccessorElementCount(*ctx.gltf, positionsIndex));
-            readAccessorDataToFloat(*ctx.gltf,
-                                    positionsIndex,
-                                    reinterpret_cast<float*>(mesh.points.data()),
-                                    mesh.points.size() * 3);
-
-            // NORMAL is optional - only read if present
-            if (normalsIndex >= 0 &&
-                validateAttributeAccessorType(
-                  *ctx.gltf, normalsIndex, TINYGLTF_TYPE_VEC3, "NORMAL", mesh.displayName)) {
-                mesh.normals.values = PXR_NS::VtArray<PXR_NS::GfVec3f>(
-                  getAccessorElementCount(*ctx.gltf, normalsIndex));
-                readAccessorDataToFloat(*ctx.gltf,
-                                        normalsIndex,
-                                        reinterpret_cast<float*>(mesh.normals.values.data()),
-                                        mesh.normals.values.size() * 3);
-                mesh.normals.interpolation = UsdGeomTokens->vertex;
+            // Flip V coordinates for additional UV sets as well
+            for (auto& uv : uvs.values) {
+                uv[1] = 1.0f - uv[1];
             }
+            uvs.interpolation = UsdGeomTokens->vertex;
+        }
+    }
 
-            // TANGENT is optional - only read if present
-            if (tangentsIndex >= 0 &&
-                validateAttributeAccessorType(
-                  *ctx.gltf, tangentsIndex, TINYGLTF_TYPE_VEC4, "TANGENT", mesh.displayName)) {
-                mesh.tangents.values = PXR_NS::VtArray<PXR_NS::GfVec4f>(
-                  getAccessorElementCount(*ctx.gltf, tangentsIndex));
-                readAccessorDataToFloat(*ctx.gltf,
-                                        tangentsIndex,
-                                        reinterpret_cast<float*>(mesh.tangents.values.data()),
-                                        mesh.tangents.values.size() * 4);
-                mesh.tangents.interpolation = UsdGeomTokens->vertex;
-
-                // GLTF tangent format: (x, y, z, w) where w is handedness (+1 or -1)
-                // Binormal = cross(normal, tangent.xyz) * tangent.w
-                // Only compute bitangents if explicitly requested
-                if (ctx.options->computeBitangents &&
-                    mesh.normals.values.size() == mesh.tangents.values.size()) {
-                    mesh.bitangents.values.resize(mesh.tangents.values.size());
-                    for (size_t k = 0; k < mesh.tangents.values.size(); k++) {
-                        const PXR_NS::GfVec3f& normal = mesh.normals.values[k];
-                        const PXR_NS::GfVec4f& tangent = mesh.tangents.values[k];
-                        PXR_NS::GfVec3f tangentXYZ(tangent[0], tangent[1], tangent[2]);
-                        float handedness = tangent[3];
-
-                        if (std::abs(handedness) < 0.5f) {
-                            TF_WARN("Invalid handedness value %f in tangent data, assuming +1",
-                                    handedness);
-                            handedness = 1.0f;
-                        } else {
-                            handedness = handedness >= 0.0f ? 1.0f : -1.0f;
-                        }
+    switch (primitive.mode) {
+        case TINYGLTF_MODE_TRIANGLES:
+            getIndices(*ctx.gltf, indicesIndex, mesh.points.size(), mesh.indices);
 
-                        // Compute bitangent using cross product: normal × tangentXYZ
-                        PXR_NS::GfVec3f crossProduct(
-                          normal[1] * tangentXYZ[2] -
-                            normal[2] * tangentXYZ[1], // x = ny*tz - nz*ty
-                          normal[2] * tangentXYZ[0] -
-                            normal[0] * tangentXYZ[2],                          // y = nz*tx - nx*tz
-                          normal[0] * tangentXYZ[1] - normal[1] * tangentXYZ[0] // z = nx*ty - ny*tx
-                        );
-                        mesh.bitangents.values[k] = crossProduct * handedness;
-                    }
-                    mesh.bitangents.interpolation = UsdGeomTokens->vertex;
-                } else if (ctx.options->computeBitangents && mesh.normals.values.size() > 0) {
-                    TF_WARN(
-                      "Tangent and normal vertex counts don't match (%zu tangents, %zu normals). "
-                      "Skipping bitangent computation.",
-                      mesh.tangents.values.size(),
-                      mesh.normals.values.size());
-                }
+            if (mesh.indices.size() < 3) {
+                TF_WARN("GLTF TRIANGLE primitive has fewer than 3 indices\n");
+            }
+            if (mesh.indices.size() % 3 != 0) {
+                TF_WARN("GLTF TRIANGLE primitive has a number of indices not divisible "
+                        "by 3\n");
             }
 
-            // TEXCOORD_0 is optional - only read if present
-            if (uvsIndex >= 0 &&
-                validateAttributeAccessorType(
-                  *ctx.gltf, uvsIndex, TINYGLTF_TYPE_VEC2, "TEXCOORD_0", mesh.displayName)) {
-                mesh.uvs.values =
-                  PXR_NS::VtArray<PXR_NS::GfVec2f>(getAccessorElementCount(*ctx.gltf, uvsIndex));
-                readAccessorDataToFloat(*ctx.gltf,
-                                        uvsIndex,
-                                        reinterpret_cast<float*>(mesh.uvs.values.data()),
-                                        mesh.uvs.values.size() * 2);
-
-                // Validate UV coordinates - clean out NaN/Inf values
-                size_t invalidCount = 0;
-                for (auto& uv : mesh.uvs.values) {
-                    bool invalid = std::isnan(uv[0]) || std::isinf(uv[0]) || std::isnan(uv[1]) ||
-                                   std::isinf(uv[1]);
-                    if (invalid) {
-                        uv[0] = 0.0f;
-                        uv[1] = 0.0f;
-                        invalidCount++;
-                    }
-                }
-                if (invalidCount > 0) {
-                    TF_WARN("Mesh '%s' has %zu invalid UV coordinates (NaN/Inf). "
-                            "These have been reset to (0,0) to prevent rendering issues.",
-                            mesh.displayName.c_str(),
-                            invalidCount);
-                }
+            break;
+        case TINYGLTF_MODE_TRIANGLE_STRIP: {
+            PXR_NS::VtArray<int> stripIndices;
+            getIndices(*ctx.gltf, indicesIndex, mesh.points.size(), stripIndices);
 
-                // Flip V coordinates for glTF files to match USD convention
-                for (auto& uv : mesh.uvs.values) {
-                    uv[1] = 1.0f - uv[1];
+            if (stripIndices.size() < 3) {
+                TF_WARN("GLTF TRIANGLE_STRIP primitive has fewer than 3 indices\n");
+            } else {
+                mesh.indices.resize(3 * (stripIndices.size() - 2));
+                for (size_t i = 0; i < stripIndices.size() - 2; i++) {
+                    mesh.indices[3 * i] = stripIndices[i];
+                    mesh.indices[3 * i + 1] = stripIndices[i + 1 + (i % 2)];
+                    mesh.indices[3 * i + 2] = stripIndices[i + 2 - (i % 2)];
                 }
-                mesh.uvs.interpolation = UsdGeomTokens->vertex;
             }
 
-            // if there is one uv set, check for more
-            if (uvsIndex >= 0 && mesh.uvs.values.size()) {
-                // this is an infinite loop but will exit when TEXCOORD_n is not found
-                for (int n = 1; true; n++) {
-                    int uvsIndex =
-                      getPrimitiveAttribute(primitive, "TEXCOORD_" + std::to_string(n));
-                    if (uvsIndex < 0)
-                        break;
-
-                    // Stop reading additional UV sets on a type mismatch; continuing would
-                    // misalign extraUVSets indices and an invalid accessor.type would overflow.
-                    if (!validateAttributeAccessorType(*ctx.gltf,
-                                                       uvsIndex,
-                                                       TINYGLTF_TYPE_VEC2,
-                                                       ("TEXCOORD_" + std::to_string(n)).c_str(),
-                                                       mesh.displayName))
-                        break;
-
-                    // add a new primvar for the additional UV set
-                    mesh.extraUVSets.push_back(Primvar<PXR_NS::GfVec2f>());
-                    Primvar<PXR_NS::GfVec2f>& uvs = mesh.extraUVSets[n - 1];
-                    uvs.values = PXR_NS::VtArray<PXR_NS::GfVec2f>(
-                      getAccessorElementCount(*ctx.gltf, uvsIndex));
-                    readAccessorDataToFloat(*ctx.gltf,
-                                            uvsIndex,
-                                            reinterpret_cast<float*>(uvs.values.data()),
-                                            uvs.values.size() * 2);
-
-                    // Validate UV coordinates for extra UV sets - clean out NaN/Inf values
-                    size_t invalidCount = 0;
-                    for (auto& uv : uvs.values) {
-                        bool invalid = std::isnan(uv[0]) || std::isinf(uv[0]) ||
-                                       std::isnan(uv[1]) || std::isinf(uv[1]);
-                        if (invalid) {
-                            uv[0] = 0.0f;
-                            uv[1] = 0.0f;
-                            invalidCount++;
-                        }
-                    }
-                    if (invalidCount > 0) {
-                        TF_WARN("Mesh '%s' TEXCOORD_%d has %zu invalid UV coordinates (NaN/Inf). "
-                                "These have been reset to (0,0).",
-                                mesh.displayName.c_str(),
-                                n,
-                                invalidCount);
-                    }
+            break;
+        }
+        case TINYGLTF_MODE_TRIANGLE_FAN: {
+            PXR_NS::VtArray<int> fanIndices;
+            getIndices(*ctx.gltf, indicesIndex, mesh.points.size(), fanIndices);
 
-                    // Flip V coordinates for additional UV sets as well
-                    for (auto& uv : uvs.values) {
-                        uv[1] = 1.0f - uv[1];
-                    }
-                    uvs.interpolation = UsdGeomTokens->vertex;
+            if (fanIndices.size() < 3) {
+                TF_WARN("GLTF TRIANGLE_FAN primitive has fewer than 3 indices\n");
+            } else {
+                mesh.indices.resize(3 * (fanIndices.size() - 2));
+                for (size_t i = 0; i < fanIndices.size() - 2; i++) {
+                    mesh.indices[3 * i] = fanIndices[i + 1];
+                    mesh.indices[3 * i + 1] = fanIndices[i + 2];
+                    mesh.indices[3 * i + 2] = fanIndices[0];
                 }
             }
 
-            switch (primitive.mode) {
-                case TINYGLTF_MODE_TRIANGLES:
-                    getIndices(*ctx.gltf, indicesIndex, mesh.points.size(), mesh.indices);
-
-                    if (mesh.indices.size() < 3) {
-                        TF_WARN("GLTF TRIANGLE primitive has fewer than 3 indices\n");
-                    }
-                    if (mesh.indices.size() % 3 != 0) {
-                        TF_WARN("GLTF TRIANGLE primitive has a number of indices not divisible "
-                                "by 3\n");
-                    }
-
-                    break;
-                case TINYGLTF_MODE_TRIANGLE_STRIP: {
-                    PXR_NS::VtArray<int> stripIndices;
-                    getIndices(*ctx.gltf, indicesIndex, mesh.points.size(), stripIndices);
-
-                    if (stripIndices.size() < 3) {
-                        TF_WARN("GLTF TRIANGLE_STRIP primitive has fewer than 3 indices\n");
-                    } else {
-                        mesh.indices.resize(3 * (stripIndices.size() - 2));
-                        for (size_t i = 0; i < stripIndices.size() - 2; i++) {
-                            mesh.indices[3 * i] = stripIndices[i];
-                            mesh.indices[3 * i + 1] = stripIndices[i + 1 + (i % 2)];
-                            mesh.indices[3 * i + 2] = stripIndices[i + 2 - (i % 2)];
-                        }
-                    }
-
-                    break;
-                }
-                case TINYGLTF_MODE_TRIANGLE_FAN: {
-                    PXR_NS::VtArray<int> fanIndices;
-                    getIndices(*ctx.gltf, indicesIndex, mesh.points.size(), fanIndices);
+            break;
+        }
+        case TINYGLTF_MODE_POINTS:
+        case TINYGLTF_MODE_LINE:
+        case TINYGLTF_MODE_LINE_LOOP:
+        case TINYGLTF_MODE_LINE_STRIP:
+        default:
+            getIndices(*ctx.gltf, indicesIndex, mesh.points.size(), mesh.indices);
 
-                    if (fanIndices.size() < 3) {
-                        TF_WARN("GLTF TRIANGLE_FAN primitive has fewer than 3 indices\n");
-                    } else {
-                        mesh.indices.resize(3 * (fanIndices.size() - 2));
-                        for (size_t i = 0; i < fanIndices.size() - 2; i++) {
-                            mesh.indices[3 * i] = fanIndices[i + 1];
-                            mesh.indices[3 * i + 1] = fanIndices[i + 2];
-                            mesh.indices[3 * i + 2] = fanIndices[0];
-                        }
-                    }
+            TF_WARN("Encountered GLTF primitive with unsupported mode %d\n",
+                    primitive.mode);
 
-                    break;
-                }
-                case TINYGLTF_MODE_POINTS:
-                case TINYGLTF_MODE_LINE:
-                case TINYGLTF_MODE_LINE_LOOP:
-                case TINYGLTF_MODE_LINE_STRIP:
-                default:
-                    getIndices(*ctx.gltf, indicesIndex, mesh.points.size(), mesh.indices);
+            break;
+    }
+    mesh.faces = PXR_NS::VtArray<int>(mesh.indices.size() / 3, 3);
 
-                    TF_WARN("Encountered GLTF primitive with unsupported mode %d\n",
-                            primitive.mode);
+    importMeshJointWeights(*ctx.gltf, primitive, mesh);
 
-                    break;
-            }
-            mesh.faces = PXR_NS::VtArray<int>(mesh.indices.size() / 3, 3);
+    VtVec3fArray color;
+    VtFloatArray opacity;
+    readColor(*ctx.gltf, primitive, color, opacity);
+    if (color.size()) {
+        auto [colorIndex, colorPV] = ctx.usd->addColorSet(meshIndex);
+        colorPV.values = color;
+        colorPV.interpolation = UsdGeomTokens->vertex;
+    }
+    if (opacity.size()) {
+        auto [opacityIndex, opacityPV] = ctx.usd->addOpacitySet(meshIndex);
+        opacityPV.values = opacity;
+        opacityPV.interpolation = UsdGeomTokens->vertex;
+    }
+    if (primitive.material >= 0) {
+        if (static_cast<int>(ctx.gltf->materials.size()) > primitive.material) {
+            mesh.material = primitive.material;
+            mesh.doubleSided = ctx.gltf->materials[primitive.material].doubleSided;
+        } else {
+            TF_WARN("Encountered GLTF primitive with an out of bounds material index %d\n",
+                    primitive.material);
+        }
+    }
+}
 
-            importMeshJointWeights(*ctx.gltf, primitive, mesh);
+void
+importMeshes(ImportGltfContext& ctx)
+{
+    ctx.meshes.resize(ctx.gltf->meshes.size());
+    ctx.meshUseCount.resize(ctx.gltf->meshes.size(), 0);
 
-            VtVec3fArray color;
-            VtFloatArray opacity;
-            readColor(*ctx.gltf, primitive, color, opacity);
-            if (color.size()) {
-                auto [colorIndex, colorPV] = ctx.usd->addColorSet(meshIndex);
-                colorPV.values = color;
-                colorPV.interpolation = UsdGeomTokens->vertex;
-            }
-            if (opacity.size()) {
-                auto [opacityIndex, opacityPV] = ctx.usd->addOpacitySet(meshIndex);
-                opacityPV.values = opacity;
-                opacityPV.interpolation = UsdGeomTokens->vertex;
-            }
-            if (primitive.material >= 0) {
-                if (static_cast<int>(ctx.gltf->materials.size()) > primitive.material) {
-                    mesh.material = primitive.material;
-                    mesh.doubleSided = ctx.gltf->materials[primitive.material].doubleSided;
-                } else {
-                    TF_WARN("Encountered GLTF primitive with an out of bounds material index %d\n",
-                            primitive.material);
-                }
-            }
+    // Add all meshes (even invalid ones, which are left empty) up front, in primitive order, so
+    // that the mesh indices are deterministic and the meshes array isn't resized while the
+    // primitives are decoded in parallel.
+    std::vector<std::pair<size_t, size_t>> primitives;
+    for (size_t i = 0; i < ctx.gltf->meshes.size(); i++) {
+        const tinygltf::Mesh& gmesh = ctx.gltf->meshes[i];
+        ctx.meshes[i].resize(gmesh.primitives.size());
+        for (size_t j = 0; j < gmesh.primitives.size(); j++) {
+            ctx.meshes[i][j] = ctx.usd->addMesh().first;
+            primitives.push_back({ i, j });
         }
     }
+
+    WorkParallelForN(primitives.size(), [&](size_t begin, size_t end) {
+        for (size_t k = begin; k < end; k++) {
+            const auto [i, j] = primitives[k];
+            importPrimitive(ctx, ctx.gltf->meshes[i], j, ctx.meshes[i][j]);
+        }
+    });
 }
 
 // Traverses the glTF nodes to construct names appropriate for UsdSkel API consumption
@@ -3369,6 +3387,41 @@ importAnimationTracks(ImportGltfContext& ctx)
     }
 }
 
+// Sets the time range of each animation track from the min/max bounds of the input accessors of
+// its transform channels, which glTF requires, without reading any keyframes
+void
+importAnimationTrackRanges(ImportGltfContext& ctx)
+{
+    importAnimationTracks(ctx);
+    for (size_t animationTrackIndex = 0; animationTrackIndex < ctx.usd->animationTracks.size();
+         animationTrackIndex++) {
+        const tinygltf::Animation& animation = ctx.gltf->animations[animationTrackIndex];
+        AnimationTrack& track = ctx.usd->animationTracks[animationTrackIndex];
+        for (const tinygltf::AnimationChannel& channel : animation.channels) {
+            if (channel.target_path != "translation" && channel.target_path != "rotation" &&
+                channel.target_path != "scale") {
+                continue;
+            }
+            if (channel.sampler < 0 ||
+                static_cast<size_t>(channel.sampler) >= animation.samplers.size()) {
+                continue;
+            }
+            const int input = animation.samplers[channel.sampler].input;
+            if (input < 0 || static_cast<size_t>(input) >= ctx.gltf->accessors.size()) {
+                continue;
+            }
+            const tinygltf::Accessor& inputAccessor = ctx.gltf->accessors[input];
+            if (inputAccessor.minValues.empty() || inputAccessor.maxValues.empty()) {
+                continue;
+            }
+            track.minTime = std::min(track.minTime, static_cast<float>(inputAccessor.minValues[0]));
+            track.maxTime = std::max(track.maxTime, static_cast<float>(inputAccessor.maxValues[0]));
+            track.hasTimepoints = true;
+            ctx.usd->hasAnimations = true;
+        }
+    }
+}
+
 void
 importNodeAnimations(ImportGltfContext& ctx)
 {
@@ -3864,6 +3917,87 @@ importNgpExtension(const tinygltf::Value& ngp, NgpData& ngpData)
       GfMatrix4d(GfRotation(GfVec3d(1.0, 0.0, 0.0), -90.0), GfVec3d(0.0, 0.0, 0.0));
 }
 
+// Reads the per instance transforms of EXT_mesh_gpu_instancing into a point instancer of the
+// meshes. Returns -1 if the extension is invalid, in which case the meshes are imported once, at
+// the transform of the node.
+static int
+importMeshGpuInstancing(ImportGltfContext& ctx,
+                        const tinygltf::Value& instancing,
+                        const std::vector<int>& meshes,
+                        const std::string& nodeName)
+{
+    const tinygltf::Value& attributes = instancing.Get("attributes");
+    if (!attributes.IsObject()) {
+        TF_WARN("Node '%s' has no EXT_mesh_gpu_instancing attributes", nodeName.c_str());
+        return -1;
+    }
+    auto getAttribute = [&](const char* semantic) {
+        const tinygltf::Value& value = attributes.Get(semantic);
+        return value.IsInt() ? value.GetNumberAsInt() : -1;
+    };
+    const int translationsIndex = getAttribute("TRANSLATION");
+    const int rotationsIndex = getAttribute("ROTATION");
+    const int scalesIndex = getAttribute("SCALE");
+    if ((translationsIndex >= 0 &&
+         !validateAttributeAccessorType(
+           *ctx.gltf, translationsIndex, TINYGLTF_TYPE_VEC3, "TRANSLATION", nodeName)) ||
+        (rotationsIndex >= 0 &&
+         !validateAttributeAccessorType(
+           *ctx.gltf, rotationsIndex, TINYGLTF_TYPE_VEC4, "ROTATION", nodeName)) ||
+        (scalesIndex >= 0 &&
+         !validateAttributeAccessorType(
+           *ctx.gltf, scalesIndex, TINYGLTF_TYPE_VEC3, "SCALE", nodeName))) {
+        return -1;
+    }
+
+    // All attributes hold a value per instance
+    size_t count = 0;
+    for (int accessorIndex : { translationsIndex, rotationsIndex, scalesIndex }) {
+        if (accessorIndex < 0) {
+            continue;
+        }
+        const size_t accessorCount = getAccessorElementCount(*ctx.gltf, accessorIndex);
+        if (count != 0 && accessorCount != count) {
+            TF_WARN("Node '%s' has EXT_mesh_gpu_instancing attributes of different counts",
+                    nodeName.c_str());
+            return -1;
+        }
+        count = accessorCount;
+    }
+    if (count == 0) {
+        TF_WARN("Node '%s' has no EXT_mesh_gpu_instancing instances", nodeName.c_str());
+        return -1;
+    }
+
+    auto [instancerIndex, instancer] = ctx.usd->addPointInstancer();
+    instancer.name = "Instancer";
+    instancer.meshes = meshes;
+    instancer.positions = PXR_NS::VtVec3fArray(count, PXR_NS::GfVec3f(0.0f));
+    if (translationsIndex >= 0) {
+        readAccessorDataToFloat(*ctx.gltf,
+                                translationsIndex,
+                                reinterpret_cast<float*>(instancer.positions.data()),
+                                count * 3);
+    }
+    if (rotationsIndex >= 0) {
+        // glTF stores quaternions as (x, y, z, w), possibly as normalized integers
+        PXR_NS::VtVec4fArray rotations(count, PXR_NS::GfVec4f(0.0f, 0.0f, 0.0f, 1.0f));
+        readAccessorDataToFloat(
+          *ctx.gltf, rotationsIndex, reinterpret_cast<float*>(rotations.data()), count * 4);
+        instancer.orientations.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            const PXR_NS::GfVec4f& r = rotations[i];
+            instancer.orientations[i] = PXR_NS::GfQuath(r[3], r[0], r[1], r[2]);
+        }
+    }
+    if (scalesIndex >= 0) {
+        instancer.scales = PXR_NS::VtVec3fArray(count, PXR_NS::GfVec3f(1.0f));
+        readAccessorDataToFloat(
+          *ctx.gltf, scalesIndex, reinterpret_cast<float*>(instancer.scales.data()), count * 3);
+    }
+    return instancerIndex;
+}
+
 // We traverse the glTF nodes recursively from root to children and assign each node a usd index
 // We maintain a mapping from the gltf node index to the usd node index in `nodeMap` for reference.
 int
@@ -4017,7 +4151,14 @@ _traverseNodes(ImportGltfContext& ctx,
                 // traversed
                 skinnedNodes.push_back(nodeIndex);
             } else {
-                n.staticMeshes = ctx.meshes[node.mesh];
+                const auto instancingIt = node.extensions.find("EXT_mesh_gpu_instancing");
+                if (instancingIt != node.extensions.end()) {
+                    n.pointInstancer = importMeshGpuInstancing(
+                      ctx, instancingIt->second, ctx.meshes[node.mesh], node.name);
+                }
+                if (n.pointInstancer < 0) {
+                    n.staticMeshes = ctx.meshes[node.mesh];
+                }
             }
         }
     }
@@ -4196,12 +4337,12 @@ static const std::set<std::string> supportedExtension = {
     "KHR_materials_unlit",
     // "KHR_materials_variants",
     "KHR_materials_volume",
-    // "KHR_mesh_quantization",
+    "KHR_mesh_quantization",
     // "KHR_texture_basisu",
     "KHR_texture_transform",
     // "KHR_xmp_json_ld",
-    // "EXT_mesh_gpu_instancing",
-    // "EXT_meshopt_compression",
+    "EXT_mesh_gpu_instancing",
+    "EXT_meshopt_compression",
     "EXT_texture_webp",
 
     // Vendor extensions
@@ -4291,9 +4432,22 @@ importGltf(const ImportGltfOptions& options,
     if (!importMetadata(ctx)) {
         return false;
     }
+    if (options.metadataOnly) {
+        // Match the filenames the full import adds from importImage. The metadata-only read only
+        // keeps the images with an external uri.
+        for (const tinygltf::Image& image : ctx.gltf->images) {
+            if (!image.uri.empty() && image.uri.compare(0, 5, "data:", 5) != 0) {
+                ctx.filenames.push_back(image.uri);
+            }
+        }
+        importAnimationTrackRanges(ctx);
+        usd.metadata.SetValueAtPath("filenames", VtValue(ctx.filenames));
+        return true;
+    }
     importCameras(ctx);
 
     if (options.importMaterials) {
+        ProfilePhase materialsPhase("materials");
         importMaterials(ctx);
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Materials import completed successfully\n");
     }
@@ -4304,7 +4458,9 @@ importGltf(const ImportGltfOptions& options,
     }
     if (options.importGeometry) {
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Starting meshes import...\n");
+        ProfilePhase meshesPhase("meshes");
         importMeshes(ctx);
+        meshesPhase.stop();
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Meshes import completed\n");
         // Resize the skeletons array before importing nodes, to allow skinning targets to be
         // added during importNodes
@@ -4314,11 +4470,13 @@ importGltf(const ImportGltfOptions& options,
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Starting skeletons import...\n");
         importSkeletons(ctx);
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Starting animation tracks import...\n");
+        ProfilePhase animationsPhase("animations");
         importAnimationTracks(ctx);
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Starting node animations import...\n");
         importNodeAnimations(ctx);
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Starting skeleton animations import...\n");
         importSkeletonAnimations(ctx);
+        animationsPhase.stop();
         TF_DEBUG_MSG(FILE_FORMAT_GLTF, "Starting mesh instancing check...\n");
         checkMeshInstancing(ctx);
     }
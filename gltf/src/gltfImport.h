@@ -24,6 +24,9 @@ struct ImportGltfOptions
     bool importImages = true;
     bool importLights = true;
     bool computeBitangents = false;
+    // Only import the layer metadata. The animation time ranges are taken from the bounds of the
+    // animation input accessors, no keyframes are decoded.
+    bool metadataOnly = false;
 };
 
 /// \ingroup usdgltf
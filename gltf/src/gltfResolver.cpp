@@ -44,9 +44,15 @@ GltfResolver::readCache(const std::string& resolvedPath, std::vector<ImageAsset>
     TF_DEBUG_MSG(
       FILE_FORMAT_GLTF, "Type: %s, Size: %zu KB\n", isAscii ? "GLTF" : "GLB", bufferSize >> 10);
 
+    // Only the materials and images are needed to fill the cache. Fall back to a full read if the
+    // image-only read can't handle the file.
     tinygltf::Model gltf;
-    VOID_GUARD(readGltfFromMemory(gltf, baseDir, isAscii, &*buffer, bufferSize),
-               "Error reading glTF file\n");
+    if (!readGltfImagesFromMemory(gltf, baseDir, isAscii, &*buffer, bufferSize)) {
+        TF_DEBUG_MSG(FILE_FORMAT_GLTF, "readCache: falling back to a full read\n");
+        gltf = tinygltf::Model();
+        VOID_GUARD(readGltfFromMemory(gltf, baseDir, isAscii, &*buffer, bufferSize),
+                   "Error reading glTF file\n");
+    }
 
     UsdData usd;
     ImportGltfOptions options;
@@ -128,9 +128,9 @@ _genImageName(const std::string& basename, int image1, int image2)
 // present, they should be the same size. It computes the new diffuse and metallic-roughness images
 // using the specular-glossiness to metallic-roughness conversion function for each pixel.
 void
-_convertSpecularGlossToMetalicRough(Image& diffuseSrcImage,       // image is in srgb space
+_convertSpecularGlossToMetalicRough(Image& diffuseSrcImage,       // image is in linear space
                                     GfVec4f& diffuseFactor,       // factors are in linear space
-                                    Image& specularSrcImage,      // image is in srgb space
+                                    Image& specularSrcImage,      // image is in linear space
                                     GfVec4f& specularGlossFactor, // factors are in linear space
                                     Image& diffuseDstImage,
                                     Image& mrDstImage,
@@ -192,26 +192,19 @@ _convertSpecularGlossToMetalicRough(Image& diffuseSrcImage,       // image is in
     const unsigned int numPixels = width * height;
     for (unsigned int i = 0; i < numPixels; ++i) {
         if (hasDiffuseTexture) {
-            diffuseSrc[0] = srgbToLinear(diffuseSrc[0]) * diffuseFactor[0];
-            diffuseSrc[1] = srgbToLinear(diffuseSrc[1]) * diffuseFactor[1];
-            diffuseSrc[2] = srgbToLinear(diffuseSrc[2]) * diffuseFactor[2];
+            diffuseSrc[0] *= diffuseFactor[0];
+            diffuseSrc[1] *= diffuseFactor[1];
+            diffuseSrc[2] *= diffuseFactor[2];
         }
         if (hasSpecularTexture) {
-            specularSrc[0] = srgbToLinear(specularSrc[0]) * specularGlossFactor[0];
-            specularSrc[1] = srgbToLinear(specularSrc[1]) * specularGlossFactor[1];
-            specularSrc[2] = srgbToLinear(specularSrc[2]) * specularGlossFactor[2];
+            specularSrc[0] *= specularGlossFactor[0];
+            specularSrc[1] *= specularGlossFactor[1];
+            specularSrc[2] *= specularGlossFactor[2];
         }
 
-        float diffuseResult[3];
+        // diffuse and metallic are stored linear, and converted back to sRGB after the loop
         float metallic;
-        _convertToMetallicRoughness(diffuseSrc, specularSrc, diffuseResult, &metallic);
-
-        // convert diffuse and metallic back to sRGB
-        diffuseDst[0] = linearToSRGB(diffuseResult[0]);
-        diffuseDst[1] = linearToSRGB(diffuseResult[1]);
-        diffuseDst[2] = linearToSRGB(diffuseResult[2]);
-        // Yes, we do need to convert metallic from linear to srgb
-        metallic = linearToSRGB(metallic);
+        _convertToMetallicRoughness(diffuseSrc, specularSrc, diffuseDst, &metallic);
 
         if (*opacitySrc < 1.0f)
             hasTransparency = true;
@@ -231,6 +224,10 @@ _convertSpecularGlossToMetalicRough(Image& diffuseSrcImage,       // image is in
         opacityDst += opacityDstStep;
         mrDst += 3;
     }
+
+    // Yes, we do need to convert metallic from linear to srgb
+    imageLinearToSRGB(diffuseDstImage, 0, 3);
+    imageLinearToSRGB(mrDstImage, 2, 1);
 }
 
 // convert color component expected to be in the range [0,1] to the range [0,255]
@@ -306,20 +303,23 @@ translateSpecularGlossinessToMetallicRoughness(ImportGltfContext& ctx,
         Image diffuseSrcImage;
         Image specularSrcImage;
 
-        // read the diffuse image (if present)
+        // read the diffuse image (if present). The images are read in their source type, so the
+        // conversion of their colors to linear goes through a table of their values.
         if (diffuseIn.image >= 0) {
             const ImageAsset& diffuseImageAsset = ctx.usd->images[diffuseIn.image];
-            diffuseSrcImage.read(diffuseImageAsset);
+            diffuseSrcImage.read(diffuseImageAsset, -1, true);
             // if the diffuse image is not rgb, read it again with a forced set of channels
             if (diffuseSrcImage.channels < 3) {
-                diffuseSrcImage.read(diffuseImageAsset, diffuseSrcImage.channels < 2 ? 3 : 4);
+                diffuseSrcImage.read(diffuseImageAsset, diffuseSrcImage.channels < 2 ? 3 : 4, true);
             }
+            imageSrgbToLinear(diffuseSrcImage, 0, std::min(diffuseSrcImage.channels, 3));
         }
 
         // read the specular image (if present)
         if (specularIn.image >= 0) {
             const ImageAsset& specularImageAsset = ctx.usd->images[specularIn.image];
-            specularSrcImage.read(specularImageAsset, 4);
+            specularSrcImage.read(specularImageAsset, 4, true);
+            imageSrgbToLinear(specularSrcImage, 0, std::min(specularSrcImage.channels, 3));
         }
 
         // If both the diffuse and specular images are present but are of different sizes, we ignore
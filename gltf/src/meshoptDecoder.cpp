@@ -0,0 +1,541 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#include "meshoptDecoder.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace adobe::usd {
+
+namespace {
+
+// Attributes: the high nibble of the header byte, and the layout of the vertex blocks
+constexpr uint8_t kVertexHeader = 0xa0;
+constexpr size_t kVertexBlockSizeBytes = 8192;
+constexpr size_t kVertexBlockMaxSize = 256;
+constexpr size_t kByteGroupSize = 16;
+// Most bytes a byte group reads: an 8 byte header of 4 bit values, then 16 escaped values
+constexpr size_t kByteGroupDecodeLimit = 24;
+constexpr size_t kTailMinSize = 32;
+
+// Triangles and indices
+constexpr uint8_t kIndexHeader = 0xe0;
+constexpr uint8_t kSequenceHeader = 0xd0;
+constexpr size_t kCodeAuxTableSize = 16;
+constexpr size_t kSequenceTailSize = 4;
+
+size_t
+getVertexBlockSize(size_t byteStride)
+{
+    // The block is decoded through a scratch buffer of kVertexBlockSizeBytes, in byte groups
+    size_t result = (kVertexBlockSizeBytes / byteStride) & ~(kByteGroupSize - 1);
+    return result < kVertexBlockMaxSize ? result : kVertexBlockMaxSize;
+}
+
+uint8_t
+unzigzag8(uint8_t v)
+{
+    return static_cast<uint8_t>(-(v & 1) ^ (v >> 1));
+}
+
+// Reads 16 values packed with 2 or 4 bits each, most significant bits first. The all ones value
+// escapes to a full byte read after the packed values.
+const uint8_t*
+decodeBytesGroupPacked(const uint8_t* data, uint8_t* dst, int bits)
+{
+    const int valuesPerByte = 8 / bits;
+    const uint8_t escape = static_cast<uint8_t>((1 << bits) - 1);
+    const uint8_t* extra = data + kByteGroupSize / valuesPerByte;
+    for (size_t i = 0; i < kByteGroupSize; ++i) {
+        const uint8_t byte = data[i / valuesPerByte];
+        const int shift = 8 - bits * (1 + static_cast<int>(i % valuesPerByte));
+        const uint8_t value = (byte >> shift) & escape;
+        if (value == escape) {
+            dst[i] = *extra++;
+        } else {
+            dst[i] = value;
+        }
+    }
+    return extra;
+}
+
+const uint8_t*
+decodeBytesGroup(const uint8_t* data, uint8_t* dst, int bitsLog2)
+{
+    switch (bitsLog2) {
+        case 0:
+            memset(dst, 0, kByteGroupSize);
+            return data;
+        case 1:
+            return decodeBytesGroupPacked(data, dst, 2);
+        case 2:
+            return decodeBytesGroupPacked(data, dst, 4);
+        default:
+            memcpy(dst, data, kByteGroupSize);
+            return data + kByteGroupSize;
+    }
+}
+
+// Decodes `size` bytes, a multiple of the group size, each group preceded in the header by its
+// 2 bit encoding
+const uint8_t*
+decodeBytes(const uint8_t* data, const uint8_t* end, uint8_t* dst, size_t size)
+{
+    const uint8_t* header = data;
+    const size_t headerSize = (size / kByteGroupSize + 3) / 4;
+    if (static_cast<size_t>(end - data) < headerSize) {
+        return nullptr;
+    }
+    data += headerSize;
+    for (size_t i = 0; i < size; i += kByteGroupSize) {
+        // Streams end with a tail of at least kTailMinSize bytes, so a valid group never needs
+        // more than what this leaves
+        if (static_cast<size_t>(end - data) < kByteGroupDecodeLimit) {
+            return nullptr;
+        }
+        const size_t group = i / kByteGroupSize;
+        const int bitsLog2 = (header[group / 4] >> ((group % 4) * 2)) & 3;
+        data = decodeBytesGroup(data, dst + i, bitsLog2);
+    }
+    return data;
+}
+
+// Decodes a block of vertices. Each byte of the vertex is stored as a stream of zigzag deltas
+// to the same byte of the previous vertex, starting from `lastVertex`.
+const uint8_t*
+decodeVertexBlock(const uint8_t* data,
+                  const uint8_t* end,
+                  uint8_t* dst,
+                  size_t count,
+                  size_t byteStride,
+                  uint8_t* lastVertex)
+{
+    uint8_t deltas[kVertexBlockMaxSize];
+    const size_t alignedCount = (count + kByteGroupSize - 1) & ~(kByteGroupSize - 1);
+    for (size_t k = 0; k < byteStride; ++k) {
+        data = decodeBytes(data, end, deltas, alignedCount);
+        if (!data) {
+            return nullptr;
+        }
+        uint8_t previous = lastVertex[k];
+        for (size_t i = 0; i < count; ++i) {
+            const uint8_t value = static_cast<uint8_t>(unzigzag8(deltas[i]) + previous);
+            dst[i * byteStride + k] = value;
+            previous = value;
+        }
+    }
+    memcpy(lastVertex, dst + (count - 1) * byteStride, byteStride);
+    return data;
+}
+
+void
+writeIndex(uint8_t* dst, size_t i, size_t indexSize, uint32_t index)
+{
+    if (indexSize == 2) {
+        const uint16_t index16 = static_cast<uint16_t>(index);
+        memcpy(dst + i * 2, &index16, 2);
+    } else {
+        memcpy(dst + i * 4, &index, 4);
+    }
+}
+
+uint32_t
+decodeVByte(const uint8_t*& data)
+{
+    const uint8_t lead = *data++;
+    if (lead < 128) {
+        return lead;
+    }
+    // Up to 4 more groups of 7 bits
+    uint32_t result = lead & 127;
+    uint32_t shift = 7;
+    for (int i = 0; i < 4; ++i) {
+        const uint8_t group = *data++;
+        result |= static_cast<uint32_t>(group & 127) << shift;
+        shift += 7;
+        if (group < 128) {
+            break;
+        }
+    }
+    return result;
+}
+
+uint32_t
+decodeIndexDelta(const uint8_t*& data, uint32_t last)
+{
+    const uint32_t v = decodeVByte(data);
+    const uint32_t delta = (v >> 1) ^ (0u - (v & 1));
+    return last + delta;
+}
+
+// The edge and vertex FIFOs of the triangle codec, indexed modulo 16
+struct TriangleFifos
+{
+    uint32_t edges[16][2];
+    uint32_t vertices[16];
+    size_t edgeOffset = 0;
+    size_t vertexOffset = 0;
+
+    TriangleFifos()
+    {
+        memset(edges, -1, sizeof(edges));
+        memset(vertices, -1, sizeof(vertices));
+    }
+
+    void pushEdge(uint32_t a, uint32_t b)
+    {
+        edges[edgeOffset][0] = a;
+        edges[edgeOffset][1] = b;
+        edgeOffset = (edgeOffset + 1) & 15;
+    }
+
+    void pushVertex(uint32_t v, bool advance = true)
+    {
+        vertices[vertexOffset] = v;
+        vertexOffset = (vertexOffset + (advance ? 1 : 0)) & 15;
+    }
+};
+
+template<typename T>
+void
+decodeFilterOctahedral(uint8_t* data, size_t count, size_t byteStride)
+{
+    const float maxValue = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+    for (size_t i = 0; i < count; ++i) {
+        T v[4];
+        memcpy(v, data + i * byteStride, sizeof(v));
+        // The third component stores the value of 1, to reconstruct z from
+        float x = static_cast<float>(v[0]);
+        float y = static_cast<float>(v[1]);
+        const float z = static_cast<float>(v[2]) - std::fabs(x) - std::fabs(y);
+        // Unfold the lower hemisphere of the octahedron
+        const float t = z < 0.0f ? z : 0.0f;
+        x += x >= 0.0f ? t : -t;
+        y += y >= 0.0f ? t : -t;
+        const float scale = maxValue / std::sqrt(x * x + y * y + z * z);
+        v[0] = static_cast<T>(static_cast<int>(x * scale + (x >= 0.0f ? 0.5f : -0.5f)));
+        v[1] = static_cast<T>(static_cast<int>(y * scale + (y >= 0.0f ? 0.5f : -0.5f)));
+        v[2] = static_cast<T>(static_cast<int>(z * scale + (z >= 0.0f ? 0.5f : -0.5f)));
+        memcpy(data + i * byteStride, v, sizeof(v));
+    }
+}
+
+void
+decodeFilterQuaternion(uint8_t* data, size_t count)
+{
+    const float scale = 1.0f / std::sqrt(2.0f);
+    for (size_t i = 0; i < count; ++i) {
+        int16_t v[4];
+        memcpy(v, data + i * 8, sizeof(v));
+        // The last component stores the index of the omitted largest component in its 2 low bits,
+        // and the range the others were quantized to
+        const int range = v[3] | 3;
+        const float rangeScale = scale / static_cast<float>(range);
+        const float x = static_cast<float>(v[0]) * rangeScale;
+        const float y = static_cast<float>(v[1]) * rangeScale;
+        const float z = static_cast<float>(v[2]) * rangeScale;
+        const float ww = 1.0f - x * x - y * y - z * z;
+        const float w = std::sqrt(ww >= 0.0f ? ww : 0.0f);
+        const int largest = v[3] & 3;
+        v[(largest + 1) & 3] =
+          static_cast<int16_t>(static_cast<int>(x * 32767.0f + (x >= 0.0f ? 0.5f : -0.5f)));
+        v[(largest + 2) & 3] =
+          static_cast<int16_t>(static_cast<int>(y * 32767.0f + (y >= 0.0f ? 0.5f : -0.5f)));
+        v[(largest + 3) & 3] =
+          static_cast<int16_t>(static_cast<int>(z * 32767.0f + (z >= 0.0f ? 0.5f : -0.5f)));
+        v[largest] = static_cast<int16_t>(static_cast<int>(w * 32767.0f + 0.5f));
+        memcpy(data + i * 8, v, sizeof(v));
+    }
+}
+
+void
+decodeFilterExponential(uint8_t* data, size_t valueCount)
+{
+    for (size_t i = 0; i < valueCount; ++i) {
+        uint32_t v;
+        memcpy(&v, data + i * 4, 4);
+        // A signed 24 bit mantissa and a signed 8 bit exponent
+        const int32_t mantissa = static_cast<int32_t>(v << 8) >> 8;
+        const int32_t exponent = static_cast<int32_t>(v) >> 24;
+        const float value = std::ldexp(static_cast<float>(mantissa), exponent);
+        memcpy(data + i * 4, &value, 4);
+    }
+}
+
+}
+
+bool
+parseMeshoptMode(const std::string& name, MeshoptMode& mode)
+{
+    if (name == "ATTRIBUTES") {
+        mode = MeshoptMode::Attributes;
+    } else if (name == "TRIANGLES") {
+        mode = MeshoptMode::Triangles;
+    } else if (name == "INDICES") {
+        mode = MeshoptMode::Indices;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool
+parseMeshoptFilter(const std::string& name, MeshoptFilter& filter)
+{
+    if (name.empty() || name == "NONE") {
+        filter = MeshoptFilter::None;
+    } else if (name == "OCTAHEDRAL") {
+        filter = MeshoptFilter::Octahedral;
+    } else if (name == "QUATERNION") {
+        filter = MeshoptFilter::Quaternion;
+    } else if (name == "EXPONENTIAL") {
+        filter = MeshoptFilter::Exponential;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool
+decodeMeshoptVertexBuffer(uint8_t* dst,
+                          size_t count,
+                          size_t byteStride,
+                          const uint8_t* src,
+                          size_t srcSize)
+{
+    if (byteStride == 0 || byteStride > 256 || byteStride % 4 != 0) {
+        return false;
+    }
+    if (srcSize < 1 + byteStride || (src[0] & 0xf0) != kVertexHeader) {
+        return false;
+    }
+    // Only version 0 is defined by the extension
+    if ((src[0] & 0x0f) != 0) {
+        return false;
+    }
+    const uint8_t* data = src + 1;
+    const uint8_t* end = src + srcSize;
+
+    // The stream ends with the vertex the deltas of the first block are relative to
+    uint8_t lastVertex[256];
+    memcpy(lastVertex, end - byteStride, byteStride);
+
+    const size_t blockSize = getVertexBlockSize(byteStride);
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        const size_t blockCount = offset + blockSize < count ? blockSize : count - offset;
+        data = decodeVertexBlock(
+          data, end, dst + offset * byteStride, blockCount, byteStride, lastVertex);
+        if (!data) {
+            return false;
+        }
+    }
+    const size_t tailSize = byteStride < kTailMinSize ? kTailMinSize : byteStride;
+    return static_cast<size_t>(end - data) == tailSize;
+}
+
+bool
+decodeMeshoptIndexBuffer(uint8_t* dst,
+                         size_t count,
+                         size_t indexSize,
+                         const uint8_t* src,
+                         size_t srcSize)
+{
+    if (count % 3 != 0 || (indexSize != 2 && indexSize != 4)) {
+        return false;
+    }
+    // At least the header, a code per triangle and the table of auxiliary codes
+    if (srcSize < 1 + count / 3 + kCodeAuxTableSize || (src[0] & 0xf0) != kIndexHeader) {
+        return false;
+    }
+    const int version = src[0] & 0x0f;
+    if (version > 1) {
+        return false;
+    }
+
+    TriangleFifos fifos;
+    uint32_t next = 0;
+    uint32_t last = 0;
+    // Version 1 encodes small deltas to the last free index, 1 and -1, as 13 and 14
+    const int fecMax = version >= 1 ? 13 : 15;
+
+    const uint8_t* code = src + 1;
+    const uint8_t* data = code + count / 3;
+    const uint8_t* dataSafeEnd = src + srcSize - kCodeAuxTableSize;
+    const uint8_t* codeAuxTable = dataSafeEnd;
+
+    for (size_t i = 0; i < count; i += 3) {
+        // A triangle reads at most 16 bytes of data, which the table after the data leaves room
+        // for, so no further checks are needed until the next triangle
+        if (data > dataSafeEnd) {
+            return false;
+        }
+        const uint8_t codeTri = *code++;
+        if (codeTri < 0xf0) {
+            // An edge of a previous triangle and a third vertex
+            const int fe = codeTri >> 4;
+            const uint32_t a = fifos.edges[(fifos.edgeOffset - 1 - fe) & 15][0];
+            const uint32_t b = fifos.edges[(fifos.edgeOffset - 1 - fe) & 15][1];
+            const int fec = codeTri & 15;
+            uint32_t c;
+            if (fec < fecMax) {
+                // A new vertex, or a recent one
+                c = fec == 0 ? next : fifos.vertices[(fifos.vertexOffset - 1 - fec) & 15];
+                next += fec == 0 ? 1 : 0;
+                fifos.pushVertex(c, fec == 0);
+            } else {
+                c = fec != 15 ? last + (fec - (fec ^ 3)) : decodeIndexDelta(data, last);
+                last = c;
+                fifos.pushVertex(c);
+            }
+            writeIndex(dst, i + 0, indexSize, a);
+            writeIndex(dst, i + 1, indexSize, b);
+            writeIndex(dst, i + 2, indexSize, c);
+            fifos.pushEdge(c, b);
+            fifos.pushEdge(a, c);
+        } else {
+            // Three vertices that are new, recent or explicit, the first one being new or explicit
+            const bool inlineAux = codeTri >= 0xfe;
+            const uint8_t codeAux = inlineAux ? *data++ : codeAuxTable[codeTri & 15];
+            const int fea = codeTri == 0xff ? 15 : 0;
+            const int feb = codeAux >> 4;
+            const int fec = codeAux & 15;
+            if (inlineAux && codeAux == 0) {
+                // Restarts the numbering of the new vertices
+                next = 0;
+            }
+            uint32_t a = fea == 0 ? next++ : 0;
+            uint32_t b = feb == 0 ? next++ : fifos.vertices[(fifos.vertexOffset - feb) & 15];
+            uint32_t c = fec == 0 ? next++ : fifos.vertices[(fifos.vertexOffset - fec) & 15];
+            // Only the codes read from the stream can be explicit, the table can't hold them
+            const bool explicitB = inlineAux && feb == 15;
+            const bool explicitC = inlineAux && fec == 15;
+            if (inlineAux) {
+                if (fea == 15) {
+                    last = a = decodeIndexDelta(data, last);
+                }
+                if (explicitB) {
+                    last = b = decodeIndexDelta(data, last);
+                }
+                if (explicitC) {
+                    last = c = decodeIndexDelta(data, last);
+                }
+            }
+            writeIndex(dst, i + 0, indexSize, a);
+            writeIndex(dst, i + 1, indexSize, b);
+            writeIndex(dst, i + 2, indexSize, c);
+            fifos.pushVertex(a);
+            fifos.pushVertex(b, feb == 0 || explicitB);
+            fifos.pushVertex(c, fec == 0 || explicitC);
+            fifos.pushEdge(b, a);
+            fifos.pushEdge(c, b);
+            fifos.pushEdge(a, c);
+        }
+    }
+    // All the data must have been read, up to the table
+    return data == dataSafeEnd;
+}
+
+bool
+decodeMeshoptIndexSequence(uint8_t* dst,
+                           size_t count,
+                           size_t indexSize,
+                           const uint8_t* src,
+                           size_t srcSize)
+{
+    if (indexSize != 2 && indexSize != 4) {
+        return false;
+    }
+    // At least the header, a byte per index and the tail
+    if (srcSize < 1 + count + kSequenceTailSize || (src[0] & 0xf0) != kSequenceHeader) {
+        return false;
+    }
+    // Version 1 is what meshoptimizer writes, and the only one the extension allows. Version 0 is
+    // the same bitstream.
+    if ((src[0] & 0x0f) > 1) {
+        return false;
+    }
+    const uint8_t* data = src + 1;
+    const uint8_t* dataSafeEnd = src + srcSize - kSequenceTailSize;
+
+    // Indices are deltas to one of two baselines, selected by the low bit
+    uint32_t last[2] = { 0, 0 };
+    for (size_t i = 0; i < count; ++i) {
+        // An index reads at most 5 bytes, which the tail after the data leaves room for
+        if (data >= dataSafeEnd) {
+            return false;
+        }
+        uint32_t v = decodeVByte(data);
+        const uint32_t baseline = v & 1;
+        v >>= 1;
+        const uint32_t delta = (v >> 1) ^ (0u - (v & 1));
+        const uint32_t index = last[baseline] + delta;
+        last[baseline] = index;
+        writeIndex(dst, i, indexSize, index);
+    }
+    return data == dataSafeEnd;
+}
+
+bool
+applyMeshoptFilter(uint8_t* data, size_t count, size_t byteStride, MeshoptFilter filter)
+{
+    switch (filter) {
+        case MeshoptFilter::None:
+            return true;
+        case MeshoptFilter::Octahedral:
+            if (byteStride == 4) {
+                decodeFilterOctahedral<int8_t>(data, count, byteStride);
+            } else if (byteStride == 8) {
+                decodeFilterOctahedral<int16_t>(data, count, byteStride);
+            } else {
+                return false;
+            }
+            return true;
+        case MeshoptFilter::Quaternion:
+            if (byteStride != 8) {
+                return false;
+            }
+            decodeFilterQuaternion(data, count);
+            return true;
+        case MeshoptFilter::Exponential:
+            if (byteStride % 4 != 0) {
+                return false;
+            }
+            decodeFilterExponential(data, count * byteStride / 4);
+            return true;
+    }
+    return false;
+}
+
+bool
+decodeMeshoptBufferView(uint8_t* dst,
+                        size_t count,
+                        size_t byteStride,
+                        MeshoptMode mode,
+                        MeshoptFilter filter,
+                        const uint8_t* src,
+                        size_t srcSize)
+{
+    switch (mode) {
+        case MeshoptMode::Attributes:
+            return decodeMeshoptVertexBuffer(dst, count, byteStride, src, srcSize) &&
+                   applyMeshoptFilter(dst, count, byteStride, filter);
+        case MeshoptMode::Triangles:
+            return filter == MeshoptFilter::None &&
+                   decodeMeshoptIndexBuffer(dst, count, byteStride, src, srcSize);
+        case MeshoptMode::Indices:
+            return filter == MeshoptFilter::None &&
+                   decodeMeshoptIndexSequence(dst, count, byteStride, src, srcSize);
+    }
+    return false;
+}
+
+}
@@ -0,0 +1,91 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// \file meshoptDecoder.h
+///
+/// Decoders of the bitstreams of the EXT_meshopt_compression glTF extension, as produced by
+/// meshoptimizer and gltfpack. They follow the extension specification:
+/// https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/EXT_meshopt_compression
+///
+/// All decoders validate the stream against the size of the source and destination, and return
+/// false on malformed data rather than reading or writing out of bounds.
+
+namespace adobe::usd {
+
+enum class MeshoptMode
+{
+    Attributes,
+    Triangles,
+    Indices,
+};
+
+enum class MeshoptFilter
+{
+    None,
+    Octahedral,
+    Quaternion,
+    Exponential,
+};
+
+/// Parses the "mode" and "filter" properties of the extension. Returns false for unknown values.
+bool
+parseMeshoptMode(const std::string& name, MeshoptMode& mode);
+bool
+parseMeshoptFilter(const std::string& name, MeshoptFilter& filter);
+
+/// Decodes `count` elements of `byteStride` bytes into `dst`, which must hold count * byteStride
+/// bytes, from the `srcSize` bytes of a compressed buffer view. The filter is applied after
+/// decoding the attributes, and must be None for the index modes. Returns false if the
+/// combination of mode, filter and stride isn't valid, or the stream is malformed.
+bool
+decodeMeshoptBufferView(uint8_t* dst,
+                        size_t count,
+                        size_t byteStride,
+                        MeshoptMode mode,
+                        MeshoptFilter filter,
+                        const uint8_t* src,
+                        size_t srcSize);
+
+/// Decodes an ATTRIBUTES stream of `count` vertices of `byteStride` bytes
+bool
+decodeMeshoptVertexBuffer(uint8_t* dst,
+                          size_t count,
+                          size_t byteStride,
+                          const uint8_t* src,
+                          size_t srcSize);
+
+/// Decodes a TRIANGLES stream of `count` 16 or 32 bit indices, count being a multiple of 3
+bool
+decodeMeshoptIndexBuffer(uint8_t* dst,
+                         size_t count,
+                         size_t indexSize,
+                         const uint8_t* src,
+                         size_t srcSize);
+
+/// Decodes an INDICES stream of `count` 16 or 32 bit indices
+bool
+decodeMeshoptIndexSequence(uint8_t* dst,
+                           size_t count,
+                           size_t indexSize,
+                           const uint8_t* src,
+                           size_t srcSize);
+
+/// Reverts the encoding of a filter, in place over `count` decoded elements of `byteStride`
+/// bytes. Returns false if the stride isn't valid for the filter.
+bool
+applyMeshoptFilter(uint8_t* data, size_t count, size_t byteStride, MeshoptFilter filter);
+
+}
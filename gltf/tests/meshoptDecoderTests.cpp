@@ -0,0 +1,312 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#include <meshoptDecoder.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace adobe::usd;
+
+// The streams below are the output of the meshoptimizer encoders, as gltfpack writes them: version
+// 0 of the vertex codec and version 1 of the index codecs. Each test decodes a stream and compares
+// the result with the data it was encoded from.
+
+namespace {
+
+// 300 vertices of 4 bytes, so two blocks of 256 and 44 vertices. See vertexByte().
+const std::vector<uint8_t> kVertexStream = {
+    0xa0, 0x55, 0x55, 0x55, 0x55, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x15, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f,
+};
+
+const std::vector<uint8_t> kOctahedral8Stream = {
+    0xa0, 0x01, 0x33, 0xfc, 0x00, 0x00, 0xfe, 0x91, 0x3a, 0xdd, 0xc5, 0x01, 0x3f, 0xfc, 0x00, 0x00,
+    0xfe, 0xfd, 0x91, 0xb5, 0x6d, 0x48, 0x00, 0x02, 0x04, 0x34, 0x30, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f,
+};
+
+const std::vector<uint8_t> kOctahedral16Stream = {
+    0xa0, 0x01, 0x13, 0xfc, 0x00, 0x00, 0x47, 0xfc, 0xe3, 0x34, 0x01, 0x33, 0xfc, 0x00, 0x00, 0xfe,
+    0x91, 0x3a, 0xdf, 0xc5, 0x01, 0x1b, 0xfc, 0x00, 0x00, 0x47, 0xd6, 0x5e, 0xa3, 0x01, 0x3f, 0xfc,
+    0x00, 0x00, 0xfe, 0xfd, 0x93, 0xb3, 0x6d, 0x48, 0x00, 0x00, 0x02, 0x04, 0x34, 0x30, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x26, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0xff, 0x7f,
+};
+
+const std::vector<uint8_t> kQuaternionStream = {
+    0xa0, 0x01, 0x03, 0xf0, 0x00, 0x00, 0xb1, 0xf4, 0xf6, 0x01, 0x03, 0xf0, 0x00, 0x00, 0x0a, 0x07,
+    0x09, 0x01, 0x0b, 0xf0, 0x00, 0x00, 0xb0, 0x85, 0x6d, 0x01, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0x04,
+    0x03, 0x0c, 0x01, 0x1b, 0xf0, 0x00, 0x00, 0xb1, 0xf4, 0xf6, 0x02, 0x0e, 0xda, 0x79, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x39, 0x90, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07,
+};
+
+const std::vector<uint8_t> kTriangleStream = {
+    0xe1, 0xf0, 0x10, 0x00, 0x10, 0xfe, 0xff, 0x1e, 0x1e, 0xff, 0x1e, 0x1e, 0xff, 0x1d, 0xfe, 0xfe,
+    0x10, 0x51, 0xff, 0x14, 0x02, 0x02, 0xff, 0x0c, 0x02, 0x02, 0xff, 0x2a, 0x01, 0x01, 0xf0, 0x41,
+    0x00, 0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00,
+    0x00,
+};
+
+const std::vector<uint8_t> kTriangleStream32 = {
+    0xe1, 0xf0, 0x10, 0x00, 0x10, 0xfe, 0xff, 0x1e, 0x1e, 0xff, 0x1e, 0x1e, 0xff, 0x1d, 0xfe, 0xfe,
+    0x10, 0x51, 0xff, 0xf4, 0xc5, 0x08, 0x02, 0x02, 0xff, 0x0c, 0x02, 0x02, 0xff, 0x2a, 0x01, 0x01,
+    0xf0, 0xa1, 0xc6, 0x08, 0x00, 0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86, 0x65, 0x89, 0x68,
+    0x98, 0x01, 0x69, 0x00, 0x00,
+};
+
+const std::vector<uint8_t> kSequenceStream = {
+    0xd1, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x91, 0x03, 0x05, 0x01, 0x05, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+const std::vector<uint8_t> kSequenceStream32 = {
+    0xd1, 0x00, 0x04, 0x00, 0x04, 0xc1, 0x8b, 0x11, 0x05, 0x01, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00,
+};
+
+uint8_t
+vertexByte(int i, int k)
+{
+    switch (k) {
+        case 0:
+            return static_cast<uint8_t>(i & 0xff);
+        case 1:
+            return static_cast<uint8_t>(i >> 8);
+        case 2:
+            return static_cast<uint8_t>((i * 5) & 0xff);
+        default:
+            return i < 200 ? 0x7f : 0x80;
+    }
+}
+
+// The unit vectors of kOctahedral8Stream and kOctahedral16Stream, with a w of 1 or -1 as tangents
+const float kNormals[][4] = { { 0, 0, 1, 1 },
+                              { 0, 0, -1, -1 },
+                              { 1, 0, 0, 1 },
+                              { 0.6f, -0.8f, 0, -1 },
+                              { 0.48f, 0.6f, -0.64f, 1 },
+                              { -0.36f, 0.48f, 0.8f, 1 },
+                              { -0.6f, 0, -0.8f, -1 } };
+constexpr size_t kNormalCount = sizeof(kNormals) / sizeof(kNormals[0]);
+
+// The unit quaternions of kQuaternionStream, quantized to 12 bits
+const float kHalfSqrt2 = 0.70710678f;
+const float kQuaternions[][4] = { { 0, 0, 0, 1 },
+                                  { kHalfSqrt2, 0, 0, kHalfSqrt2 },
+                                  { 0, -kHalfSqrt2, 0, kHalfSqrt2 },
+                                  { 0.5f, 0.5f, -0.5f, 0.5f },
+                                  { 0.1f, 0.7f, 0.1f, -0.7f },
+                                  { -0.9f, 0.3f, 0.1f, 0.3f } };
+constexpr size_t kQuaternionCount = sizeof(kQuaternions) / sizeof(kQuaternions[0]);
+
+// The triangles of kTriangleStream cover new vertices, shared edges, recent vertices, explicit
+// indices, the 1 and -1 deltas of version 1 and a restart of the numbering. kTriangleStream32
+// encodes the same triangles with 70000 added to the indices from 10 up.
+const std::vector<uint32_t> kTriangles = { 0,  1,  2,  2,  1,  3,  2,  3,  4,  4,  3,  5,
+                                           1,  5,  6,  10, 11, 12, 12, 11, 13, 13, 11, 14,
+                                           20, 21, 22, 22, 21, 23, 23, 21, 24, 45, 44, 43,
+                                           43, 44, 42, 9,  8,  7,  0,  1,  2,  2,  1,  3 };
+
+// Line lists, with jumps that switch between the two baselines of the sequence codec
+const std::vector<uint32_t> kSequence = { 0, 1, 1, 2, 2, 3, 100, 101, 101, 102, 3, 4, 4, 5 };
+const std::vector<uint32_t> kSequence32 = { 0, 1, 1, 2, 70000, 70001, 70001, 70002, 2, 3 };
+
+template<typename T>
+std::vector<uint32_t>
+readIndices(const std::vector<uint8_t>& data)
+{
+    std::vector<uint32_t> result(data.size() / sizeof(T));
+    for (size_t i = 0; i < result.size(); ++i) {
+        T index;
+        memcpy(&index, data.data() + i * sizeof(T), sizeof(T));
+        result[i] = index;
+    }
+    return result;
+}
+
+// The triangle codec may rotate the indices of a triangle, keeping its winding. Rotates each
+// triangle to start with its lowest index, so that the result can be compared with the source.
+std::vector<uint32_t>
+normalizeTriangles(std::vector<uint32_t> indices)
+{
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        while (indices[i] > indices[i + 1] || indices[i] > indices[i + 2]) {
+            std::rotate(indices.begin() + i, indices.begin() + i + 1, indices.begin() + i + 3);
+        }
+    }
+    return indices;
+}
+
+template<typename T>
+void
+expectOctahedral(const std::vector<uint8_t>& stream, float tolerance)
+{
+    const size_t stride = 4 * sizeof(T);
+    std::vector<uint8_t> decoded(kNormalCount * stride);
+    ASSERT_TRUE(decodeMeshoptBufferView(decoded.data(),
+                                        kNormalCount,
+                                        stride,
+                                        MeshoptMode::Attributes,
+                                        MeshoptFilter::Octahedral,
+                                        stream.data(),
+                                        stream.size()));
+    const float maxValue = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+    for (size_t i = 0; i < kNormalCount; ++i) {
+        T v[4];
+        memcpy(v, decoded.data() + i * stride, stride);
+        for (int k = 0; k < 4; ++k) {
+            EXPECT_NEAR(v[k] / maxValue, kNormals[i][k], tolerance) << i << " " << k;
+        }
+    }
+}
+
+}
+
+TEST(MeshoptDecoderTests, DecodeVertexStreamOverSeveralBlocks)
+{
+    constexpr size_t count = 300;
+    std::vector<uint8_t> decoded(count * 4);
+    ASSERT_TRUE(decodeMeshoptBufferView(decoded.data(),
+                                        count,
+                                        4,
+                                        MeshoptMode::Attributes,
+                                        MeshoptFilter::None,
+                                        kVertexStream.data(),
+                                        kVertexStream.size()));
+    for (size_t i = 0; i < count; ++i) {
+        for (int k = 0; k < 4; ++k) {
+            ASSERT_EQ(decoded[i * 4 + k], vertexByte(static_cast<int>(i), k)) << i << " " << k;
+        }
+    }
+
+    EXPECT_FALSE(decodeMeshoptVertexBuffer(
+      decoded.data(), count, 4, kVertexStream.data(), kVertexStream.size() - 1));
+}
+
+TEST(MeshoptDecoderTests, DecodeOctahedralFilter)
+{
+    expectOctahedral<int8_t>(kOctahedral8Stream, 0.02f);
+    expectOctahedral<int16_t>(kOctahedral16Stream, 0.001f);
+}
+
+TEST(MeshoptDecoderTests, DecodeQuaternionFilter)
+{
+    std::vector<uint8_t> decoded(kQuaternionCount * 8);
+    ASSERT_TRUE(decodeMeshoptBufferView(decoded.data(),
+                                        kQuaternionCount,
+                                        8,
+                                        MeshoptMode::Attributes,
+                                        MeshoptFilter::Quaternion,
+                                        kQuaternionStream.data(),
+                                        kQuaternionStream.size()));
+    for (size_t i = 0; i < kQuaternionCount; ++i) {
+        int16_t v[4];
+        memcpy(v, decoded.data() + i * 8, 8);
+        float q[4];
+        float dot = 0.0f;
+        for (int k = 0; k < 4; ++k) {
+            q[k] = v[k] / 32767.0f;
+            dot += q[k] * kQuaternions[i][k];
+        }
+        // q and -q are the same rotation, and the encoder keeps the largest component positive
+        const float sign = dot < 0.0f ? -1.0f : 1.0f;
+        for (int k = 0; k < 4; ++k) {
+            EXPECT_NEAR(q[k] * sign, kQuaternions[i][k], 0.002f) << i << " " << k;
+        }
+    }
+}
+
+TEST(MeshoptDecoderTests, DecodeTriangleStream)
+{
+    const size_t count = kTriangles.size();
+    std::vector<uint8_t> decoded(count * 2);
+    ASSERT_TRUE(decodeMeshoptBufferView(decoded.data(),
+                                        count,
+                                        2,
+                                        MeshoptMode::Triangles,
+                                        MeshoptFilter::None,
+                                        kTriangleStream.data(),
+                                        kTriangleStream.size()));
+    EXPECT_EQ(normalizeTriangles(readIndices<uint16_t>(decoded)), normalizeTriangles(kTriangles));
+
+    std::vector<uint32_t> expected = kTriangles;
+    for (uint32_t& index : expected) {
+        index += index >= 10 ? 70000 : 0;
+    }
+    decoded.resize(count * 4);
+    ASSERT_TRUE(decodeMeshoptBufferView(decoded.data(),
+                                        count,
+                                        4,
+                                        MeshoptMode::Triangles,
+                                        MeshoptFilter::None,
+                                        kTriangleStream32.data(),
+                                        kTriangleStream32.size()));
+    EXPECT_EQ(normalizeTriangles(readIndices<uint32_t>(decoded)), normalizeTriangles(expected));
+
+    EXPECT_FALSE(decodeMeshoptIndexBuffer(
+      decoded.data(), count, 4, kTriangleStream32.data(), kTriangleStream32.size() - 1));
+}
+
+TEST(MeshoptDecoderTests, DecodeIndexSequence)
+{
+    std::vector<uint8_t> decoded(kSequence.size() * 2);
+    ASSERT_TRUE(decodeMeshoptBufferView(decoded.data(),
+                                        kSequence.size(),
+                                        2,
+                                        MeshoptMode::Indices,
+                                        MeshoptFilter::None,
+                                        kSequenceStream.data(),
+                                        kSequenceStream.size()));
+    EXPECT_EQ(readIndices<uint16_t>(decoded), kSequence);
+
+    decoded.resize(kSequence32.size() * 4);
+    ASSERT_TRUE(decodeMeshoptBufferView(decoded.data(),
+                                        kSequence32.size(),
+                                        4,
+                                        MeshoptMode::Indices,
+                                        MeshoptFilter::None,
+                                        kSequenceStream32.data(),
+                                        kSequenceStream32.size()));
+    EXPECT_EQ(readIndices<uint32_t>(decoded), kSequence32);
+
+    EXPECT_FALSE(decodeMeshoptIndexSequence(decoded.data(),
+                                            kSequence32.size(),
+                                            4,
+                                            kSequenceStream32.data(),
+                                            kSequenceStream32.size() - 1));
+}
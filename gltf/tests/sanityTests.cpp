@@ -11,6 +11,7 @@ governing permissions and limitations under the License.
 */
 #include <common_gtest_args.h>
 #include <fileformatutils/featureFlags.h>
+#include <fileformatutils/resolver.h>
 #include <fileformatutils/test.h>
 #include <gtest/gtest.h>
 #include <pxr/base/gf/range3f.h>
@@ -18,16 +19,23 @@ governing permissions and limitations under the License.
 #include <pxr/usd/ar/asset.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdShade/input.h>
 #include <pxr/usd/usdShade/shader.h>
 
 #include <fstream>
+#include <map>
 #include <sstream>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
@@ -610,3 +618,303 @@ TEST(GlTFSanityTests, ExportOpenPbrBaseWeight)
     EXPECT_NEAR(unit[1].get<double>(), 0.5, 1e-4);
     EXPECT_NEAR(unit[2].get<double>(), 0.5, 1e-4);
 }
+
+// Reads every packaged image referenced by the stage through the package resolver, keyed by the
+// authored asset path.
+static std::map<std::string, std::vector<char>>
+readPackagedImages(const UsdStageRefPtr& stage)
+{
+    std::map<std::string, std::vector<char>> images;
+    for (const UsdPrim& prim : stage->Traverse()) {
+        for (const UsdAttribute& attr : prim.GetAttributes()) {
+            SdfAssetPath assetPath;
+            if (!attr.Get(&assetPath) ||
+                assetPath.GetResolvedPath().find('[') == std::string::npos) {
+                continue;
+            }
+            std::shared_ptr<ArAsset> asset =
+              ArGetResolver().OpenAsset(ArResolvedPath(assetPath.GetResolvedPath()));
+            if (asset) {
+                std::shared_ptr<const char> buffer = asset->GetBuffer();
+                images[assetPath.GetAssetPath()] =
+                  std::vector<char>(buffer.get(), buffer.get() + asset->GetSize());
+            }
+        }
+    }
+    return images;
+}
+
+// When the resolver cache is empty, the resolver reads only the images of the GLB. The result
+// must match the images populated by the full layer read.
+TEST(GlTFSanityTests, ResolverImageOnlyReadMatchesLayerImages)
+{
+    UsdStageRefPtr source = openAssetStage(assetDir + "SanityCube.gltf");
+    ASSERT_TRUE(source);
+    std::string glbPath = assetDir + "ResolverImageOnlyRead_out.glb";
+    ASSERT_TRUE(source->Export(glbPath));
+
+    UsdStageRefPtr stage = openAssetStage(glbPath);
+    ASSERT_TRUE(stage);
+    std::map<std::string, std::vector<char>> layerImages = readPackagedImages(stage);
+    ASSERT_FALSE(layerImages.empty());
+
+    // Drop the images populated by the layer read, so the resolver has to read the GLB itself
+    adobe::usd::Resolver::clearCache(stage->GetRootLayer()->GetResolvedPath());
+    std::map<std::string, std::vector<char>> resolverImages = readPackagedImages(stage);
+    EXPECT_EQ(layerImages, resolverImages);
+}
+
+// A metadata-only read authors the same layer metadata as a full read, including the filenames of
+// the external buffers it didn't load, but nothing below the default prim
+TEST(GlTFSanityTests, MetadataOnlyReadMatchesLayerMetadata)
+{
+    SdfLayerRefPtr full = SdfLayer::OpenAsAnonymous(assetDir + "SanityCube.gltf");
+    SdfLayerRefPtr metadataOnly = SdfLayer::OpenAsAnonymous(assetDir + "SanityCube.gltf", true);
+    ASSERT_TRUE(full);
+    ASSERT_TRUE(metadataOnly);
+
+    EXPECT_EQ(metadataOnly->GetDefaultPrim(), full->GetDefaultPrim());
+    EXPECT_EQ(metadataOnly->GetCustomLayerData(), full->GetCustomLayerData());
+    const TfToken upAxis("upAxis");
+    const TfToken metersPerUnit("metersPerUnit");
+    EXPECT_EQ(metadataOnly->GetField(SdfPath::AbsoluteRootPath(), upAxis),
+              full->GetField(SdfPath::AbsoluteRootPath(), upAxis));
+    EXPECT_EQ(metadataOnly->GetField(SdfPath::AbsoluteRootPath(), metersPerUnit),
+              full->GetField(SdfPath::AbsoluteRootPath(), metersPerUnit));
+
+    SdfPrimSpecHandle root = metadataOnly->GetPrimAtPath(SdfPath("/SanityCube"));
+    ASSERT_TRUE(root);
+    EXPECT_TRUE(root->GetNameChildren().empty());
+}
+
+// The time range of a metadata-only read comes from the bounds of the animation input accessors,
+// instead of the keyframes, and matches the one of a full read
+TEST(GlTFSanityTests, MetadataOnlyReadAnimationTimeRange)
+{
+    SdfLayerRefPtr full = SdfLayer::OpenAsAnonymous(assetDir + "AnimatedNode.gltf");
+    SdfLayerRefPtr metadataOnly = SdfLayer::OpenAsAnonymous(assetDir + "AnimatedNode.gltf", true);
+    ASSERT_TRUE(full);
+    ASSERT_TRUE(metadataOnly);
+
+    ASSERT_TRUE(metadataOnly->HasStartTimeCode());
+    ASSERT_TRUE(metadataOnly->HasEndTimeCode());
+    EXPECT_DOUBLE_EQ(metadataOnly->GetStartTimeCode(), 0.5);
+    EXPECT_DOUBLE_EQ(metadataOnly->GetEndTimeCode(), 2.5);
+    EXPECT_EQ(metadataOnly->GetStartTimeCode(), full->GetStartTimeCode());
+    EXPECT_EQ(metadataOnly->GetEndTimeCode(), full->GetEndTimeCode());
+    EXPECT_EQ(metadataOnly->GetTimeCodesPerSecond(), full->GetTimeCodesPerSecond());
+}
+
+// EXT_meshopt_compression: the positions (with the exponential filter) and triangle indices are
+// only stored compressed, and are decoded into the fallback buffer on load
+TEST(GlTFSanityTests, ImportMeshoptCompression)
+{
+    UsdStageRefPtr stage = openAssetStage(assetDir + "MeshoptQuad.gltf");
+    ASSERT_TRUE(stage);
+
+    UsdGeomMesh mesh;
+    for (const UsdPrim& prim : stage->Traverse()) {
+        if (prim.IsA<UsdGeomMesh>()) {
+            mesh = UsdGeomMesh(prim);
+            break;
+        }
+    }
+    ASSERT_TRUE(mesh) << "no UsdGeomMesh found in imported glTF";
+
+    VtVec3fArray points;
+    ASSERT_TRUE(mesh.GetPointsAttr().Get(&points));
+    const VtVec3fArray expectedPoints = {
+        GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(0, 1, 0), GfVec3f(1, 1, 0)
+    };
+    EXPECT_EQ(points, expectedPoints);
+
+    VtIntArray indices;
+    ASSERT_TRUE(mesh.GetFaceVertexIndicesAttr().Get(&indices));
+    const VtIntArray expectedIndices = { 0, 1, 2, 2, 1, 3 };
+    EXPECT_EQ(indices, expectedIndices);
+}
+
+// KHR_mesh_quantization: integer positions are read as is, normalized normals and texture
+// coordinates are scaled to floats, with the lowest signed values clamped to -1
+TEST(GlTFSanityTests, ImportMeshQuantization)
+{
+    UsdStageRefPtr stage = openAssetStage(assetDir + "QuantizedQuad.gltf");
+    ASSERT_TRUE(stage);
+
+    UsdGeomMesh mesh;
+    for (const UsdPrim& prim : stage->Traverse()) {
+        if (prim.IsA<UsdGeomMesh>()) {
+            mesh = UsdGeomMesh(prim);
+            break;
+        }
+    }
+    ASSERT_TRUE(mesh) << "no UsdGeomMesh found in imported glTF";
+
+    VtVec3fArray points;
+    ASSERT_TRUE(mesh.GetPointsAttr().Get(&points));
+    const VtVec3fArray expectedPoints = {
+        GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(0, 1, 0), GfVec3f(1, 1, 0)
+    };
+    EXPECT_EQ(points, expectedPoints);
+
+    UsdGeomPrimvarsAPI primvars(mesh.GetPrim());
+    VtVec3fArray normals;
+    ASSERT_TRUE(primvars.GetPrimvar(TfToken("normals")).ComputeFlattened(&normals));
+    const VtVec3fArray expectedNormals = {
+        GfVec3f(0, 0, 1), GfVec3f(0, 0, 1), GfVec3f(0, -1, 0), GfVec3f(0, 0, -1)
+    };
+    EXPECT_EQ(normals, expectedNormals);
+
+    // V is flipped on import
+    VtVec2fArray uvs;
+    ASSERT_TRUE(primvars.GetPrimvar(TfToken("st")).ComputeFlattened(&uvs));
+    const VtVec2fArray expectedUvs = {
+        GfVec2f(0, 1), GfVec2f(1, 1), GfVec2f(0, 0), GfVec2f(1, 0)
+    };
+    EXPECT_EQ(uvs, expectedUvs);
+}
+
+// EXT_mesh_gpu_instancing: the instances of a node are written as a single point instancer, whose
+// prototype holds the mesh, rather than one prim per instance
+TEST(GlTFSanityTests, ImportMeshGpuInstancing)
+{
+    UsdStageRefPtr stage = openAssetStage(assetDir + "InstancedTriangle.gltf");
+    ASSERT_TRUE(stage);
+
+    UsdGeomPointInstancer instancer;
+    size_t meshCount = 0;
+    for (const UsdPrim& prim : stage->Traverse()) {
+        if (prim.IsA<UsdGeomPointInstancer>()) {
+            instancer = UsdGeomPointInstancer(prim);
+        } else if (prim.IsA<UsdGeomMesh>()) {
+            meshCount++;
+        }
+    }
+    ASSERT_TRUE(instancer) << "no UsdGeomPointInstancer found in imported glTF";
+    EXPECT_EQ(meshCount, 1u);
+
+    SdfPathVector prototypes;
+    ASSERT_TRUE(instancer.GetPrototypesRel().GetTargets(&prototypes));
+    ASSERT_EQ(prototypes.size(), 1u);
+    EXPECT_TRUE(prototypes[0].HasPrefix(instancer.GetPath()));
+
+    VtIntArray protoIndices;
+    ASSERT_TRUE(instancer.GetProtoIndicesAttr().Get(&protoIndices));
+    EXPECT_EQ(protoIndices, VtIntArray({ 0, 0, 0 }));
+
+    VtVec3fArray positions;
+    ASSERT_TRUE(instancer.GetPositionsAttr().Get(&positions));
+    EXPECT_EQ(positions, VtVec3fArray({ GfVec3f(0, 0, 0), GfVec3f(2, 0, 0), GfVec3f(4, 0, 0) }));
+
+    VtVec3fArray scales;
+    ASSERT_TRUE(instancer.GetScalesAttr().Get(&scales));
+    EXPECT_EQ(scales, VtVec3fArray({ GfVec3f(1, 1, 1), GfVec3f(1, 1, 1), GfVec3f(2, 2, 2) }));
+
+    // The second instance is rotated a quarter turn around Y
+    VtQuathArray orientations;
+    ASSERT_TRUE(instancer.GetOrientationsAttr().Get(&orientations));
+    ASSERT_EQ(orientations.size(), 3u);
+    EXPECT_EQ(orientations[0], GfQuath(1, 0, 0, 0));
+    EXPECT_NEAR(orientations[1].GetReal(), 0.7071, 1e-3);
+    EXPECT_NEAR(orientations[1].GetImaginary()[1], 0.7071, 1e-3);
+}
+
+// The primitives are imported in parallel, but the meshes must keep the order and names of a
+// serial import: mesh by mesh, primitive by primitive, with a suffix when a mesh has several
+TEST(GlTFSanityTests, ImportMultiPrimitiveMeshOrder)
+{
+    UsdStageRefPtr stage = openAssetStage(assetDir + "MultiPrimitiveMeshes.gltf");
+    ASSERT_TRUE(stage);
+
+    // Each primitive is a triangle at a height equal to its position in the file
+    std::vector<std::string> displayNames;
+    std::vector<float> heights;
+    for (const UsdPrim& prim : stage->Traverse()) {
+        if (!prim.IsA<UsdGeomMesh>()) {
+            continue;
+        }
+        std::string displayName;
+        prim.GetMetadata(SdfFieldKeys->DisplayName, &displayName);
+        displayNames.push_back(displayName);
+        VtVec3fArray points;
+        ASSERT_TRUE(UsdGeomMesh(prim).GetPointsAttr().Get(&points));
+        ASSERT_EQ(points.size(), 3u);
+        heights.push_back(points[0][2]);
+    }
+
+    const std::vector<std::string> expectedDisplayNames = {
+        "First_primitive0",  "First_primitive1",  "Second_primitive0",
+        "Second_primitive1", "Second_primitive2", "Single"
+    };
+    EXPECT_EQ(displayNames, expectedDisplayNames);
+    EXPECT_EQ(heights, std::vector<float>({ 0, 1, 2, 3, 4, 5 }));
+}
+
+#ifdef USD_FILEFORMATS_ENABLE_DRACO
+// KHR_draco_mesh_compression: the two primitives are only stored compressed, each in its own
+// buffer view, and are decoded when the file is loaded
+TEST(GlTFSanityTests, ImportDracoCompression)
+{
+    UsdStageRefPtr stage = openAssetStage(assetDir + "DracoPrimitives.glb");
+    ASSERT_TRUE(stage);
+
+    UsdGeomMesh quad;
+    UsdGeomMesh triangle;
+    for (const UsdPrim& prim : stage->Traverse()) {
+        if (!prim.IsA<UsdGeomMesh>()) {
+            continue;
+        }
+        UsdGeomMesh mesh(prim);
+        VtVec3fArray points;
+        ASSERT_TRUE(mesh.GetPointsAttr().Get(&points));
+        (points.size() == 4 ? quad : triangle) = mesh;
+    }
+    ASSERT_TRUE(quad) << "decoded quad not found in imported glTF";
+    ASSERT_TRUE(triangle) << "decoded triangle not found in imported glTF";
+
+    VtVec3fArray points;
+    ASSERT_TRUE(quad.GetPointsAttr().Get(&points));
+    const VtVec3fArray expectedQuadPoints = {
+        GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(0, 1, 0), GfVec3f(1, 1, 0)
+    };
+    EXPECT_EQ(points, expectedQuadPoints);
+
+    VtIntArray indices;
+    ASSERT_TRUE(quad.GetFaceVertexIndicesAttr().Get(&indices));
+    EXPECT_EQ(indices, VtIntArray({ 0, 1, 2, 2, 1, 3 }));
+
+    // V is flipped on import
+    VtVec2fArray uvs;
+    UsdGeomPrimvarsAPI primvars(quad.GetPrim());
+    ASSERT_TRUE(primvars.GetPrimvar(TfToken("st")).ComputeFlattened(&uvs));
+    const VtVec2fArray expectedUvs = {
+        GfVec2f(0, 1), GfVec2f(1, 1), GfVec2f(0, 0), GfVec2f(1, 0)
+    };
+    EXPECT_EQ(uvs, expectedUvs);
+
+    ASSERT_TRUE(triangle.GetPointsAttr().Get(&points));
+    const VtVec3fArray expectedTrianglePoints = {
+        GfVec3f(0, 0, 2), GfVec3f(2, 0, 2), GfVec3f(0, 2, 2)
+    };
+    EXPECT_EQ(points, expectedTrianglePoints);
+    ASSERT_TRUE(triangle.GetFaceVertexIndicesAttr().Get(&indices));
+    EXPECT_EQ(indices, VtIntArray({ 0, 1, 2 }));
+}
+
+// A Draco attribute with more components than any vertex attribute, here a MAT3 accessor backed
+// by a 9 component attribute, is rejected, and the primitive is left undecoded
+TEST(GlTFSanityTests, ImportDracoRejectsMatrixAttribute)
+{
+    UsdStageRefPtr stage = openAssetStage(assetDir + "DracoMatrixAttribute.glb");
+    ASSERT_TRUE(stage);
+
+    const VtVec3fArray decodedPoints = { GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(0, 1, 0) };
+    for (const UsdPrim& prim : stage->Traverse()) {
+        if (prim.IsA<UsdGeomMesh>()) {
+            VtVec3fArray points;
+            UsdGeomMesh(prim).GetPointsAttr().Get(&points);
+            EXPECT_NE(points, decodedPoints);
+        }
+    }
+}
+#endif
@@ -20,9 +20,12 @@ governing permissions and limitations under the License.
 #include <fileformatutils/geometry.h>
 #include <fileformatutils/layerRead.h>
 #include <fileformatutils/layerWriteSdfData.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/resolver.h>
 #include <fileformatutils/usdData.h>
 
+#include <pxr/base/work/loops.h>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 using namespace adobe::usd;
@@ -101,48 +104,73 @@ UsdObjFileFormat::CanRead(const std::string& filePath) const
     return true;
 }
 
+// Generates smooth normals for the meshes that have none. The meshes are independent of each
+// other, so they are processed concurrently.
+static void
+computeMissingNormals(UsdData& usd)
+{
+    std::vector<adobe::usd::Mesh*> meshes;
+    for (adobe::usd::Mesh& mesh : usd.meshes) {
+        if (mesh.normals.values.size() == 0) {
+            meshes.push_back(&mesh);
+        }
+    }
+    WorkParallelForEach(meshes.begin(), meshes.end(), [](adobe::usd::Mesh* mesh) {
+        TF_DEBUG_MSG(
+          FILE_FORMAT_OBJ, "Computing smooth normals for mesh %s\n", mesh->name.c_str());
+        adobe::usd::computeSmoothNormals(*mesh);
+    });
+    if (!meshes.empty()) {
+        TF_DEBUG_MSG(FILE_FORMAT_OBJ,
+                     "Computed normals for %zu/%zu meshes\n",
+                     meshes.size(),
+                     usd.meshes.size());
+    }
+}
+
 bool
 UsdObjFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool metadataOnly) const
 {
     TfStopwatch w;
     w.Start();
     TF_DEBUG_MSG(FILE_FORMAT_OBJ, "Read: %s\n", resolvedPath.c_str());
+    ProfileScope profile("obj", "read", resolvedPath);
     std::string fileType = getFileExtension(resolvedPath, DEBUG_TAG);
     SdfAbstractDataRefPtr layerData = InitData(layer->GetFileFormatArguments());
     ObjDataConstPtr data = TfDynamic_cast<const ObjDataConstPtr>(layerData);
     UsdData usd;
     Obj obj;
-    bool readImages = !data->assetsPath.empty();
+    bool readImages = !data->assetsPath.empty() && !metadataOnly;
     ImportObjOptions options;
-    options.importGeometry = true;
-    options.importMaterials = true;
+    options.importGeometry = !metadataOnly;
+    options.importMaterials = !metadataOnly;
     options.importImages = readImages;
     options.importPhong = data->phong;
     options.groupOptions = data->groupOptions;
     WriteLayerOptions layerOptions(*data);
+    layerOptions.metadataOnly = metadataOnly;
     obj.originalColorSpace = data->originalColorSpace;
-    GUARD(
-      readObj(obj, resolvedPath, readImages), "Error reading OBJ from %s\n", resolvedPath.c_str());
+    ProfilePhase parsePhase("parse");
+    if (metadataOnly) {
+        // The material libraries are still read, as they contribute the filenames and
+        // hasAdobeProperties metadata, but the geometry is never parsed
+        GUARD(readObjMaterials(obj, resolvedPath, false),
+              "Error reading OBJ from %s\n",
+              resolvedPath.c_str());
+    } else {
+        GUARD(readObj(obj, resolvedPath, readImages),
+              "Error reading OBJ from %s\n",
+              resolvedPath.c_str());
+    }
+    parsePhase.stop();
+    ProfilePhase importPhase("import");
     GUARD(importObj(options, obj, usd), "Error translating OBJ to USD\n");
 
     // Generate normals if requested and missing
     if (data->computeNormals) {
-        int processedCount = 0;
-        for (adobe::usd::Mesh& mesh : usd.meshes) {
-            if (mesh.normals.values.size() == 0) {
-                TF_DEBUG_MSG(
-                  FILE_FORMAT_OBJ, "Computing smooth normals for mesh %s\n", mesh.name.c_str());
-                adobe::usd::computeSmoothNormals(mesh);
-                processedCount++;
-            }
-        }
-        if (processedCount > 0) {
-            TF_DEBUG_MSG(FILE_FORMAT_OBJ,
-                         "Computed normals for %d/%zu meshes\n",
-                         processedCount,
-                         usd.meshes.size());
-        }
+        computeMissingNormals(usd);
     }
+    importPhase.stop();
 
     GUARD(writeLayer(
             layerOptions, usd, layer, layerData, fileType, DEBUG_TAG, SdfFileFormat::_SetLayerData),
@@ -152,7 +180,7 @@ UsdObjFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool me
 
     if (options.importImages) {
         Resolver::populateCache(resolvedPath, std::move(usd.images));
-    } else {
+    } else if (!metadataOnly) {
         Resolver::clearCache(resolvedPath);
     }
 
@@ -181,21 +209,7 @@ UsdObjFileFormat::ReadFromString(SdfLayer* layer, const std::string& input) cons
 
     // Generate normals if requested and missing
     if (data->computeNormals) {
-        int processedCount = 0;
-        for (adobe::usd::Mesh& mesh : usd.meshes) {
-            if (mesh.normals.values.size() == 0) {
-                TF_DEBUG_MSG(
-                  FILE_FORMAT_OBJ, "Computing smooth normals for mesh %s\n", mesh.name.c_str());
-                adobe::usd::computeSmoothNormals(mesh);
-                processedCount++;
-            }
-        }
-        if (processedCount > 0) {
-            TF_DEBUG_MSG(FILE_FORMAT_OBJ,
-                         "Computed normals for %d/%zu meshes\n",
-                         processedCount,
-                         usd.meshes.size());
-        }
+        computeMissingNormals(usd);
     }
 
     GUARD(writeLayer(
@@ -215,6 +229,7 @@ UsdObjFileFormat::WriteToFile(const SdfLayer& layer,
     TfStopwatch w;
     w.Start();
     TF_DEBUG_MSG(FILE_FORMAT_OBJ, "WriteToFile: %s\n", filename.c_str());
+    ProfileScope profile("obj", "write", filename);
     UsdData usd;
     Obj obj;
     ReadLayerOptions layerOptions;
@@ -225,8 +240,12 @@ UsdObjFileFormat::WriteToFile(const SdfLayer& layer,
     ExportObjOptions options;
     options.filename = filename;
     GUARD(readLayer(layerOptions, layer, usd, DEBUG_TAG), "Error reading USD\n");
+    ProfilePhase exportPhase("export");
     GUARD(exportObj(options, usd, obj), "Error translating USD to OBJ\n");
+    exportPhase.stop();
+    ProfilePhase writePhase("write");
     GUARD(writeObj(obj, filename, false), "Error writing OBJ to %s\n", filename.c_str());
+    writePhase.stop();
     w.Stop();
     TF_DEBUG_MSG(FILE_FORMAT_OBJ, "Total time: %ld\n", static_cast<long int>(w.GetMilliseconds()));
     return true;
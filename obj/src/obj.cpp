@@ -37,6 +37,7 @@ governing permissions and limitations under the License.
 #include "debugCodes.h"
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <fast_float/fast_float.h>
 #include <fileformatutils/common.h>
 #include <fmt/compile.h>
@@ -1254,9 +1255,8 @@ addImage(Obj& obj,
             if (!readFileContents(fullFilename, tempBuffer)) {
                 TF_WARN("Failed to load image file \"%s\"", fullFilename.c_str());
             } else {
-                image.image.assign(reinterpret_cast<const uint8_t*>(tempBuffer.data()),
-                                   reinterpret_cast<const uint8_t*>(tempBuffer.data()) +
-                                     tempBuffer.size());
+                image.image = ImageBuffer(reinterpret_cast<const uint8_t*>(tempBuffer.data()),
+                                          tempBuffer.size());
             }
         }
     }
@@ -1692,10 +1692,79 @@ readObjMdl(Obj& obj,
     return true;
 }
 
-/// Reads all file contents into a string buffer and hands off control to `readObjInternal`.
+/// Reads the material libraries referenced by `obj.libraries`, relative to `filename`.
 /// Only reads materials if some material was found in the main obj file.
 /// For materials, again all contents are first read into a string buffer, and then fed
 /// to `readObjMdl` or `readObjMtl`.
+bool
+readObjMaterialLibraries(Obj& obj,
+                         const std::string& filename,
+                         std::unordered_map<std::string, int>& materialMap,
+                         bool readImages)
+{
+    if (!obj.materials.size()) {
+        return true;
+    }
+    std::unordered_map<std::string, int> imageMap;
+    const std::string parentPath = TfGetPathName(filename);
+    for (size_t i = 0; i < obj.libraries.size(); i++) {
+        ObjMaterialLibrary& library = obj.libraries[i];
+        obj.importedFilenames.insert(library.filename);
+        std::string materialFilename = parentPath + library.filename;
+        std::vector<char> materialBuffer;
+        if (!readFileContents(materialFilename, materialBuffer)) {
+            TF_WARN("Failed to open material file \"%s\"", materialFilename.c_str());
+            continue;
+        }
+        if (library.isMdl) {
+            obj.hasAdobeProperties = true;
+            GUARD(readObjMdl(obj, i, materialBuffer, materialMap, imageMap, parentPath, readImages),
+                  "Failed parsing mdl");
+        } else {
+            GUARD(readObjMtl(obj, i, materialBuffer, materialMap, imageMap, parentPath, readImages),
+                  "Failed parsing mtl");
+        }
+    }
+    return true;
+}
+
+/// Single threaded scan of the obj string buffer that only records the `mtllib`, `adobe_mdllib`
+/// and `usemtl` directives, in the same way `joinObjIntermediates` would. Every other line is
+/// skipped by jumping to the next line break, without tokenizing it.
+void
+scanObjMaterialReferences(Obj& obj,
+                          const std::vector<char>& data,
+                          std::unordered_map<std::string, int>& materialMap)
+{
+    const char* end = data.data() + data.size(); // End of the obj string buffer.
+    const char* p = data.data();                 // Moving pointer into the obj string buffer.
+    std::string temp;
+    while (p < end - 2) { // -2 ensures at least 2 characters per line, as in the full parse
+        const char c0 = *p;
+        const char c1 = *(p + 1);
+        if (c0 == 'u' && c1 == 's' && checkWord(p, end, "usemtl")) {
+            nextSpacedText(p, end, temp);
+            auto it = materialMap.insert({ temp, static_cast<int>(obj.materials.size()) });
+            if (it.second) {
+                obj.materials.push_back(ObjMaterial(temp));
+            }
+        } else if ((c0 == 'm' && c1 == 't' && checkWord(p, end, "mtllib")) ||
+                   (c0 == 'a' && c1 == 'd' && checkWord(p, end, "adobe_mdllib"))) {
+            nextFilename(p, end, temp);
+            obj.libraries.push_back(ObjMaterialLibrary());
+            obj.libraries.back().filename = temp;
+            obj.libraries.back().isMdl = c0 == 'a';
+        }
+        const void* lineEnd = std::memchr(p, '\n', end - p);
+        if (!lineEnd) {
+            break;
+        }
+        p = static_cast<const char*>(lineEnd) + 1;
+    }
+}
+
+/// Reads all file contents into a string buffer and hands off control to `readObjInternal`.
+/// Material libraries are then read by `readObjMaterialLibraries`.
 /// Note we keep track of the filenames composing the obj model.
 bool
 readObj(Obj& obj, const std::string& filename, bool readImages)
@@ -1710,33 +1779,28 @@ readObj(Obj& obj, const std::string& filename, bool readImages)
     TF_DEBUG_MSG(
       FILE_FORMAT_OBJ, "read obj time: %lu\n", static_cast<long int>(watch.GetMilliseconds()));
     std::unordered_map<std::string, int> materialMap;
-    std::unordered_map<std::string, int> imageMap;
     GUARD(readObjInternal(obj, objBuffer, materialMap), "Failed parsing obj");
+    return readObjMaterialLibraries(obj, filename, materialMap, readImages);
+}
 
-    if (obj.materials.size()) {
-        const std::string parentPath = TfGetPathName(filename);
-        for (size_t i = 0; i < obj.libraries.size(); i++) {
-            ObjMaterialLibrary& library = obj.libraries[i];
-            obj.importedFilenames.insert(library.filename);
-            std::string materialFilename = parentPath + library.filename;
-            std::vector<char> materialBuffer;
-            if (!readFileContents(materialFilename, materialBuffer)) {
-                TF_WARN("Failed to open material file \"%s\"", materialFilename.c_str());
-                continue;
-            }
-            if (library.isMdl) {
-                obj.hasAdobeProperties = true;
-                GUARD(
-                  readObjMdl(obj, i, materialBuffer, materialMap, imageMap, parentPath, readImages),
-                  "Failed parsing mdl");
-            } else {
-                GUARD(
-                  readObjMtl(obj, i, materialBuffer, materialMap, imageMap, parentPath, readImages),
-                  "Failed parsing mtl");
-            }
-        }
-    }
-    return true;
+/// Like `readObj`, but the geometry is never parsed: a single scan of the obj string buffer
+/// collects the material references, and then the material libraries are read as usual.
+bool
+readObjMaterials(Obj& obj, const std::string& filename, bool readImages)
+{
+    TfStopwatch watch;
+    watch.Start();
+    std::string baseName = TfGetBaseName(filename);
+    obj.importedFilenames.insert(baseName);
+    std::vector<char> objBuffer;
+    GUARD(readFileContents(filename, objBuffer), "Failed reading obj file");
+    std::unordered_map<std::string, int> materialMap;
+    scanObjMaterialReferences(obj, objBuffer, materialMap);
+    watch.Stop();
+    TF_DEBUG_MSG(FILE_FORMAT_OBJ,
+                 "scan obj materials time: %lu\n",
+                 static_cast<long int>(watch.GetMilliseconds()));
+    return readObjMaterialLibraries(obj, filename, materialMap, readImages);
 }
 
 /// Directly hands off control to `readObjInternal`.
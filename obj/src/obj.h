@@ -203,6 +203,14 @@ struct Obj
 bool
 readObj(Obj& obj, const std::string& filename, bool readImages);
 
+/// \fn readObjMaterials
+/// \brief Read only the materials of the obj in file `filename` into `obj`.
+/// Geometry is skipped entirely: only the `mtllib`, `adobe_mdllib` and `usemtl` directives are
+/// scanned, then the material libraries are read as in `readObj`. Used by the asset resolver,
+/// which only needs the images referenced by the materials.
+bool
+readObjMaterials(Obj& obj, const std::string& filename, bool readImages);
+
 /// \fn readObj
 /// \brief Read an obj from the buffer `data` and store it in `obj`.
 /// Note this does not carry material data.
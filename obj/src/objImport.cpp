@@ -17,6 +17,7 @@ governing permissions and limitations under the License.
 // needed for kAsmToOpenPbrEmissionFactor, should be refactored and moved to a common header file
 #include <fileformatutils/layerWriteShared.h>
 #include <fileformatutils/materials.h>
+#include <fileformatutils/profiling.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/usdGeom/scope.h>
 #include <pxr/usd/usdGeom/tokens.h>
@@ -51,6 +52,32 @@ SetExtent(VtVec3fArray vertexValues, UsdGeomMesh mesh)
     mesh.GetExtentAttr().Set(extentArray);
 }
 
+// Points the maps of a material to the images they were merged into by deduplicateImages
+void
+remapImages(ObjMaterial& material, const std::vector<int>& remap)
+{
+    for (ObjMap* map : { &material.mapKa,
+                         &material.mapKd,
+                         &material.mapKs,
+                         &material.mapNs,
+                         &material.mapKe,
+                         &material.mapD,
+                         &material.norm,
+                         &material.decal,
+                         &material.disp,
+                         &material.bump,
+                         &material.mapRoughness,
+                         &material.mapMetallic,
+                         &material.mapOpacity,
+                         &material.mapHeight,
+                         &material.mapGlow,
+                         &material.mapTranslucence }) {
+        if (map->image >= 0 && map->image < (int)remap.size()) {
+            map->image = remap[map->image];
+        }
+    }
+}
+
 const TfToken&
 importChannel(ObjMapChannel channel)
 {
@@ -223,7 +250,15 @@ importObj(const ImportObjOptions& options, Obj& obj, UsdData& usd)
                                     VtValue(obj.originalColorSpace));
     }
     if (options.importMaterials) {
+        ProfilePhase materialsPhase("materials");
+        // Identical images referenced under different names are translated only once
+        const std::vector<int> imageRemap = deduplicateImages(obj.images);
+        for (ObjMaterial& material : obj.materials) {
+            remapImages(material, imageRemap);
+        }
         InputTranslator inputTranslator(options.importImages, obj.images, DEBUG_TAG);
+        // Texture translations of all the materials are generated together at the end
+        inputTranslator.beginBatch();
         if (isNativeOpenPbrProcessingEnabled()) {
 
             usd.openPbrMaterials.resize(obj.materials.size());
@@ -371,6 +406,7 @@ importObj(const ImportObjOptions& options, Obj& obj, UsdData& usd)
                 }
             }
         }
+        inputTranslator.endBatch();
         usd.images = std::move(inputTranslator.getImages());
     }
     if (options.importGeometry) {
@@ -27,7 +27,7 @@ void
 ObjResolver::readCache(const std::string& filename, std::vector<ImageAsset>& images)
 {
     Obj obj;
-    readObj(obj, filename, true);
+    readObjMaterials(obj, filename, true);
     UsdData usd;
     ImportObjOptions importOptions;
     importOptions.importGeometry = false;
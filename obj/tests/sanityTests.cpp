@@ -15,10 +15,16 @@ governing permissions and limitations under the License.
 #include <pxr/usd/ar/asset.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 TEST(OBJSanityTests, LoadCube)
@@ -26,3 +32,110 @@ TEST(OBJSanityTests, LoadCube)
     UsdStageRefPtr stage = openAssetStage(assetDir + "SanityCube.obj");
     ASSERT_TRUE(stage);
 }
+
+// Writes `contents` to the file at `path`, creating its parent directories
+static void
+writeTestFile(const std::filesystem::path& path, const std::string& contents)
+{
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+}
+
+// Reads every packaged image referenced by the stage through the package resolver, keyed by the
+// authored asset path.
+static std::map<std::string, std::string>
+readPackagedImages(const UsdStageRefPtr& stage)
+{
+    std::map<std::string, std::string> images;
+    for (const UsdPrim& prim : stage->Traverse()) {
+        for (const UsdAttribute& attr : prim.GetAttributes()) {
+            SdfAssetPath assetPath;
+            if (!attr.Get(&assetPath) ||
+                assetPath.GetResolvedPath().find('[') == std::string::npos) {
+                continue;
+            }
+            std::shared_ptr<ArAsset> asset =
+              ArGetResolver().OpenAsset(ArResolvedPath(assetPath.GetResolvedPath()));
+            if (asset) {
+                std::shared_ptr<const char> buffer = asset->GetBuffer();
+                images[assetPath.GetAssetPath()] =
+                  std::string(buffer.get(), buffer.get() + asset->GetSize());
+            }
+        }
+    }
+    return images;
+}
+
+// The metadata-only read and the package resolver only scan the obj for its material directives.
+// They must find the same material libraries and textures as the full read, with several mtllib
+// lines and paths relative to the obj.
+TEST(OBJSanityTests, MaterialScanMatchesFullRead)
+{
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "objMaterialScan";
+    fs::remove_all(dir);
+
+    // Red and blue 1x1 PNGs
+    const unsigned char redPngBytes[] = {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49,
+        0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02,
+        0x00, 0x00, 0x00, 0x90, 0x77, 0x53, 0xde, 0x00, 0x00, 0x00, 0x0c, 0x49, 0x44,
+        0x41, 0x54, 0x78, 0x9c, 0x63, 0xf8, 0xcf, 0xc0, 0x00, 0x00, 0x03, 0x01, 0x01,
+        0x00, 0xc9, 0xfe, 0x92, 0xef, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+        0xae, 0x42, 0x60, 0x82,
+    };
+    const unsigned char bluePngBytes[] = {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49,
+        0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02,
+        0x00, 0x00, 0x00, 0x90, 0x77, 0x53, 0xde, 0x00, 0x00, 0x00, 0x0c, 0x49, 0x44,
+        0x41, 0x54, 0x78, 0x9c, 0x63, 0x60, 0x60, 0xf8, 0x0f, 0x00, 0x01, 0x03, 0x01,
+        0x00, 0x08, 0x89, 0xc2, 0xec, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+        0xae, 0x42, 0x60, 0x82,
+    };
+    const std::string redPng(reinterpret_cast<const char*>(redPngBytes), sizeof(redPngBytes));
+    const std::string bluePng(reinterpret_cast<const char*>(bluePngBytes), sizeof(bluePngBytes));
+    writeTestFile(dir / "textures" / "red.png", redPng);
+    writeTestFile(dir / "textures" / "blue.png", bluePng);
+    writeTestFile(dir / "red.mtl", "newmtl Red\nKd 1 0 0\nmap_Kd textures/red.png\n");
+    writeTestFile(dir / "materials" / "blue.mtl",
+                  "newmtl Blue\nKd 0 0 1\nmap_Kd textures/blue.png\n");
+    writeTestFile(dir / "MaterialScan.obj",
+                  "mtllib red.mtl\n"
+                  "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                  "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+                  "usemtl Red\nf 1/1 2/2 3/3\n"
+                  "mtllib materials/blue.mtl\n"
+                  "usemtl Blue\nf 1/1 3/3 4/4\n");
+    const std::string objPath = (dir / "MaterialScan.obj").string();
+
+    SdfLayerRefPtr full = SdfLayer::OpenAsAnonymous(objPath);
+    SdfLayerRefPtr metadataOnly = SdfLayer::OpenAsAnonymous(objPath, true);
+    ASSERT_TRUE(full);
+    ASSERT_TRUE(metadataOnly);
+    EXPECT_EQ(metadataOnly->GetCustomLayerData(), full->GetCustomLayerData());
+    const VtValue filenames = full->GetCustomLayerData().GetValueAtPath("filenames");
+    ASSERT_TRUE(filenames.IsHolding<VtStringArray>());
+    std::set<std::string> expectedFilenames = { "MaterialScan.obj",
+                                                "red.mtl",
+                                                "materials/blue.mtl",
+                                                "textures/red.png",
+                                                "textures/blue.png" };
+    const VtStringArray& names = filenames.UncheckedGet<VtStringArray>();
+    EXPECT_EQ(std::set<std::string>(names.begin(), names.end()), expectedFilenames);
+
+    // The images are not populated by the layer read, so the resolver scans the obj to read them
+    UsdStageRefPtr stage = openAssetStage(objPath);
+    ASSERT_TRUE(stage);
+    std::map<std::string, std::string> images = readPackagedImages(stage);
+    ASSERT_EQ(images.size(), 2u);
+    for (const auto& [assetPath, bytes] : images) {
+        if (assetPath.find("red.png") != std::string::npos) {
+            EXPECT_EQ(bytes, redPng) << assetPath;
+        } else {
+            EXPECT_NE(assetPath.find("blue.png"), std::string::npos) << assetPath;
+            EXPECT_EQ(bytes, bluePng) << assetPath;
+        }
+    }
+    fs::remove_all(dir);
+}
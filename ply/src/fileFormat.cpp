@@ -19,6 +19,7 @@ governing permissions and limitations under the License.
 #include <fileformatutils/common.h>
 #include <fileformatutils/layerRead.h>
 #include <fileformatutils/layerWriteSdfData.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/usdData.h>
 
 #include <happly.h>
@@ -31,6 +32,31 @@ governing permissions and limitations under the License.
 using namespace adobe::usd;
 using namespace happly;
 
+namespace {
+
+// Reads the comments of a ply header, stopping at end_header so no element data is parsed
+bool
+readPlyHeaderComments(std::istream& inStream, std::vector<std::string>& comments)
+{
+    std::string line;
+    if (!std::getline(inStream, line) || line.compare(0, 3, "ply") != 0) {
+        return false;
+    }
+    while (std::getline(inStream, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.compare(0, 8, "comment ") == 0) {
+            comments.push_back(line.substr(8));
+        } else if (line.compare(0, 10, "end_header") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(UsdPlyFileFormatTokens, USDPLY_FILE_FORMAT_TOKENS);
@@ -108,6 +134,7 @@ UsdPlyFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool me
     TfStopwatch w;
     w.Start();
     TF_DEBUG_MSG(FILE_FORMAT_PLY, "Read: %s\n", resolvedPath.c_str());
+    ProfileScope profile("ply", "read", resolvedPath);
     std::string fileType = getFileExtension(resolvedPath, DEBUG_TAG);
     SdfAbstractDataRefPtr layerData = InitData(layer->GetFileFormatArguments());
     PlyDataConstPtr data = TfDynamic_cast<const PlyDataConstPtr>(layerData);
@@ -128,9 +155,20 @@ UsdPlyFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool me
         if (!inStream.is_open()) {
             TF_DEBUG_MSG(FILE_FORMAT_PLY, "Failed to open %s\n", resolvedPath.c_str());
         }
-        PLYData ply(inStream);
-
-        GUARD(importPly(options, ply, usd), "Error translating PLY to USD\n");
+        layerOptions.metadataOnly = metadataOnly;
+        if (metadataOnly) {
+            std::vector<std::string> comments;
+            GUARD(readPlyHeaderComments(inStream, comments),
+                  "Failed reading PLY header from %s\n",
+                  resolvedPath.c_str());
+            importPlyMetadata(options, comments, usd);
+        } else {
+            ProfilePhase parsePhase("parse");
+            PLYData ply(inStream);
+            parsePhase.stop();
+            ProfilePhase importPhase("import");
+            GUARD(importPly(options, ply, usd), "Error translating PLY to USD\n");
+        }
         GUARD(
           writeLayer(
             layerOptions, usd, layer, layerData, fileType, DEBUG_TAG, SdfFileFormat::_SetLayerData),
@@ -166,6 +204,7 @@ UsdPlyFileFormat::WriteToFile(const SdfLayer& layer,
 {
     TfStopwatch w;
     w.Start();
+    ProfileScope profile("ply", "write", filename);
     UsdData usd;
     PLYData ply;
     ReadLayerOptions layerOptions;
@@ -175,7 +214,10 @@ UsdPlyFileFormat::WriteToFile(const SdfLayer& layer,
     SdfAbstractDataRefPtr layerData = InitData(layer.GetFileFormatArguments());
     PlyDataConstPtr data = TfDynamic_cast<const PlyDataConstPtr>(layerData);
     GUARD(readLayer(layerOptions, layer, usd, DEBUG_TAG), "Error reading USD\n");
+    ProfilePhase exportPhase("export");
     GUARD(exportPly(usd, ply), "Error translating USD to PLY\n");
+    exportPhase.stop();
+    ProfilePhase writePhase("write");
     try {
         // TODO: pass file format argument to select binary/ascii
         const std::string parentPath = TfGetPathName(filename);
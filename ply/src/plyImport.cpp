@@ -87,6 +87,40 @@ private:
 };
 } // namespace
 
+void
+importPlyMetadata(const ImportPlyOptions& options,
+                  const std::vector<std::string>& comments,
+                  UsdData& usd)
+{
+    usd.metersPerUnit = 1.0f;
+    if (options.importWithUpAxisCorrection) {
+        // We filter out useful convention info from the comment.
+        bool useZup = false;
+
+        // The input source is probably Z-up if the comment contains these words.
+        const std::vector<std::regex> zUpTokens = { std::regex("\\bZ-axis up\\b"),
+                                                    std::regex("\\bBlender\\b"),
+                                                    std::regex("\\bArtec\\b"),
+                                                    std::regex("\\bRhinoceros\\b") };
+
+        for (const std::string& comment : comments) {
+            if (!useZup) {
+                for (const std::regex& pattern : zUpTokens) {
+                    if (std::regex_search(comment, pattern)) {
+                        useZup = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (useZup)
+            usd.upAxis = UsdGeomTokens->z;
+        else
+            usd.upAxis = UsdGeomTokens->y;
+    }
+}
+
 bool
 importPly(const ImportPlyOptions& options, PLYData& ply, UsdData& usd)
 {
@@ -440,33 +474,7 @@ importPly(const ImportPlyOptions& options, PLYData& ply, UsdData& usd)
     auto [nodeIndex, node] = usd.addNode(-1);
     node.staticMeshes.push_back(meshIndex);
 
-    usd.metersPerUnit = 1.0f;
-    if (options.importWithUpAxisCorrection) {
-        // We filter out useful convention info from the comment.
-        bool useZup = false;
-
-        // The input source is probably Z-up if the comment contains these words.
-        const std::vector<std::regex> zUpTokens = { std::regex("\\bZ-axis up\\b"),
-                                                    std::regex("\\bBlender\\b"),
-                                                    std::regex("\\bArtec\\b"),
-                                                    std::regex("\\bRhinoceros\\b") };
-
-        for (const std::string& comment : ply.comments) {
-            if (!useZup) {
-                for (const std::regex& pattern : zUpTokens) {
-                    if (std::regex_search(comment, pattern)) {
-                        useZup = true;
-                        break;
-                    }
-                }
-            }
-        }
-
-        if (useZup)
-            usd.upAxis = UsdGeomTokens->z;
-        else
-            usd.upAxis = UsdGeomTokens->y;
-    }
+    importPlyMetadata(options, ply.comments, usd);
 
     if (mesh.asGsplats && options.importGsplatClippingBox.size() >= 6) {
         PXR_NS::GfVec3f minPos(std::numeric_limits<float>::max());
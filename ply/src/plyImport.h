@@ -23,6 +23,13 @@ struct ImportPlyOptions
     float pointWidth = 0.01f;
 };
 
+/// \ingroup usdply
+/// \brief Import the layer metadata of a ply, which only depends on the header `comments`.
+void
+importPlyMetadata(const ImportPlyOptions& options,
+                  const std::vector<std::string>& comments,
+                  UsdData& usd);
+
 /// \ingroup usdply
 /// \brief Import ply data into a USD data cache.
 bool
@@ -18,6 +18,7 @@ governing permissions and limitations under the License.
 #include <fileformatutils/common.h>
 #include <fileformatutils/layerRead.h>
 #include <fileformatutils/layerWriteSdfData.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/usdData.h>
 
 #include <load-spz.h>
@@ -101,6 +102,7 @@ UsdSpzFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool me
     TfStopwatch w;
     w.Start();
     TF_DEBUG_MSG(FILE_FORMAT_SPZ, "Read: %s\n", resolvedPath.c_str());
+    ProfileScope profile("spz", "read", resolvedPath);
     std::string fileType = getFileExtension(resolvedPath, DEBUG_TAG);
     SdfAbstractDataRefPtr layerData = InitData(layer->GetFileFormatArguments());
     SpzDataConstPtr data = TfDynamic_cast<const SpzDataConstPtr>(layerData);
@@ -119,8 +121,19 @@ UsdSpzFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool me
         // the loader will convert from that source system to the target system specified here.
         unpackOptions.to = importSpzOptions.importGsplatWithZup ? spz::CoordinateSystem::RFU
                                                                 : spz::CoordinateSystem::RUB;
-        GaussianCloud gaussianCloud = loadSpz(resolvedPath, unpackOptions);
-        GUARD(importSpz(importSpzOptions, gaussianCloud, usd), "Error translating SPZ to USD\n");
+        layerOptions.metadataOnly = metadataOnly;
+        if (metadataOnly) {
+            // The layer metadata doesn't depend on the splats, so don't decompress them
+            GUARD(TfIsFile(resolvedPath), "Failed opening SPZ file: %s\n", resolvedPath.c_str());
+            importSpzMetadata(importSpzOptions, usd);
+        } else {
+            ProfilePhase parsePhase("parse");
+            GaussianCloud gaussianCloud = loadSpz(resolvedPath, unpackOptions);
+            parsePhase.stop();
+            ProfilePhase importPhase("import");
+            GUARD(importSpz(importSpzOptions, gaussianCloud, usd),
+                  "Error translating SPZ to USD\n");
+        }
         GUARD(
           writeLayer(
             layerOptions, usd, layer, layerData, fileType, DEBUG_TAG, SdfFileFormat::_SetLayerData),
@@ -147,6 +160,7 @@ UsdSpzFileFormat::WriteToFile(const SdfLayer& layer,
 {
     TfStopwatch w;
     w.Start();
+    ProfileScope profile("spz", "write", filename);
     UsdData usd;
     GaussianCloud gaussianCloud;
     ReadLayerOptions layerOptions;
@@ -156,7 +170,10 @@ UsdSpzFileFormat::WriteToFile(const SdfLayer& layer,
     SdfAbstractDataRefPtr layerData = InitData(layer.GetFileFormatArguments());
     SpzDataConstPtr data = TfDynamic_cast<const SpzDataConstPtr>(layerData);
     GUARD(readLayer(layerOptions, layer, usd, DEBUG_TAG), "Error reading USD\n");
+    ProfilePhase exportPhase("export");
     GUARD(exportSpz(usd, gaussianCloud), "Error translating USD to SPZ\n");
+    exportPhase.stop();
+    ProfilePhase writePhase("write");
     try {
         const std::string parentPath = TfGetPathName(filename);
         TfMakeDirs(parentPath, -1, true);
@@ -29,6 +29,13 @@ using namespace PXR_NS;
 using namespace spz;
 
 namespace adobe::usd {
+void
+importSpzMetadata(const ImportSpzOptions& options, UsdData& usd)
+{
+    usd.metersPerUnit = 1.0f;
+    usd.upAxis = options.importGsplatWithZup ? UsdGeomTokens->z : UsdGeomTokens->y;
+}
+
 bool
 importSpz(const ImportSpzOptions& options, const spz::GaussianCloud& gaussianCloud, UsdData& usd)
 {
@@ -131,8 +138,7 @@ importSpz(const ImportSpzOptions& options, const spz::GaussianCloud& gaussianClo
     auto [nodeIndex, node] = usd.addNode(-1);
     node.staticMeshes.push_back(meshIndex);
 
-    usd.metersPerUnit = 1.0f;
-    usd.upAxis = options.importGsplatWithZup ? UsdGeomTokens->z : UsdGeomTokens->y;
+    importSpzMetadata(options, usd);
 
     if (options.importGsplatClippingBox.size() >= 6) {
         PXR_NS::GfVec3f minPos(std::numeric_limits<float>::max());
@@ -21,6 +21,11 @@ struct ImportSpzOptions
     PXR_NS::VtFloatArray importGsplatClippingBox = { -2.0, -2.0, -2.0, 2.0, 2.0, 2.0 };
 };
 
+/// \ingroup usdspz
+/// \brief Import the layer metadata of a spz, which only depends on the import `options`.
+void
+importSpzMetadata(const ImportSpzOptions& options, UsdData& usd);
+
 /// \ingroup usdspz
 /// \brief Import spz data into a USD data cache.
 bool
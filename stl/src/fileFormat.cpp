@@ -19,6 +19,7 @@ governing permissions and limitations under the License.
 #include <fileformatutils/common.h>
 #include <fileformatutils/layerRead.h>
 #include <fileformatutils/layerWriteSdfData.h>
+#include <fileformatutils/profiling.h>
 
 #include <pxr/base/arch/fileSystem.h>
 #include <pxr/usd/usdGeom/tokens.h>
@@ -125,6 +126,7 @@ UsdStlFileFormat::CanRead(const std::string& filePath) const
 bool
 UsdStlFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool metadataOnly) const
 {
+    ProfileScope profile("stl", "read", resolvedPath);
     UsdData usd;
 
     // Note, the STL format doesn't actually prescribe an up-axis. But many STL files out there,
@@ -133,12 +135,28 @@ UsdStlFileFormat::Read(SdfLayer* layer, const std::string& resolvedPath, bool me
     usd.upAxis = UsdGeomTokens->z;
 
     SdfAbstractDataRefPtr layerData(new SdfData());
-    StlModel stlModel;
-    stlModel.Read(resolvedPath);
     std::string fileType = getFileExtension(resolvedPath, DEBUG_TAG);
-    GUARD(stlModel.Populated(), "Failed opening STL file: %s \n", resolvedPath.c_str());
-    GUARD(importStl(usd, stlModel), "Error translating STL to USD\n");
     WriteLayerOptions layerOptions;
+    layerOptions.metadataOnly = metadataOnly;
+    // The STL layer data has no common settings, so read the one argument that applies here
+    argReadBool(layer->GetFileFormatArguments(),
+                "writeProfileStats",
+                layerOptions.writeProfileStats,
+                DEBUG_TAG);
+    if (metadataOnly) {
+        // The layer metadata doesn't depend on the facets, so don't read them
+        GUARD(std::ifstream(resolvedPath, std::ios::binary).is_open(),
+              "Failed opening STL file: %s \n",
+              resolvedPath.c_str());
+    } else {
+        ProfilePhase parsePhase("parse");
+        StlModel stlModel;
+        stlModel.Read(resolvedPath);
+        GUARD(stlModel.Populated(), "Failed opening STL file: %s \n", resolvedPath.c_str());
+        parsePhase.stop();
+        ProfilePhase importPhase("import");
+        GUARD(importStl(usd, stlModel), "Error translating STL to USD\n");
+    }
     GUARD(writeLayer(
             layerOptions, usd, layer, layerData, fileType, DEBUG_TAG, SdfFileFormat::_SetLayerData),
           "Error writing to the USD layer\n");
@@ -166,6 +184,7 @@ UsdStlFileFormat::WriteToFile(const SdfLayer& layer,
                               const FileFormatArguments& args) const
 {
     TfStopwatch watch;
+    ProfileScope profile("stl", "write", filename);
     UsdData usd;
     StlModel stl;
     ReadLayerOptions layerOptions;
@@ -174,12 +193,16 @@ UsdStlFileFormat::WriteToFile(const SdfLayer& layer,
     layerOptions.ignoreInvisible = true;
     GUARD(readLayer(layerOptions, layer, usd, DEBUG_TAG), "Error reading USD\n");
     ExportStlOptions options;
+    ProfilePhase exportPhase("export");
     GUARD(exportStl(options, usd, stl), "Error translating USD to STL\n");
+    exportPhase.stop();
     StlFormat format = readStlExportFormat(usd);
     TF_DEBUG_MSG(
       FILE_FORMAT_STL, "START time: %ld\n", static_cast<long int>(watch.GetMilliseconds()));
     watch.Start();
+    ProfilePhase writePhase("write");
     GUARD(stl.Write(filename, format), "Error writing STL to %s\n", filename.c_str());
+    writePhase.stop();
     watch.Stop();
     TF_DEBUG_MSG(
       FILE_FORMAT_STL, "WRITE time: %ld\n", static_cast<long int>(watch.GetMilliseconds()));
@@ -10,24 +10,45 @@ OF ANY KIND, either express or implied. See the License for the specific languag
 governing permissions and limitations under the License.
 */
 #pragma once
+#include "api.h"
 #include "pxr/usd/ar/packageResolver.h"
 #include "usdData.h"
+#include <chrono>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace adobe::usd {
 
 // Structure to represent asset mapping information.
+// An AssetMap is immutable once it has been published in the cache. Updates build a new map and
+// swap it in, so readers holding an AssetMapConstPtr never observe a partially written map.
 struct AssetMap
 {
     std::chrono::time_point<std::chrono::steady_clock> creationTime;
 
+    // total size in bytes of the cached assets
+    size_t byteSize = 0;
+
     // mapping of asset path to ArAsset (ie ImageArAsset)
     std::unordered_map<std::string, std::shared_ptr<PXR_NS::ArAsset>> assets;
 };
 
+using AssetMapConstPtr = std::shared_ptr<const AssetMap>;
+
 // Singleton class for managing asset caching.
-class AssetCacheSingleton
+//
+// Locking is done per package: the cache-wide mutex only guards the lookup table and is never
+// held while a plugin's readCache runs. Each package entry has its own load mutex, so unrelated
+// packages populate concurrently, while concurrent requests for the same package wait for a
+// single parse. Lookups of packages that are already populated never wait on a load.
+//
+// The total size of the cached assets can be bounded with the
+// USD_FILEFORMATS_PACKAGE_RESOLVER_CACHE_MAX_MB env setting. When the budget is exceeded, the least
+// recently opened packages are evicted first.
+class USDFFUTILS_API AssetCacheSingleton
 {
 public:
     static AssetCacheSingleton& getInstance()
@@ -43,20 +64,70 @@ public:
     // clear the cache for a specific package
     void clearCache(const std::string& resolvedPackagePath);
 
-    // add images to the asset cache
-    void populateCache(const std::string& resolvedPackagePath, std::vector<ImageAsset>&& images);
+    // add images to the asset cache, and return the resulting asset map of the package. The
+    // cached assets of replacedUris are dropped, for images that supersede them.
+    AssetMapConstPtr populateCache(const std::string& resolvedPackagePath,
+                                   std::vector<ImageAsset>&& images,
+                                   const std::vector<std::string>& replacedUris = {});
+
+    // total size in bytes of all cached assets
+    size_t getCacheByteSize();
+
+    // set the byte budget of the cache, 0 disables the limit. Defaults to the value of the
+    // USD_FILEFORMATS_PACKAGE_RESOLVER_CACHE_MAX_MB env setting.
+    void setMaxByteSize(size_t maxBytes);
 
-    // acquire the asset map for a specific package
-    AssetMap* acquireAssetMap(
+    // acquire the asset map for a specific package, calling readCache to fill it if the package
+    // is not cached yet. Returns nullptr only if the package could not be cached.
+    AssetMapConstPtr acquireAssetMap(
       const std::string& resolvedPackagePath,
       const std::string& resolvedPackagedPath,
       std::stringstream& ss,
       std::function<void(const std::string&, std::vector<adobe::usd::ImageAsset>&)> readCache);
 
 private:
-    AssetCacheSingleton() = default;
-    std::recursive_mutex mAssetCacheMutex;
-    std::unordered_map<std::string, AssetMap> mAssetCache;
+    // Cache slot for one package. The slot is created before the package is read so that other
+    // threads asking for the same package can wait on mLoadMutex instead of reading it again.
+    struct CacheEntry
+    {
+        // Serializes readCache for this package only
+        std::mutex loadMutex;
+
+        // Published asset map, null until the package has been read or populated.
+        // Guarded by AssetCacheSingleton::mAssetCacheMutex.
+        AssetMapConstPtr assetMap;
+
+        // Last time the package was opened, used for LRU eviction.
+        // Guarded by AssetCacheSingleton::mAssetCacheMutex.
+        std::chrono::time_point<std::chrono::steady_clock> lastAccessTime;
+    };
+
+    AssetCacheSingleton();
+
+    // Return the published asset map of an entry under the cache-wide lock, and mark the entry as
+    // used when it has one
+    AssetMapConstPtr getAssetMap(const std::shared_ptr<CacheEntry>& entry);
+
+    // Merge assetMap with the assets already published for the entry and publish the result.
+    // With overrideExisting, assets of assetMap replace cached assets with the same uri. Cached
+    // assets of replacedUris are not kept. Evicts other packages if the cache exceeds its budget.
+    // Must be called with mAssetCacheMutex held.
+    AssetMapConstPtr publishAssetMap(const std::string& resolvedPackagePath,
+                                     const std::shared_ptr<CacheEntry>& entry,
+                                     std::shared_ptr<AssetMap>&& assetMap,
+                                     bool overrideExisting,
+                                     const std::vector<std::string>& replacedUris = {});
+
+    // Evict least recently opened packages, other than excludedPath, until the cache fits its
+    // byte budget. Must be called with mAssetCacheMutex held.
+    void evictToBudgetExcluding(const std::string& excludedPath);
+
+    // Guards mAssetCache and CacheEntry::assetMap. Never held while reading a package.
+    std::mutex mAssetCacheMutex;
+    std::unordered_map<std::string, std::shared_ptr<CacheEntry>> mAssetCache;
+
+    // Byte budget of the cache, 0 if unbounded. Guarded by mAssetCacheMutex.
+    size_t mMaxBytes = 0;
 };
 
-} // namespace adobe::usd
\ No newline at end of file
+} // namespace adobe::usd
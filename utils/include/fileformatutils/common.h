@@ -414,6 +414,12 @@ argReadBool(const PXR_NS::SdfFileFormat::FileFormatArguments& args,
             bool& target,
             const std::string& debugTag);
 
+bool USDFFUTILS_API
+argReadInt(const PXR_NS::SdfFileFormat::FileFormatArguments& args,
+           const std::string& arg,
+           int& target,
+           const std::string& debugTag);
+
 bool USDFFUTILS_API
 argReadFloat(const PXR_NS::SdfFileFormat::FileFormatArguments& args,
              const std::string& arg,
@@ -19,7 +19,7 @@ governing permissions and limitations under the License.
 /// These use OpenUSD's TfEnvSetting to allow toggling behavior at runtime via
 /// environment variables, without requiring a separate branch or recompilation.
 ///
-/// There are two categories of flags:
+/// The flags fall into these categories:
 ///
 ///   1. Material model configuration -- controls which material representations
 ///      are written by default. These are not experimental; they are stable
@@ -28,6 +28,12 @@ governing permissions and limitations under the License.
 ///   2. Native OpenPBR processing -- controls whether importers and exporters
 ///      use OpenPbrMaterial directly or go through the ASM conversion layer.
 ///
+///   3. Package resolver cache -- bounds the memory held by the images of
+///      imported packages.
+///
+///   4. Texture disk cache -- configures where and how much of the textures
+///      generated by the material translation are kept across imports.
+///
 /// === Adding a new feature flag ===
 ///
 /// 1. Declare the flag in this header (inside PXR_NAMESPACE):
@@ -97,6 +103,32 @@ extern PXR_NS::TfEnvSetting<bool> USD_FILEFORMATS_WRITE_OPENPBR;
 /// while this flag controls *how* it is processed.
 extern PXR_NS::TfEnvSetting<bool> USD_FILEFORMATS_NATIVE_OPENPBR_PROCESSING;
 
+// ---------------------------------------------------------------------------
+// Package resolver cache
+//
+// These bound the memory used by the images the package resolvers keep for
+// imported layers.
+// ---------------------------------------------------------------------------
+
+/// Maximum size in megabytes of the image bytes held by the package resolver
+/// cache. When exceeded, the least recently opened packages are evicted.
+/// 0 disables the limit.
+extern PXR_NS::TfEnvSetting<int> USD_FILEFORMATS_PACKAGE_RESOLVER_CACHE_MAX_MB;
+
+// ---------------------------------------------------------------------------
+// Texture disk cache
+//
+// These configure the local directory where the textures generated by the
+// material translation are kept across imports.
+// ---------------------------------------------------------------------------
+
+/// Directory of the texture disk cache. Empty disables the cache.
+extern PXR_NS::TfEnvSetting<std::string> USD_FILEFORMATS_TEXTURE_CACHE_DIR;
+
+/// Maximum size in megabytes of the files in the texture disk cache. When
+/// exceeded, the least recently used textures are removed. 0 disables the limit.
+extern PXR_NS::TfEnvSetting<int> USD_FILEFORMATS_TEXTURE_CACHE_MAX_MB;
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 namespace adobe::usd {
@@ -113,6 +145,21 @@ isNativeOpenPbrProcessingEnabled();
 USDFFUTILS_API bool
 isWriteAsmEnabled();
 
+/// Returns the byte budget of the package resolver cache derived from
+/// USD_FILEFORMATS_PACKAGE_RESOLVER_CACHE_MAX_MB, or 0 if the cache is unbounded.
+USDFFUTILS_API size_t
+getPackageResolverCacheMaxBytes();
+
+/// Returns the directory of the texture disk cache from
+/// USD_FILEFORMATS_TEXTURE_CACHE_DIR, or an empty string if the cache is disabled.
+USDFFUTILS_API std::string
+getTextureCacheDirectory();
+
+/// Returns the byte budget of the texture disk cache derived from
+/// USD_FILEFORMATS_TEXTURE_CACHE_MAX_MB, or 0 if the cache is unbounded.
+USDFFUTILS_API size_t
+getTextureCacheMaxBytes();
+
 /// Query whether a specific feature flag is enabled.
 /// Wraps TfGetEnvSetting for a consistent, readable call site.
 template<class T>
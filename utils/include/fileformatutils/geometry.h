@@ -12,8 +12,15 @@ governing permissions and limitations under the License.
 #pragma once
 #include "usdData.h"
 
+#include <pxr/base/work/loops.h>
+
 namespace adobe::usd {
 
+/// \ingroup utils_geometry
+/// \brief Number of elements up to which the geometry functions process a mesh serially. Larger
+/// meshes are split into ranges of this many elements, that are processed concurrently.
+static constexpr size_t kGeometryParallelGrainSize = 1 << 15;
+
 // Struct that holds information about found issues in the scene
 struct Issue
 {
@@ -127,13 +134,24 @@ expandIndexedValues(const PXR_NS::VtIntArray& indices, PXR_NS::VtArray<T>& value
         const size_t size = indices.size();
         const int tempSize = temp.size();
         values.resize(size);
-        for (size_t i = 0; i < size; i++) {
-            int index = indices[i];
-            if (index < 0 || index >= tempSize) {
-                // set invalid indices to 0
-                index = 0;
+        // Take the pointers up front, so the workers don't race on the copy-on-write checks
+        const int* indexData = indices.cdata();
+        const T* src = temp.cdata();
+        T* dst = values.data();
+        auto expand = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                int index = indexData[i];
+                if (index < 0 || index >= tempSize) {
+                    // set invalid indices to 0
+                    index = 0;
+                }
+                dst[i] = src[index];
             }
-            values[i] = temp[index];
+        };
+        if (size <= kGeometryParallelGrainSize) {
+            expand(0, size);
+        } else {
+            PXR_NS::WorkParallelForN(size, expand, kGeometryParallelGrainSize);
         }
     }
 }
@@ -12,6 +12,7 @@ governing permissions and limitations under the License.
 #pragma once
 
 #include "usdData.h"
+#include <pxr/base/gf/half.h>
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/matrix4f.h>
 #include <pxr/base/gf/quath.h>
@@ -22,14 +23,32 @@ governing permissions and limitations under the License.
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdShade/material.h>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace adobe::usd {
 
 /// \ingroup utils_materials
-/// \brief Handles image data and stores it as R8G8B8A8 integer data.
-/// It uses malloc/free to be compatible with stb.
-/// Might be able to replace by OpenImageIO, which USD also depends on.
+/// \brief Storage type of the pixel values of an Image. Integer values are normalized, so 255 and
+/// 65535 are 1.0.
+enum class ImagePixelType
+{
+    UInt8,
+    UInt16,
+    Half,
+    Float
+};
+
+/// \ingroup utils_materials
+/// \brief Size in bytes of one value of the pixel type
+USDFFUTILS_API size_t
+getPixelTypeSize(ImagePixelType pixelType);
+
+/// \ingroup utils_materials
+/// \brief Handles decoded image data, with interleaved channels. Pixels are stored as float, or
+/// in their source type when read with keepPixelType, in which case they are only converted to
+/// float by the operations that need it.
 ///
 class USDFFUTILS_API Image
 {
@@ -37,7 +56,11 @@ public:
     int width;
     int height;
     int channels;
+    /// Storage type of the pixel values. Float pixels are stored in `pixels`, all other types in
+    /// `nativePixels`, and the other vector is empty.
+    ImagePixelType pixelType;
     std::vector<float> pixels;
+    std::vector<uint8_t> nativePixels;
 
     /// No allocation of image data is done yet at construction.
     Image();
@@ -49,12 +72,17 @@ public:
     bool isEmpty() const { return width == 0 || height == 0 || channels == 0; }
 
     /// Allocates memory for the pixel image data with dimensions \p width x \p height x \p
-    /// channels. Rejects a zero dimension or a width*height*channels product too large to fit
-    /// back in a signed int, leaving the image empty and returning false.
-    bool allocate(unsigned int width, unsigned int height, unsigned int channels);
+    /// channels, stored as \p pixelType. Rejects a zero dimension or a width*height*channels
+    /// product too large to fit back in a signed int, leaving the image empty and returning false.
+    bool allocate(unsigned int width,
+                  unsigned int height,
+                  unsigned int channels,
+                  ImagePixelType pixelType = ImagePixelType::Float);
 
     /// Reads image data from an ImageAsset (which holds an encoded image like jpg, pgn, bmp, ...).
-    bool read(const ImageAsset& imageAsset, int forceChannels = -1);
+    /// By default the pixels are converted to float. With \p keepPixelType, 8 bit, 16 bit and half
+    /// float images keep their source type, and only other types are converted to float.
+    bool read(const ImageAsset& imageAsset, int forceChannels = -1, bool keepPixelType = false);
 
     /// Writes image data to an ImageAsset (The encoding type needs to have been specified on the
     /// asset)
@@ -73,9 +101,42 @@ public:
                           float bias,
                           int channelDst);
 
-    /// Set RGBA values to the image if it has storage allocated.
+    /// Set RGBA values to the image if it has storage allocated. Converts the image to float.
     void set(float r, float g, float b, float a);
 
+    /// Converts the pixels to float storage, if they are not already stored as float
+    void convertToFloat();
+
+    /// Number of values in the image, ie width * height * channels
+    size_t getValueCount() const { return static_cast<size_t>(width) * height * channels; }
+
+    /// Reads \p count values starting at value \p offset, converted to float, into \p dst
+    void getFloatValues(size_t offset, size_t count, float* dst) const;
+
+    /// The pixel values if they are stored as \p T, or nullptr otherwise. \p T is one of
+    /// uint8_t, uint16_t, PXR_NS::GfHalf or float.
+    template<typename T>
+    T* getPixels()
+    {
+        return const_cast<T*>(std::as_const(*this).getPixels<T>());
+    }
+
+    template<typename T>
+    const T* getPixels() const
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return pixelType == ImagePixelType::Float ? pixels.data() : nullptr;
+        } else {
+            static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> ||
+                            std::is_same_v<T, PXR_NS::GfHalf>,
+                          "Unsupported pixel type");
+            constexpr ImagePixelType type = std::is_same_v<T, uint8_t>    ? ImagePixelType::UInt8
+                                             : std::is_same_v<T, uint16_t> ? ImagePixelType::UInt16
+                                                                           : ImagePixelType::Half;
+            return pixelType == type ? reinterpret_cast<const T*>(nativePixels.data()) : nullptr;
+        }
+    }
+
     /// Get the min and max values for the pixels in the image
     /// If min is larger than max for a channel, the channel did not exist
     std::pair<PXR_NS::GfVec4f, PXR_NS::GfVec4f> computeRange() const;
@@ -93,15 +154,95 @@ imageTransformAffine(const Image& in, float scale, float bias, Image& out);
 
 /// \ingroup utils_materials
 /// \brief Apply scale/bias transform to a single channel of source image and store in single
-/// channel output image
+/// channel output image. Without a scale or bias the output keeps the pixel type of the source.
 USDFFUTILS_API bool
 imageExtractChannel(const Image& in, int channelSrc, float scale, float bias, Image& out);
 
+/// \ingroup utils_materials
+/// \brief How imageDownsample filters the pixels, depending on what the image encodes
+enum class ImageDownsampleMode
+{
+    /// Averages the values as they are, for linear data like roughness or occlusion
+    Linear,
+    /// Averages the color channels in linear space, converting them from srgb and back. Alpha,
+    /// the 2nd channel of 2 channel images and the 4th of 4 channel images, is averaged as is.
+    Srgb,
+    /// Averages tangent space normals encoded as [0,1] colors, and renormalizes the result
+    Normal
+};
+
+/// \ingroup utils_materials
+/// \brief Reduces the resolution of an image by an integer \p factor, averaging each block of
+/// factor x factor pixels into one. Blocks at the right and bottom edges average the pixels they
+/// cover. The output is stored as float.
+USDFFUTILS_API bool
+imageDownsample(const Image& in,
+                int factor,
+                Image& out,
+                ImageDownsampleMode mode = ImageDownsampleMode::Linear);
+
 /// \ingroup utils_materials
 /// \brief Writes the ImageAsset object to file. Used for debugging.
 USDFFUTILS_API void
 imageWrite(const ImageAsset& image, const std::string& filename, bool overwrite = false);
 
+/// \ingroup utils_materials
+/// \brief Merges the image assets with identical encoded bytes, keeping the first of each in
+/// place of the others. Returns the new index of every original image, to remap references with.
+/// Assets without bytes, for example when images aren't read, are never merged.
+USDFFUTILS_API std::vector<int>
+deduplicateImages(std::vector<ImageAsset>& images);
+
+/// \ingroup utils_materials
+/// \brief Reads the dimensions and channel count of an encoded image from its header, without
+/// decoding the pixels
+USDFFUTILS_API bool
+readImageInfo(const ImageAsset& imageAsset, int& width, int& height, int& channels);
+
+/// \ingroup utils_materials
+/// \brief The uri of the proxy of the image at \p uri, for a maximum size of \p maxSize. For
+/// example "textures/wood.proxy512.png" for "textures/wood.png". The srgb and normal modes are
+/// recorded as an "s" or "n" suffix of the size, as in "textures/wood.proxy512s.png", so that a
+/// proxy regenerated from its uri alone is filtered the same way.
+USDFFUTILS_API std::string
+getProxyImageUri(const std::string& uri,
+                 int maxSize,
+                 ImageDownsampleMode mode = ImageDownsampleMode::Linear);
+
+/// \ingroup utils_materials
+/// \brief Extracts the uri of the original image, the maximum size and the downsample mode from
+/// the uri of a proxy. Returns false if \p proxyUri isn't one.
+USDFFUTILS_API bool
+parseProxyImageUri(const std::string& proxyUri,
+                   std::string& uri,
+                   int& maxSize,
+                   ImageDownsampleMode& mode);
+
+/// \ingroup utils_materials
+/// \brief parseProxyImageUri, ignoring the downsample mode
+USDFFUTILS_API bool
+parseProxyImageUri(const std::string& proxyUri, std::string& uri, int& maxSize);
+
+/// \ingroup utils_materials
+/// \brief Generates a reduced resolution proxy of an encoded image, with neither dimension larger
+/// than \p maxSize. The resolution is halved as many times as needed, like the levels of a mip
+/// chain, with imageDownsample in the given \p mode. The proxy keeps the format of the image and
+/// gets the uri from getProxyImageUri. Returns false if the image already fits, or can't be read.
+USDFFUTILS_API bool
+makeProxyImage(const ImageAsset& image,
+               int maxSize,
+               ImageAsset& proxy,
+               ImageDownsampleMode mode = ImageDownsampleMode::Linear);
+
+/// \ingroup utils_materials
+/// \brief Replaces the images larger than \p maxSize by their proxies, in parallel. Image i is
+/// downsampled in \p modes[i], or in the linear mode if \p modes doesn't cover it. Returns the
+/// number of images replaced.
+USDFFUTILS_API size_t
+makeProxyImages(std::vector<ImageAsset>& images,
+                int maxSize,
+                const std::vector<ImageDownsampleMode>& modes = {});
+
 /// \ingroup utils_materials
 /// \brief Assigns a PXR_NS::VtArray to a std::vector.
 /// Makes debugging VtArray contents easier, since VtArrays are not inspectable in debugger, but
@@ -123,6 +264,31 @@ srgbToLinear(float s);
 USDFFUTILS_API float
 linearToSRGB(float s);
 
+/// \ingroup utils_materials
+/// \brief Converts \p count srgb components to linear, in place. Components in [0, 1] are
+/// interpolated in a table, within 5e-7 of srgbToLinear(float), and others are converted exactly.
+USDFFUTILS_API void
+srgbToLinear(float* values, size_t count);
+
+/// \ingroup utils_materials
+/// \brief Converts \p count linear components to srgb, in place. Components in [0, 1] are
+/// interpolated in a table, within 5e-6 of linearToSRGB(float), and others are converted exactly.
+USDFFUTILS_API void
+linearToSRGB(float* values, size_t count);
+
+/// \ingroup utils_materials
+/// \brief Converts \p channelCount channels of an image, starting at \p firstChannel, from
+/// srgb to linear. The image is converted to float. 8 and 16 bit images are converted exactly,
+/// with a table of all their values, and float images as srgbToLinear(float*, size_t) does.
+USDFFUTILS_API bool
+imageSrgbToLinear(Image& image, int firstChannel, int channelCount);
+
+/// \ingroup utils_materials
+/// \brief Converts \p channelCount channels of an image, starting at \p firstChannel, from
+/// linear to srgb, as linearToSRGB(float*, size_t) does. The image is converted to float.
+USDFFUTILS_API bool
+imageLinearToSRGB(Image& image, int firstChannel, int channelCount);
+
 /// \ingroup utils_materials
 /// \brief Is the resolved asset path a supported image file
 bool USDFFUTILS_API
@@ -49,6 +49,8 @@ struct USDFFUTILS_API ReadLayerContext
     std::unordered_map<std::string, int> ngps;
     std::vector<std::string> materialBindings;
     std::vector<std::vector<std::string>> subsetMaterialBindings;
+    // Meshes that are triangulated once all prims are read, when the triangulate option is set
+    std::vector<int> meshesToTriangulate;
     PXR_NS::UsdGeomXformCache xformCache;
     std::string debugTag;
     bool warnAboutMissingAssets = true;
@@ -17,6 +17,7 @@ governing permissions and limitations under the License.
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/abstractData.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/types.h>
 
 #include <unordered_map>
 
@@ -34,6 +35,8 @@ struct WriteLayerOptions
       , writeOpenPBR(fileFormatData.writeOpenPBR)
       , preserveExtraMaterialInfo(fileFormatData.preserveExtraMaterialInfo)
       , assetsPath(fileFormatData.assetsPath)
+      , writeProfileStats(fileFormatData.writeProfileStats)
+      , maxTextureSize(fileFormatData.maxTextureSize)
     {}
 
     bool writeUsdPreviewSurface = true;
@@ -43,7 +46,23 @@ struct WriteLayerOptions
     bool pruneJoints = false;
     bool animationTracks = false;
     bool createRenderSettingsPrim = false;
+    // Only author the layer metadata and the default prim, as for SdfFileFormat::Read calls with
+    // metadataOnly set. Materials, nodes, skeletons and images are not written.
+    bool metadataOnly = false;
     std::string assetsPath;
+    // Author the stats of the current ProfileScope in the layer custom data, under
+    // kProfileStatsCustomDataKey
+    bool writeProfileStats = false;
+    // Replace the images larger than this by reduced resolution proxies, 0 keeps them as they are
+    int maxTextureSize = 0;
+};
+
+// The time samples of the transform of an animated node
+struct NodeTimeSamples
+{
+    PXR_NS::SdfTimeSampleMap translations;
+    PXR_NS::SdfTimeSampleMap rotations;
+    PXR_NS::SdfTimeSampleMap scales;
 };
 
 struct WriteSdfContext
@@ -58,6 +77,11 @@ struct WriteSdfContext
     PXR_NS::SdfPathVector meshPrototypeMap;
     PXR_NS::SdfPathVector lightMap;
 
+    // Values that are computed for all meshes and nodes concurrently, before the specs are
+    // authored on one thread. Indexed like the meshes and nodes of the UsdData.
+    std::vector<PXR_NS::VtVec3fArray> meshExtents;
+    std::vector<NodeTimeSamples> nodeTimeSamples;
+
     // Per-parent registry of already-used child prim names, keyed by parent prim path. Used to
     // uniquify node names at write time against siblings the import-time uniquify pass cannot see
     // (e.g. the synthesized "Materials" scope). Routes through UniqueNameEnforcer ->
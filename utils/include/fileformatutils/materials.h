@@ -20,7 +20,11 @@ governing permissions and limitations under the License.
 #include "images.h"
 #include "usdData.h"
 
+#include <functional>
+
 namespace adobe::usd {
+class TextureDiskCache;
+
 /// \ingroup utils_materials
 /// \brief Translates textures and values for material import/export.
 ///
@@ -35,6 +39,13 @@ namespace adobe::usd {
 /// * each Input<T> might be sourced by a texture or by values, this class translates accordingly
 /// * cache any generated textures, and route new textures accordingly in the output Inputs<T>
 /// * actually generating image data is optional.
+///
+/// Generating images can be batched, so that the textures of all the materials of an asset are
+/// decoded and computed concurrently rather than one after another. See beginBatch().
+///
+/// Generated images are also looked up in, and added to, the TextureDiskCache when one is
+/// configured, so that importing the same asset again doesn't compute them again. Intermediate
+/// images are never stored there, but the images generated from them are.
 class USDFFUTILS_API InputTranslator
 {
 public:
@@ -46,6 +57,21 @@ public:
 
     ~InputTranslator();
 
+    /// Starts deferring the generation of images. Until endBatch(), translations compute their
+    /// output Inputs, cache keys and image indices exactly as they would otherwise, but only
+    /// reserve the images they generate. Output images stay empty until endBatch().
+    void beginBatch();
+
+    /// Generates the images deferred since beginBatch(). The source images they read are decoded
+    /// concurrently, then the images are computed and encoded in parallel. Images that depend on
+    /// intermediate images of the batch are generated after them. Returns false if an image
+    /// couldn't be generated, in which case its asset is left empty.
+    bool endBatch();
+
+    /// Looks up and stores the generated images in `cache`, instead of the cache configured by the
+    /// env settings. nullptr disables the disk cache.
+    void setTextureDiskCache(TextureDiskCache* cache) { mDiskCache = cache; }
+
     /// Generates an output value that is the same as the input value.
     bool translateDirect(const Input& in, Input& out, bool intermediate = false);
 
@@ -183,14 +209,16 @@ public:
     /// Get the i-th output image.
     const ImageAsset& getImage(int i) const;
 
-    /// Get the output images.
+    /// Get the output images. Generates any images of a batch that hasn't ended yet.
     std::vector<ImageAsset>& getImages();
 
     /// Get the name of an image source
     std::string getImageSourceName(int index) const;
 
-    // First term is false if image couldn't be decoded
-    std::pair<bool, Image&> getDecodedImage(int index);
+    // First term is false if image couldn't be decoded. Images are decoded in their source pixel
+    // type, and converted to float when floatPixels is set, for operations that need it. During a
+    // batch, the deferred images are generated first if the image is one of them.
+    std::pair<bool, Image&> getDecodedImage(int index, bool floatPixels = true);
 
     int addImage(Image&& image,
                  const std::string& assetName,
@@ -207,8 +235,71 @@ private:
     std::vector<bool> mDecodedMap;
     std::vector<ImageAsset> mImagesDst;
 
+    /// Image generation deferred by a batch
+    struct _BatchJob
+    {
+        std::vector<std::pair<int, bool>> reads; ///< Source images decoded first, and as float.
+        int intermediate = -1;                   ///< Source image produced, if intermediate.
+        std::function<bool()> run;               ///< Generates the image into its reserved slot.
+    };
+    bool mBatching = false;
+    std::vector<_BatchJob> mBatchJobs;
+    std::vector<char> mPendingImages; // Source images that are produced by a queued job
+
+    TextureDiskCache* mDiskCache = nullptr;
+    // Content hashes of the source images, that key the disk cache entries generated from them.
+    // Computed when first needed, or set to the disk cache key of the job producing an
+    // intermediate image.
+    std::vector<std::string> mImageHashes;
+
     int addImage(ImageAsset&& image);
 
+    // Reserves an output image, that is generated later
+    int reserveImage(const std::string& assetName, const std::string& assetUri, ImageFormat format);
+
+    // Adds the image computed by `produce`, which reads the source images in `reads` (index, as
+    // float) through getDecodedImage. In a batch the image is reserved and computed in endBatch(),
+    // otherwise it's computed now and -1 is returned if `produce` fails. With a `diskKey`, from
+    // getDiskCacheKey, an output image is read from the disk cache instead when it's there, and
+    // stored to it after it's computed otherwise.
+    int addImageJob(std::vector<std::pair<int, bool>> reads,
+                    std::function<bool(Image&)> produce,
+                    const std::string& assetName,
+                    const std::string& assetUri,
+                    ImageFormat format,
+                    bool intermediate,
+                    const std::string& diskKey);
+
+    // Key of the disk cache entry of an image generated as described by `description`, from the
+    // source images in `sources`. Negative indices are skipped. Empty when the disk cache is
+    // disabled, images aren't exported, or a source image has no content to hash.
+    std::string getDiskCacheKey(const std::string& description, const std::vector<int>& sources);
+
+    // Hash of the encoded bytes of a source image, or of the pixels of a decoded intermediate one.
+    // Empty if the image has neither.
+    const std::string& getImageContentHash(int index);
+
+    // Reads an output image from the disk cache, and adds it. Returns -1 if it isn't there.
+    int readDiskCacheImage(const std::string& diskKey,
+                           const std::string& assetName,
+                           const std::string& assetUri,
+                           ImageFormat format);
+
+    // Queues a job of the current batch
+    void queueJob(_BatchJob&& job);
+
+    // Runs the jobs queued so far. Returns false if any failed.
+    bool runBatchJobs();
+
+    bool isPendingImage(int index) const
+    {
+        return index >= 0 && index < (int)mPendingImages.size() && mPendingImages[index];
+    }
+
+    // Number of channels of a source image, read from the encoded header when it isn't decoded
+    // yet. Returns -1 if the image can't be read.
+    int getImageChannels(int index);
+
     // Translate an input value directly to an output value. Helper function can be reused by
     // different translate functions regardless of which Input objects those take
     void translateDirectInternal(int imageIdx, Input& out);
@@ -0,0 +1,156 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#pragma once
+#include "api.h"
+#include "usdData.h"
+
+#include <pxr/base/tf/stopwatch.h>
+#include <pxr/base/vt/dictionary.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace adobe::usd {
+
+/// \ingroup utils_profiling
+/// \brief Phase durations and counters recorded for one import or export.
+///
+/// Phase names are nested with '/', so "import/materials" is the part of "import" spent on
+/// materials. Durations are inclusive of the nested phases. Phases and counters are listed in the
+/// order they were first recorded.
+struct USDFFUTILS_API ProfileStats
+{
+    std::string plugin;    // For example "gltf"
+    std::string operation; // "read" or "write"
+    std::string path;      // The resolved path of the file read or written
+    double totalMs = 0.0;
+    std::vector<std::pair<std::string, double>> phases;
+    std::vector<std::pair<std::string, int64_t>> counters;
+
+    /// Accumulated duration of a phase in milliseconds, 0 if it was never recorded
+    double getPhaseMs(const std::string& name) const;
+
+    /// Value of a counter, 0 if it was never recorded
+    int64_t getCounter(const std::string& name) const;
+
+    /// The stats as a dictionary, as authored in the layer custom data
+    PXR_NS::VtDictionary toDictionary() const;
+};
+
+/// \ingroup utils_profiling
+/// \brief Collects the stats of one plugin import or export for its lifetime.
+///
+/// While the scope is alive, ProfilePhase and profileAddCounter on the same thread record into it.
+/// On destruction the stats are added to a registry of recent stats, that can be queried with
+/// getProfileStats. Scopes can nest, for example when a plugin opens another layer, and the inner
+/// scope then collects independently of the outer one.
+class USDFFUTILS_API ProfileScope
+{
+public:
+    ProfileScope(const std::string& plugin,
+                 const std::string& operation,
+                 const std::string& path);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    /// The innermost scope alive on the calling thread, or nullptr
+    static ProfileScope* current();
+
+    /// Accumulates `ms` into the phase `name`
+    void addPhase(const std::string& name, double ms);
+
+    /// Adds `value` to the counter `name`
+    void addCounter(const std::string& name, int64_t value);
+
+    /// The stats recorded so far, with the total time elapsed until now
+    ProfileStats snapshot() const;
+
+private:
+    ProfileStats mStats;
+    PXR_NS::TfStopwatch mWatch;
+    ProfileScope* mPreviousScope;
+    std::string mPreviousPrefix;
+};
+
+/// \ingroup utils_profiling
+/// \brief Times a phase of the current ProfileScope, from construction until stop() or
+/// destruction. Phases constructed within this one are nested under its name.
+///
+/// Phases are expected to end in the reverse order they started, as they do when scoped. When no
+/// scope is active on the calling thread, this does nothing.
+class USDFFUTILS_API ProfilePhase
+{
+public:
+    explicit ProfilePhase(const char* name);
+    ~ProfilePhase();
+
+    ProfilePhase(const ProfilePhase&) = delete;
+    ProfilePhase& operator=(const ProfilePhase&) = delete;
+
+    /// Ends the phase early. Further calls, and the destructor, do nothing.
+    void stop();
+
+private:
+    ProfileScope* mScope;
+    std::string mName;
+    std::string mPreviousPrefix;
+    PXR_NS::TfStopwatch mWatch;
+};
+
+/// \ingroup utils_profiling
+/// \brief Adds `value` to a counter of the ProfileScope active on the calling thread, if any.
+USDFFUTILS_API void
+profileAddCounter(const std::string& name, int64_t value);
+
+/// \ingroup utils_profiling
+/// \brief Adds element counts of `data` (meshes, points, materials, images, ...) to the counters
+/// of the ProfileScope active on the calling thread, if any.
+USDFFUTILS_API void
+profileAddUsdDataCounters(const UsdData& data);
+
+/// \ingroup utils_profiling
+/// \brief Copies the stats recorded so far by the ProfileScope active on the calling thread, with
+/// the total time elapsed until now. Returns false if there is no such scope.
+USDFFUTILS_API bool
+getCurrentProfileStats(ProfileStats& stats);
+
+/// \ingroup utils_profiling
+/// \brief The stats of the most recent imports and exports, oldest first. Only the last
+/// kMaxRecordedProfileStats are kept.
+USDFFUTILS_API std::vector<ProfileStats>
+getProfileStats();
+
+/// \ingroup utils_profiling
+/// \brief The stats of the most recent import or export of `path`. An empty `operation` matches
+/// any operation. Returns false if no stats are recorded for it.
+USDFFUTILS_API bool
+getLatestProfileStats(const std::string& path,
+                      ProfileStats& stats,
+                      const std::string& operation = std::string());
+
+/// \ingroup utils_profiling
+/// \brief Forgets all recorded stats
+USDFFUTILS_API void
+clearProfileStats();
+
+/// Number of stats kept by the registry of recent stats
+static constexpr size_t kMaxRecordedProfileStats = 64;
+
+/// Key of the stats dictionary in the layer custom data, when the "writeProfileStats" file format
+/// argument is set
+static constexpr const char* kProfileStatsCustomDataKey = "fileFormatsProfileStats";
+
+}
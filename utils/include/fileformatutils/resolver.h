@@ -13,6 +13,7 @@ governing permissions and limitations under the License.
 #include "api.h"
 #include "usdData.h"
 #include <pxr/usd/ar/packageResolver.h>
+#include <pxr/usd/ar/threadLocalScopedCache.h>
 
 namespace adobe::usd {
 
@@ -26,6 +27,9 @@ namespace adobe::usd {
 ///    matches them to asset paths as needed. The exact mechanism on how to fill this image cache
 ///    is delegated to the 'readCache' function, specific to each SdfFileFormat plugin from (1).
 ///
+/// Inside a resolver cache scope, the asset maps of the packages opened so far are pinned by the
+/// scope, so repeated OpenAsset calls for the same package skip the shared asset cache entirely.
+///
 class USDFFUTILS_API Resolver : public PXR_NS::ArPackageResolver
 {
 public:
@@ -55,8 +59,14 @@ protected:
                            std::vector<ImageAsset>& images) = 0;
 
 private:
+    // Asset maps of the packages opened within a resolver cache scope
+    struct ScopedCache;
+    using ThreadLocalScopedCaches = PXR_NS::ArThreadLocalScopedCache<ScopedCache>;
+
     // Name of resolver
     std::string mName;
+
+    ThreadLocalScopedCaches mScopedCaches;
 };
 
 }
\ No newline at end of file
@@ -374,6 +374,10 @@ public:
     bool writeOpenPBR = false;
     bool preserveExtraMaterialInfo = true;
     std::string assetsPath;
+    // Author the profiling stats of the read in the layer custom data
+    bool writeProfileStats = false;
+    // Serve reduced resolution proxies of the images larger than this, 0 keeps the full resolution
+    int maxTextureSize = 0;
 
     /// Parse common settings from the file format arguments
     void parseFromFileFormatArgs(const SdfLayer::FileFormatArguments& args,
@@ -0,0 +1,94 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#pragma once
+#include "api.h"
+#include "usdData.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace adobe::usd {
+
+/// \ingroup utils_materials
+/// \brief Persistent cache of the images generated by InputTranslator, kept as encoded files in a
+/// local directory.
+///
+/// Entries are keyed by a hash of the translation and the content of its source images, so they
+/// stay valid across processes and machines sharing the directory. Files are written to a
+/// temporary name and renamed, so concurrent readers never see a partial entry. When the entries
+/// exceed the byte budget, the least recently used ones are removed first. Only files named like
+/// an entry are counted and removed, other files in the directory are left alone, except for the
+/// temporary files of entries that were never renamed, for example by a writer that crashed.
+///
+/// The shared instance is configured by the USD_FILEFORMATS_TEXTURE_CACHE_DIR and
+/// USD_FILEFORMATS_TEXTURE_CACHE_MAX_MB env settings, and is disabled when no directory is set.
+class USDFFUTILS_API TextureDiskCache
+{
+public:
+    /// A cache in `directory`, bounded to `maxBytes`. An empty directory disables the cache, and a
+    /// budget of 0 leaves it unbounded.
+    TextureDiskCache(const std::string& directory, size_t maxBytes);
+
+    TextureDiskCache(const TextureDiskCache&) = delete;
+    TextureDiskCache& operator=(const TextureDiskCache&) = delete;
+
+    /// The cache configured by the env settings
+    static TextureDiskCache& getInstance();
+
+    /// Key of an entry, from a description of the translation that includes the content hashes of
+    /// its source images
+    static std::string makeKey(const std::string& description);
+
+    bool isEnabled() const { return !mDirectory.empty(); }
+    const std::string& getDirectory() const { return mDirectory; }
+    size_t getMaxByteSize() const { return mMaxBytes; }
+
+    /// Sets the encoded bytes of `image` from the entry `key`, in the format of `image`. Returns
+    /// false if there is no such entry.
+    bool read(const std::string& key, ImageAsset& image);
+
+    /// Stores the encoded bytes of `image` as the entry `key`
+    bool write(const std::string& key, const ImageAsset& image);
+
+    /// Total size in bytes of the entries in the cache directory
+    size_t computeByteSize() const;
+
+    /// Size in bytes of the entries as tracked by the writes of this process, without scanning the
+    /// directory. 0 until the first write to a bounded cache.
+    size_t getTrackedByteSize();
+
+private:
+    std::string getEntryPath(const std::string& key, ImageFormat format) const;
+
+    // Removes the least recently used entries until the files fit the budget, after the stale
+    // temporary files. Must be called with mMutex held.
+    void evictToBudget();
+
+    // Removes the temporary files old enough that their writer can't be renaming them anymore
+    void removeStaleTemporaryFiles();
+
+    std::string mDirectory;
+    size_t mMaxBytes;
+
+    // Guards mByteSize. Known after the first write, and then kept up to date with the writes of
+    // this process, so the directory is only scanned again when the budget seems exceeded.
+    std::mutex mMutex;
+    size_t mByteSize = 0;
+    bool mByteSizeKnown = false;
+
+    // Whether failing to create the directory was reported, so it's only reported once
+    std::atomic<bool> mDirectoryWarned{ false };
+};
+
+}
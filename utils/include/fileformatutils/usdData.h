@@ -34,6 +34,8 @@ governing permissions and limitations under the License.
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdShade/material.h>
+#include <initializer_list>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -86,6 +88,7 @@ struct USDFFUTILS_API Node
     int camera = -1;
     int ngp = -1;
     int light = -1;
+    int pointInstancer = -1;
     std::vector<int> nurbs = {};
     std::vector<int> staticMeshes = {};
     std::vector<std::pair<int, std::vector<int>>> skinnedMeshes = {}; // Only used during export
@@ -99,6 +102,26 @@ struct USDFFUTILS_API Node
     PXR_NS::VtDictionary customProperties;
 };
 
+/// \ingroup utils_nodes
+/// \brief Name of the prim under a UsdGeomPointInstancer that holds the meshes of its prototype
+constexpr const char* kPointInstancerPrototypeName = "Prototype";
+
+/// \ingroup utils_nodes
+/// \brief Instances of a group of meshes, written as a UsdGeomPointInstancer under its node.
+///
+/// The meshes form a single prototype that is placed once per instance, with transforms relative
+/// to the node. `positions` holds a value per instance, while `orientations` and `scales` are
+/// either empty or hold a value per instance as well.
+struct USDFFUTILS_API PointInstancer
+{
+    std::string name;
+    std::string displayName;
+    std::vector<int> meshes;
+    PXR_NS::VtVec3fArray positions;
+    PXR_NS::VtQuathArray orientations;
+    PXR_NS::VtVec3fArray scales;
+};
+
 /// \ingroup utils_geometry
 /// \brief Camera data
 struct USDFFUTILS_API Camera
@@ -301,6 +324,44 @@ enum USDFFUTILS_API ImageFormat
     ImageFormatHdr,
 };
 
+/// Immutable, reference counted bytes of an encoded image. Copies share the same bytes, so an
+/// image can be passed around UsdData, the material translation and the resolver cache without
+/// duplicating it. New contents are assigned as a whole, usually by moving a vector in.
+class USDFFUTILS_API ImageBuffer
+{
+public:
+    ImageBuffer() = default;
+
+    /// Takes ownership of the bytes, without copying them
+    ImageBuffer(std::vector<uint8_t>&& bytes);
+
+    /// Copies the bytes
+    ImageBuffer(const std::vector<uint8_t>& bytes);
+    ImageBuffer(std::initializer_list<uint8_t> bytes);
+    ImageBuffer(const uint8_t* data, size_t size);
+
+    /// Shares a buffer owned elsewhere, for example by an ArAsset. `data` must stay valid and
+    /// unchanged for as long as the shared pointer is held.
+    ImageBuffer(std::shared_ptr<const uint8_t> data, size_t size);
+
+    const uint8_t* data() const { return mData.get(); }
+    size_t size() const { return mSize; }
+    bool empty() const { return mSize == 0; }
+    uint8_t operator[](size_t i) const { return mData.get()[i]; }
+    const uint8_t* begin() const { return data(); }
+    const uint8_t* end() const { return data() + mSize; }
+
+    /// The bytes, keeping them alive for as long as the pointer is held
+    const std::shared_ptr<const uint8_t>& getShared() const { return mData; }
+
+    /// Whether both buffers share the same bytes
+    bool sharesWith(const ImageBuffer& other) const { return mData == other.mData; }
+
+private:
+    std::shared_ptr<const uint8_t> mData;
+    size_t mSize = 0;
+};
+
 struct USDFFUTILS_API ImageAsset
 {
     // name acts like a display name, whereas uri is the string used in brackets in unresolved USD
@@ -308,7 +369,7 @@ struct USDFFUTILS_API ImageAsset
     std::string name;
     std::string uri;
     ImageFormat format = ImageFormatUnknown;
-    std::vector<uint8_t> image;
+    ImageBuffer image;
 };
 USDFFUTILS_API ImageFormat
 getFormat(const std::string& extension);
@@ -586,6 +647,7 @@ struct USDFFUTILS_API UsdData
     std::vector<OpenPbrMaterial> openPbrMaterials;
     std::vector<Skeleton> skeletons;
     std::vector<NgpData> ngps;
+    std::vector<PointInstancer> pointInstancers;
 
     std::pair<int, Node&> addNode(int parent);
     std::pair<int, Node&> getParent(int parent);
@@ -604,6 +666,7 @@ struct USDFFUTILS_API UsdData
     std::pair<int, Camera&> addCamera();
     std::pair<int, Skeleton&> addSkeleton();
     std::pair<int, NgpData&> addNgp();
+    std::pair<int, PointInstancer&> addPointInstancer();
 };
 
 // Returns true if the Input has a constant value of supported type
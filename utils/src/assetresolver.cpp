@@ -11,6 +11,7 @@ governing permissions and limitations under the License.
 */
 #include <fileformatutils/assetresolver.h>
 #include <fileformatutils/debugCodes.h>
+#include <fileformatutils/featureFlags.h>
 #include <pxr/usd/ar/asset.h>
 
 #include <algorithm>
@@ -25,17 +26,18 @@ namespace adobe::usd {
 class ImageArAsset : public ArAsset
 {
 public:
-    explicit ImageArAsset(const std::vector<uint8_t>&& data)
+    explicit ImageArAsset(const ImageBuffer& data)
       : _data(data) {};
-    const std::vector<uint8_t>& getData() const { return _data; }
+    const ImageBuffer& getData() const { return _data; }
     virtual size_t GetSize() const override { return _data.size(); }
 
 private:
-    std::vector<uint8_t> _data;
+    // Shared with the ImageAsset it was made from, and with the buffers returned by GetBuffer()
+    ImageBuffer _data;
 
     virtual std::shared_ptr<const char> GetBuffer() const override
     {
-        return std::shared_ptr<const char>((const char*)_data.data(), [](const char*) {});
+        return std::reinterpret_pointer_cast<const char>(_data.getShared());
     }
 
     virtual size_t Read(void* buffer, size_t count, size_t offset) const override
@@ -55,19 +57,156 @@ private:
     }
 };
 
+namespace {
+
+// Wrap the encoded bytes of each image into an ImageArAsset keyed by the image uri
+void
+addImageAssets(AssetMap& assetMap, std::vector<ImageAsset>&& images)
+{
+    for (auto& imageAsset : images) {
+        assetMap.assets[imageAsset.uri] =
+          std::make_shared<ImageArAsset>(imageAsset.image);
+    }
+}
+
+size_t
+computeByteSize(const AssetMap& assetMap)
+{
+    size_t byteSize = 0;
+    for (const auto& [uri, asset] : assetMap.assets) {
+        byteSize += asset ? asset->GetSize() : 0;
+    }
+    return byteSize;
+}
+
+}
+
+AssetCacheSingleton::AssetCacheSingleton()
+  : mMaxBytes(getPackageResolverCacheMaxBytes())
+{}
+
+AssetMapConstPtr
+AssetCacheSingleton::getAssetMap(const std::shared_ptr<CacheEntry>& entry)
+{
+    std::lock_guard<std::mutex> lock(mAssetCacheMutex);
+    if (entry->assetMap) {
+        entry->lastAccessTime = std::chrono::steady_clock::now();
+    }
+    return entry->assetMap;
+}
+
+AssetMapConstPtr
+AssetCacheSingleton::publishAssetMap(const std::string& resolvedPackagePath,
+                                     const std::shared_ptr<CacheEntry>& entry,
+                                     std::shared_ptr<AssetMap>&& assetMap,
+                                     bool overrideExisting,
+                                     const std::vector<std::string>& replacedUris)
+{
+    auto currentTime = std::chrono::steady_clock::now();
+    if (entry->assetMap) {
+        assetMap->creationTime = entry->assetMap->creationTime;
+        for (const auto& [uri, asset] : entry->assetMap->assets) {
+            if (std::find(replacedUris.begin(), replacedUris.end(), uri) != replacedUris.end()) {
+                continue;
+            }
+            if (overrideExisting) {
+                assetMap->assets.insert({ uri, asset });
+            } else {
+                assetMap->assets[uri] = asset;
+            }
+        }
+    } else {
+        assetMap->creationTime = currentTime;
+    }
+    assetMap->byteSize = computeByteSize(*assetMap);
+    entry->assetMap = std::move(assetMap);
+    entry->lastAccessTime = currentTime;
+
+    AssetMapConstPtr published = entry->assetMap;
+    evictToBudgetExcluding(resolvedPackagePath);
+    return published;
+}
+
+void
+AssetCacheSingleton::evictToBudgetExcluding(const std::string& excludedPath)
+{
+    if (mMaxBytes == 0) {
+        return;
+    }
+
+    size_t totalBytes = 0;
+    std::vector<std::unordered_map<std::string, std::shared_ptr<CacheEntry>>::iterator> evictable;
+    for (auto it = mAssetCache.begin(); it != mAssetCache.end(); ++it) {
+        const AssetMapConstPtr& assetMap = it->second->assetMap;
+        if (!assetMap) {
+            continue;
+        }
+        totalBytes += assetMap->byteSize;
+        if (it->first != excludedPath) {
+            evictable.push_back(it);
+        }
+    }
+    if (totalBytes <= mMaxBytes) {
+        return;
+    }
+
+    // Evict the least recently opened packages first until the cache fits the budget again. The
+    // package that was just published is kept, even if it exceeds the budget on its own.
+    std::sort(evictable.begin(), evictable.end(), [](const auto& a, const auto& b) {
+        return a->second->lastAccessTime < b->second->lastAccessTime;
+    });
+    for (auto& it : evictable) {
+        if (totalBytes <= mMaxBytes) {
+            break;
+        }
+        TF_DEBUG_MSG(UTIL_PACKAGE_RESOLVER,
+                     "Evicting cached items for package '%s' (%zu KB) to fit budget of %zu KB\n",
+                     it->first.c_str(),
+                     it->second->assetMap->byteSize >> 10,
+                     mMaxBytes >> 10);
+        totalBytes -= it->second->assetMap->byteSize;
+        mAssetCache.erase(it);
+    }
+}
+
+size_t
+AssetCacheSingleton::getCacheByteSize()
+{
+    std::lock_guard<std::mutex> lock(mAssetCacheMutex);
+    size_t totalBytes = 0;
+    for (const auto& [path, entry] : mAssetCache) {
+        totalBytes += entry->assetMap ? entry->assetMap->byteSize : 0;
+    }
+    return totalBytes;
+}
+
+void
+AssetCacheSingleton::setMaxByteSize(size_t maxBytes)
+{
+    std::lock_guard<std::mutex> lock(mAssetCacheMutex);
+    mMaxBytes = maxBytes;
+    evictToBudgetExcluding(std::string());
+}
+
 void
 AssetCacheSingleton::garbageCollectCacheExcluding(const std::string& excludedPath)
 {
     using namespace std::chrono_literals;
 
     auto currentTime = std::chrono::steady_clock::now();
-    std::lock_guard<std::recursive_mutex> lock(mAssetCacheMutex);
+    std::lock_guard<std::mutex> lock(mAssetCacheMutex);
 
-    // Garbage collect entries in the cache older than 60 seconds
+    // Garbage collect entries in the cache older than 60 seconds. Entries that are still being
+    // read have no asset map yet and are left alone.
     for (auto it = mAssetCache.begin(); it != mAssetCache.end();) {
+        const AssetMapConstPtr& assetMap = it->second->assetMap;
+        if (!assetMap || it->first == excludedPath) {
+            ++it;
+            continue;
+        }
         std::chrono::seconds timePassed =
-          std::chrono::duration_cast<std::chrono::seconds>(currentTime - it->second.creationTime);
-        if (timePassed > 60s && it->first != excludedPath) {
+          std::chrono::duration_cast<std::chrono::seconds>(currentTime - assetMap->creationTime);
+        if (timePassed > 60s) {
             TF_DEBUG_MSG(
               UTIL_PACKAGE_RESOLVER, "Removing cached items for package '%s'\n", it->first.c_str());
             it = mAssetCache.erase(it);
@@ -80,59 +219,81 @@ AssetCacheSingleton::garbageCollectCacheExcluding(const std::string& excludedPat
 void
 AssetCacheSingleton::clearCache(const std::string& resolvedPackagePath)
 {
-    std::lock_guard lock(mAssetCacheMutex);
+    std::lock_guard<std::mutex> lock(mAssetCacheMutex);
     mAssetCache.erase(resolvedPackagePath);
 }
 
-void
+AssetMapConstPtr
 AssetCacheSingleton::populateCache(const std::string& resolvedPackagePath,
-                                   std::vector<ImageAsset>&& images)
+                                   std::vector<ImageAsset>&& images,
+                                   const std::vector<std::string>& replacedUris)
 {
-    std::lock_guard<std::recursive_mutex> lock(mAssetCacheMutex);
+    // Build the new assets outside of the lock, they are merged into a copy of the current map
+    auto assetMap = std::make_shared<AssetMap>();
+    addImageAssets(*assetMap, std::move(images));
 
-    auto it = mAssetCache.find(resolvedPackagePath);
-    AssetMap& assetMap = mAssetCache[resolvedPackagePath];
-    if (it == mAssetCache.end()) {
-        assetMap.creationTime = std::chrono::steady_clock::now();
-    }
-    for (auto& imageAsset : images) {
-        assetMap.assets[imageAsset.uri] =
-          std::make_shared<ImageArAsset>(std::move(imageAsset.image));
+    std::lock_guard<std::mutex> lock(mAssetCacheMutex);
+    std::shared_ptr<CacheEntry>& slot = mAssetCache[resolvedPackagePath];
+    if (!slot) {
+        slot = std::make_shared<CacheEntry>();
     }
+    // Newly populated assets replace previously cached ones with the same uri
+    std::shared_ptr<CacheEntry> entry = slot;
+    return publishAssetMap(resolvedPackagePath, entry, std::move(assetMap), true, replacedUris);
 }
 
-AssetMap*
+AssetMapConstPtr
 AssetCacheSingleton::acquireAssetMap(
   const std::string& resolvedPackagePath,
   const std::string& resolvedPackagedPath,
   std::stringstream& ss,
   std::function<void(const std::string&, std::vector<adobe::usd::ImageAsset>&)> readCache)
 {
-    AssetMap* assetMap = nullptr;
-    std::lock_guard<std::recursive_mutex> lock(mAssetCacheMutex);
+    std::shared_ptr<CacheEntry> entry;
+    {
+        std::lock_guard<std::mutex> lock(mAssetCacheMutex);
+        std::shared_ptr<CacheEntry>& slot = mAssetCache[resolvedPackagePath];
+        if (!slot) {
+            slot = std::make_shared<CacheEntry>();
+        } else if (slot->assetMap) {
+            TF_DEBUG_MSG(UTIL_PACKAGE_RESOLVER,
+                         "%s: %p::%s Cached file",
+                         resolvedPackagedPath.c_str(),
+                         this,
+                         ss.str().c_str());
+            slot->lastAccessTime = std::chrono::steady_clock::now();
+            return slot->assetMap;
+        }
+        entry = slot;
+    }
 
-    auto it = mAssetCache.find(resolvedPackagePath);
-    if (it != mAssetCache.end()) {
+    // Only requests for this package wait here. If another thread read the package while we were
+    // waiting, its result is used instead of reading the package again.
+    std::lock_guard<std::mutex> loadLock(entry->loadMutex);
+    if (AssetMapConstPtr assetMap = getAssetMap(entry)) {
         TF_DEBUG_MSG(UTIL_PACKAGE_RESOLVER,
                      "%s: %p::%s Cached file",
                      resolvedPackagedPath.c_str(),
                      this,
                      ss.str().c_str());
-        assetMap = &it->second;
-    } else {
-        TF_DEBUG_MSG(UTIL_PACKAGE_RESOLVER,
-                     "%s: %p::%s Open file %s\n",
-                     resolvedPackagedPath.c_str(),
-                     this,
-                     ss.str().c_str(),
-                     resolvedPackagePath.c_str());
-        std::vector<adobe::usd::ImageAsset> images;
-        readCache(resolvedPackagePath, images); // to be defined in each plugin
-
-        populateCache(resolvedPackagePath, std::move(images));
-        assetMap = &mAssetCache[resolvedPackagePath];
+        return assetMap;
     }
-    return assetMap;
+
+    TF_DEBUG_MSG(UTIL_PACKAGE_RESOLVER,
+                 "%s: %p::%s Open file %s\n",
+                 resolvedPackagedPath.c_str(),
+                 this,
+                 ss.str().c_str(),
+                 resolvedPackagePath.c_str());
+    std::vector<adobe::usd::ImageAsset> images;
+    readCache(resolvedPackagePath, images); // to be defined in each plugin
+
+    auto assetMap = std::make_shared<AssetMap>();
+    addImageAssets(*assetMap, std::move(images));
+
+    // If the layer populated the cache while we were reading, its assets take precedence
+    std::lock_guard<std::mutex> lock(mAssetCacheMutex);
+    return publishAssetMap(resolvedPackagePath, entry, std::move(assetMap), false);
 }
 
 } // namespace adobe::usd
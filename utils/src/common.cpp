@@ -27,6 +27,7 @@ governing permissions and limitations under the License.
 #include <locale>
 #include <regex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -179,6 +180,32 @@ argReadBool(const PXR_NS::SdfFileFormat::FileFormatArguments& args,
     return false;
 }
 
+bool
+argReadInt(const PXR_NS::SdfFileFormat::FileFormatArguments& args,
+           const std::string& arg,
+           int& target,
+           const std::string& debugTag)
+{
+    if (const auto& it = args.find(arg); it != args.end()) {
+        try {
+            target = std::stoi(it->second);
+        } catch (const std::exception&) {
+            TF_WARN("%s: Invalid int arg: \"%s\" = \"%s\"",
+                    debugTag.c_str(),
+                    arg.c_str(),
+                    it->second.c_str());
+            return false;
+        }
+        TF_DEBUG_MSG(FILE_FORMAT_UTIL,
+                     "%s: Read int arg: \"%s\" = \"%s\"\n",
+                     debugTag.c_str(),
+                     arg.c_str(),
+                     it->second.c_str());
+        return true;
+    }
+    return false;
+}
+
 bool
 argReadFloat(const PXR_NS::SdfFileFormat::FileFormatArguments& args,
              const std::string& arg,
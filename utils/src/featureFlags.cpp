@@ -47,6 +47,18 @@ TF_DEFINE_ENV_SETTING(USD_FILEFORMATS_NATIVE_OPENPBR_PROCESSING,
                       (bool)(USD_FILEFORMATS_DEFAULT_NATIVE_OPENPBR_PROCESSING),
                       "Enable native OpenPBR processing code paths");
 
+TF_DEFINE_ENV_SETTING(USD_FILEFORMATS_PACKAGE_RESOLVER_CACHE_MAX_MB,
+                      0,
+                      "Maximum size in MB of the package resolver image cache (0 = unlimited)");
+
+TF_DEFINE_ENV_SETTING(USD_FILEFORMATS_TEXTURE_CACHE_DIR,
+                      "",
+                      "Directory of the translated texture disk cache (empty = disabled)");
+
+TF_DEFINE_ENV_SETTING(USD_FILEFORMATS_TEXTURE_CACHE_MAX_MB,
+                      1024,
+                      "Maximum size in MB of the translated texture disk cache (0 = unlimited)");
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 namespace adobe::usd {
@@ -68,6 +80,27 @@ isWriteAsmEnabled()
     return PXR_NS::TfGetEnvSetting(PXR_NS::USD_FILEFORMATS_WRITE_ASM);
 }
 
+size_t
+getPackageResolverCacheMaxBytes()
+{
+    const int maxMB =
+      PXR_NS::TfGetEnvSetting(PXR_NS::USD_FILEFORMATS_PACKAGE_RESOLVER_CACHE_MAX_MB);
+    return maxMB > 0 ? static_cast<size_t>(maxMB) << 20 : 0;
+}
+
+std::string
+getTextureCacheDirectory()
+{
+    return PXR_NS::TfGetEnvSetting(PXR_NS::USD_FILEFORMATS_TEXTURE_CACHE_DIR);
+}
+
+size_t
+getTextureCacheMaxBytes()
+{
+    const int maxMB = PXR_NS::TfGetEnvSetting(PXR_NS::USD_FILEFORMATS_TEXTURE_CACHE_MAX_MB);
+    return maxMB > 0 ? static_cast<size_t>(maxMB) << 20 : 0;
+}
+
 void
 warnOnceOnDeprecatedMaterialSettings(bool writeASM, bool writeUsdPreviewSurface)
 {
@@ -13,10 +13,76 @@ governing permissions and limitations under the License.
 
 #include <fileformatutils/debugCodes.h>
 
+#include <numeric>
+
 using namespace PXR_NS;
 
 namespace adobe::usd {
 
+namespace {
+
+// Number of chunks forEachChunk splits n elements into. At least 1, so per-chunk results can
+// always be sized with it.
+size_t
+chunkCount(size_t n)
+{
+    return std::max<size_t>(1, (n + kGeometryParallelGrainSize - 1) / kGeometryParallelGrainSize);
+}
+
+// Calls fn(chunk, begin, end) for consecutive ranges of [0, n) of kGeometryParallelGrainSize
+// elements, concurrently if there is more than one. The ranges only depend on n, so results that
+// are collected per chunk and merged in chunk order don't depend on the scheduling.
+template<typename Fn>
+void
+forEachChunk(size_t n, const Fn& fn)
+{
+    const size_t numChunks = chunkCount(n);
+    if (numChunks == 1) {
+        fn(0, 0, n);
+        return;
+    }
+    WorkParallelForN(numChunks, [&](size_t firstChunk, size_t lastChunk) {
+        for (size_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+            const size_t begin = chunk * kGeometryParallelGrainSize;
+            fn(chunk, begin, std::min(begin + kGeometryParallelGrainSize, n));
+        }
+    });
+}
+
+// Appends per-chunk results in chunk order
+template<typename T, typename Container>
+void
+appendChunks(const std::vector<std::vector<T>>& chunks, Container& out)
+{
+    for (const std::vector<T>& chunk : chunks) {
+        for (const T& value : chunk) {
+            out.push_back(value);
+        }
+    }
+}
+
+// The offset of the first face vertex of each chunk of faces
+std::vector<size_t>
+chunkFaceVertexOffsets(const VtIntArray& faceVertexCounts)
+{
+    const int* counts = faceVertexCounts.cdata();
+    std::vector<size_t> offsets(chunkCount(faceVertexCounts.size()), 0);
+    forEachChunk(faceVertexCounts.size(), [&](size_t chunk, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            offsets[chunk] += std::max(counts[i], 0);
+        }
+    });
+    size_t offset = 0;
+    for (size_t& chunkOffset : offsets) {
+        size_t chunkSize = chunkOffset;
+        chunkOffset = offset;
+        offset += chunkSize;
+    }
+    return offsets;
+}
+
+}
+
 bool
 checkIndexRange(const VtIntArray& indices,
                 int minValue,
@@ -26,20 +92,40 @@ checkIndexRange(const VtIntArray& indices,
                 std::vector<size_t>& invalidIndices,
                 size_t* indexSumOut = nullptr)
 {
+    struct Chunk
+    {
+        int foundMinValue = std::numeric_limits<int>::max();
+        int foundMaxValue = std::numeric_limits<int>::min();
+        size_t indexSum = 0;
+        std::vector<size_t> invalidIndices;
+    };
+
+    size_t numIndices = indices.size();
+    const int* indexData = indices.cdata();
+    std::vector<Chunk> chunks(chunkCount(numIndices));
+    forEachChunk(numIndices, [&](size_t chunkIndex, size_t begin, size_t end) {
+        Chunk& chunk = chunks[chunkIndex];
+        for (size_t i = begin; i < end; ++i) {
+            int idx = indexData[i];
+            if (idx < minValue || idx >= maxValue) {
+                chunk.invalidIndices.push_back(i);
+            }
+            chunk.foundMinValue = std::min(idx, chunk.foundMinValue);
+            chunk.foundMaxValue = std::max(idx, chunk.foundMaxValue);
+            chunk.indexSum += idx;
+        }
+    });
+
     invalidIndices.clear();
     foundMinValue = std::numeric_limits<int>::max();
     foundMaxValue = std::numeric_limits<int>::min();
-
-    size_t numIndices = indices.size();
     size_t indexSum = 0;
-    for (size_t i = 0; i < numIndices; ++i) {
-        int idx = indices[i];
-        if (idx < minValue || idx >= maxValue) {
-            invalidIndices.push_back(i);
-        }
-        foundMinValue = std::min(idx, foundMinValue);
-        foundMaxValue = std::max(idx, foundMaxValue);
-        indexSum += idx;
+    for (const Chunk& chunk : chunks) {
+        invalidIndices.insert(
+          invalidIndices.end(), chunk.invalidIndices.begin(), chunk.invalidIndices.end());
+        foundMinValue = std::min(chunk.foundMinValue, foundMinValue);
+        foundMaxValue = std::max(chunk.foundMaxValue, foundMaxValue);
+        indexSum += chunk.indexSum;
     }
 
     if (indexSumOut != nullptr) {
@@ -75,13 +161,16 @@ checkFiniteFloats(const VtArray<T>& array, std::vector<size_t>& invalidIndices)
 {
     const float* floats = reinterpret_cast<const float*>(array.data());
     const size_t elementCount = sizeof(T) / sizeof(float);
-    const size_t numFloats = array.size() * elementCount;
 
-    for (size_t i = 0; i < numFloats; ++i) {
-        if (!std::isfinite(floats[i])) {
-            invalidIndices.push_back(i / elementCount);
+    std::vector<std::vector<size_t>> chunks(chunkCount(array.size()));
+    forEachChunk(array.size(), [&](size_t chunk, size_t begin, size_t end) {
+        for (size_t i = begin * elementCount; i < end * elementCount; ++i) {
+            if (!std::isfinite(floats[i])) {
+                chunks[chunk].push_back(i / elementCount);
+            }
         }
-    }
+    });
+    appendChunks(chunks, invalidIndices);
 
     return invalidIndices.size();
 }
@@ -407,23 +496,52 @@ verifyMesh(const std::string& path,
 bool
 verifyMeshes(const UsdData& usdData, IssueVector* issues, const MeshVerificationOptions& options)
 {
-    bool foundError = false;
+    // Collect the mesh instances in scene order, so the issues are reported in that order after
+    // the meshes are verified concurrently
+    std::vector<std::pair<std::string, const Mesh*>> meshes;
     for (const Node& node : usdData.nodes) {
         for (int meshIndex : node.staticMeshes) {
             const Mesh& mesh = usdData.meshes[meshIndex];
             std::string meshPath =
               node.path + "/" + (mesh.name.empty() ? "Mesh" : mesh.name.c_str());
-            foundError |= !verifyMesh(meshPath, mesh, issues, options);
+            meshes.emplace_back(std::move(meshPath), &mesh);
         }
         for (const auto& [skeletonIndex, meshIndices] : node.skinnedMeshes) {
             for (int meshIndex : meshIndices) {
                 const Mesh& mesh = usdData.meshes[meshIndex];
                 std::string meshPath =
                   node.path + "/" + (mesh.name.empty() ? "Mesh" : mesh.name.c_str());
-                foundError |= !verifyMesh(meshPath, mesh, issues, options);
+                meshes.emplace_back(std::move(meshPath), &mesh);
+            }
+        }
+        if (node.pointInstancer >= 0) {
+            const PointInstancer& instancer = usdData.pointInstancers[node.pointInstancer];
+            for (int meshIndex : instancer.meshes) {
+                const Mesh& mesh = usdData.meshes[meshIndex];
+                std::string meshPath = node.path + "/" + instancer.name + "/" +
+                                       kPointInstancerPrototypeName + "/" +
+                                       (mesh.name.empty() ? "Mesh" : mesh.name.c_str());
+                meshes.emplace_back(std::move(meshPath), &mesh);
             }
         }
     }
+
+    std::vector<IssueVector> meshIssues(meshes.size());
+    std::vector<char> meshVerified(meshes.size(), false);
+    WorkParallelForN(meshes.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            IssueVector* issuesOut = issues != nullptr ? &meshIssues[i] : nullptr;
+            meshVerified[i] = verifyMesh(meshes[i].first, *meshes[i].second, issuesOut, options);
+        }
+    });
+
+    bool foundError = false;
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        foundError |= !meshVerified[i];
+        if (issues != nullptr) {
+            issues->insert(issues->end(), meshIssues[i].begin(), meshIssues[i].end());
+        }
+    }
     return !foundError;
 }
 
@@ -491,13 +609,18 @@ void
 expandIndexedValues(const VtIntArray& indices, VtArray<T>& values, int componentsPerElement)
 {
     VtArray<T> temp = std::move(values);
-    unsigned int size = indices.size();
+    size_t size = indices.size();
     values.resize(size * componentsPerElement);
-    for (unsigned int i = 0; i < size; i++) {
-        for (int j = 0; j < componentsPerElement; j++) {
-            values[i * componentsPerElement + j] = temp[indices[i] * componentsPerElement + j];
+    const int* indexData = indices.cdata();
+    const T* src = temp.cdata();
+    T* dst = values.data();
+    forEachChunk(size, [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            for (int j = 0; j < componentsPerElement; j++) {
+                dst[i * componentsPerElement + j] = src[indexData[i] * componentsPerElement + j];
+            }
         }
-    }
+    });
 }
 
 using ReverseIndex = std::vector<int>;
@@ -514,28 +637,65 @@ fanTriangulate(const VtIntArray& srcFaceVertexCounts,
                VtIntArray& dstFaceVertexCounts,
                VtIntArray& dstFaceVertexIndices)
 {
+    // Count the triangles of each chunk of faces. Once the counts are summed up, each chunk knows
+    // where its triangles start, so they can be written concurrently.
+    struct Chunk
+    {
+        size_t numFaceVertices = 0;
+        size_t numTriangles = 0;
+        int oldTriangleCount = 0;
+        int oldQuadCount = 0;
+        int oldNgonCount = 0;
+        size_t firstInvalidFace = std::numeric_limits<size_t>::max();
+        // Where the chunk starts in the source face vertices and in the triangles
+        size_t srcFaceVertexOffset = 0;
+        size_t dstFaceOffset = 0;
+    };
+    const int* srcCounts = srcFaceVertexCounts.cdata();
+    const int* srcIndices = srcFaceVertexIndices.cdata();
+    size_t numFaces = srcFaceVertexCounts.size();
+    std::vector<Chunk> chunks(chunkCount(numFaces));
+    forEachChunk(numFaces, [&](size_t chunkIndex, size_t begin, size_t end) {
+        Chunk& chunk = chunks[chunkIndex];
+        for (size_t i = begin; i < end; ++i) {
+            int numFaceVertices = srcCounts[i];
+            if (numFaceVertices < 3) {
+                chunk.firstInvalidFace = i;
+                return;
+            }
+            chunk.numFaceVertices += numFaceVertices;
+            chunk.numTriangles += numFaceVertices - 2;
+            if (numFaceVertices == 3) {
+                ++chunk.oldTriangleCount;
+            } else if (numFaceVertices == 4) {
+                ++chunk.oldQuadCount;
+            } else {
+                ++chunk.oldNgonCount;
+            }
+        }
+    });
+
     int oldMeshTriangleCount = 0;
     int oldMeshQuadCount = 0;
     int oldMeshNgonCount = 0;
-    int totalTriangleCount = 0;
-    for (size_t i = 0; i < srcFaceVertexCounts.size(); ++i) {
-        int numFaceVertices = srcFaceVertexCounts[i];
-        if (numFaceVertices < 3) {
+    size_t totalFaceVertexCount = 0;
+    size_t totalTriangleCount = 0;
+    for (Chunk& chunk : chunks) {
+        if (chunk.firstInvalidFace != std::numeric_limits<size_t>::max()) {
             TF_WARN(
               FILE_FORMAT_UTIL,
               "fanTriangulate failed- Expected at least 3 face vertices, found: %d in array %zu",
-              numFaceVertices,
-              i);
+              srcCounts[chunk.firstInvalidFace],
+              chunk.firstInvalidFace);
             return false;
         }
-        totalTriangleCount += numFaceVertices - 2;
-        if (numFaceVertices == 3) {
-            ++oldMeshTriangleCount;
-        } else if (numFaceVertices == 4) {
-            ++oldMeshQuadCount;
-        } else {
-            ++oldMeshNgonCount;
-        }
+        oldMeshTriangleCount += chunk.oldTriangleCount;
+        oldMeshQuadCount += chunk.oldQuadCount;
+        oldMeshNgonCount += chunk.oldNgonCount;
+        chunk.srcFaceVertexOffset = totalFaceVertexCount;
+        chunk.dstFaceOffset = totalTriangleCount;
+        totalFaceVertexCount += chunk.numFaceVertices;
+        totalTriangleCount += chunk.numTriangles;
     }
 
     TF_DEBUG_MSG(FILE_FORMAT_UTIL,
@@ -549,42 +709,45 @@ fanTriangulate(const VtIntArray& srcFaceVertexCounts,
     reverseFaceIndexIndex.resize(totalTriangleCount * 3);
     dstFaceVertexCounts.resize(totalTriangleCount);
     dstFaceVertexIndices.resize(totalTriangleCount * 3);
+    int* dstCounts = dstFaceVertexCounts.data();
+    int* dstIndices = dstFaceVertexIndices.data();
 
     // Compute the new face vertex indices
-    int srcFaceVertexOffset = 0;
-    int dstFaceOffset = 0;
-    int dstFaceVertexOffset = 0;
-    size_t numFaces = srcFaceVertexCounts.size();
-    for (size_t i = 0; i < numFaces; ++i) {
-        int numFaceVertices = srcFaceVertexCounts[i];
-        int numFaceTriangles = numFaceVertices - 2;
-        // The center of the fan is the first vertex of the original face
-        int centerVertexOffset = srcFaceVertexOffset;
-        int centerVertex = srcFaceVertexIndices[centerVertexOffset];
-        // The border vertex is the first additional vertex for the next triangle
-        int borderVertexOffset = srcFaceVertexOffset + 1;
-        int borderVertex = srcFaceVertexIndices[borderVertexOffset];
-
-        for (int j = 0; j < numFaceTriangles; ++j) {
-            dstFaceVertexCounts[dstFaceOffset] = 3;
-            reverseFaceIndex[dstFaceOffset] = i;
-
-            dstFaceVertexIndices[dstFaceVertexOffset + 0] = centerVertex;
-            reverseFaceIndexIndex[dstFaceVertexOffset + 0] = centerVertexOffset;
-            dstFaceVertexIndices[dstFaceVertexOffset + 1] = borderVertex;
-            reverseFaceIndexIndex[dstFaceVertexOffset + 1] = borderVertexOffset;
-            // Get the next vertex for this triangle, which is also the border vertex for the
-            // following triangle
-            borderVertexOffset = srcFaceVertexOffset + 2 + j;
-            borderVertex = srcFaceVertexIndices[borderVertexOffset];
-            dstFaceVertexIndices[dstFaceVertexOffset + 2] = borderVertex;
-            reverseFaceIndexIndex[dstFaceVertexOffset + 2] = borderVertexOffset;
-
-            dstFaceOffset += 1;
-            dstFaceVertexOffset += 3;
+    forEachChunk(numFaces, [&](size_t chunkIndex, size_t begin, size_t end) {
+        int srcFaceVertexOffset = chunks[chunkIndex].srcFaceVertexOffset;
+        size_t dstFaceOffset = chunks[chunkIndex].dstFaceOffset;
+        size_t dstFaceVertexOffset = dstFaceOffset * 3;
+        for (size_t i = begin; i < end; ++i) {
+            int numFaceVertices = srcCounts[i];
+            int numFaceTriangles = numFaceVertices - 2;
+            // The center of the fan is the first vertex of the original face
+            int centerVertexOffset = srcFaceVertexOffset;
+            int centerVertex = srcIndices[centerVertexOffset];
+            // The border vertex is the first additional vertex for the next triangle
+            int borderVertexOffset = srcFaceVertexOffset + 1;
+            int borderVertex = srcIndices[borderVertexOffset];
+
+            for (int j = 0; j < numFaceTriangles; ++j) {
+                dstCounts[dstFaceOffset] = 3;
+                reverseFaceIndex[dstFaceOffset] = i;
+
+                dstIndices[dstFaceVertexOffset + 0] = centerVertex;
+                reverseFaceIndexIndex[dstFaceVertexOffset + 0] = centerVertexOffset;
+                dstIndices[dstFaceVertexOffset + 1] = borderVertex;
+                reverseFaceIndexIndex[dstFaceVertexOffset + 1] = borderVertexOffset;
+                // Get the next vertex for this triangle, which is also the border vertex for the
+                // following triangle
+                borderVertexOffset = srcFaceVertexOffset + 2 + j;
+                borderVertex = srcIndices[borderVertexOffset];
+                dstIndices[dstFaceVertexOffset + 2] = borderVertex;
+                reverseFaceIndexIndex[dstFaceVertexOffset + 2] = borderVertexOffset;
+
+                dstFaceOffset += 1;
+                dstFaceVertexOffset += 3;
+            }
+            srcFaceVertexOffset += numFaceVertices;
         }
-        srcFaceVertexOffset += numFaceVertices;
-    }
+    });
 
     return true;
 }
@@ -600,38 +763,63 @@ mapPrimvarWithReverseIndex(const ReverseIndex& reverseIndices,
         return;
     }
 
+    // The elements are mapped concurrently. Each chunk stops at its first element that can't be
+    // mapped, and the first of those overall is reported.
     size_t numElements = reverseIndices.size();
+    std::vector<size_t> chunkErrors(chunkCount(numElements), numElements);
+    auto firstError = [&]() { return *std::min_element(chunkErrors.begin(), chunkErrors.end()); };
     if (primvar.indices.empty()) {
         int numValues = static_cast<int>(primvar.values.size());
         VtArray<T> newValues(numElements);
+        const T* values = primvar.values.cdata();
+        T* dst = newValues.data();
 
         // if the original faceVertex indices is empty, we just use the reverse mapping of new index
         // to old index to locate the value.
         if (origFaceVertexIndices.empty()) {
-            for (size_t i = 0; i < numElements; ++i) {
-                int j = reverseIndices[i];
-                if (j >= numValues) {
-                    // If the mapping results in an array bounds error, we report an error and
-                    // return
-                    TF_WARN(FILE_FORMAT_UTIL,
-                            "error trying to remap primvar '%s' with interpolation '%s', "
-                            "reverseIndex[%lu] value is %d and is >= %d",
-                            primvarName.c_str(),
-                            primvar.interpolation.GetText(),
-                            i,
-                            j,
-                            numValues);
-                    return;
+            forEachChunk(numElements, [&](size_t chunk, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    int j = reverseIndices[i];
+                    if (j >= numValues) {
+                        chunkErrors[chunk] = i;
+                        return;
+                    }
+                    dst[i] = values[j];
                 }
-                newValues[i] = primvar.values[j];
+            });
+            size_t i = firstError();
+            if (i < numElements) {
+                // If the mapping results in an array bounds error, we report an error and
+                // return
+                TF_WARN(FILE_FORMAT_UTIL,
+                        "error trying to remap primvar '%s' with interpolation '%s', "
+                        "reverseIndex[%lu] value is %d and is >= %d",
+                        primvarName.c_str(),
+                        primvar.interpolation.GetText(),
+                        i,
+                        reverseIndices[i],
+                        numValues);
+                return;
             }
         } else {
             int numOrigIndices = static_cast<int>(origFaceVertexIndices.size());
-            for (size_t i = 0; i < numElements; ++i) {
+            const int* origIndices = origFaceVertexIndices.cdata();
+            forEachChunk(numElements, [&](size_t chunk, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    int j = reverseIndices[i];
+                    if (j >= numOrigIndices || origIndices[j] >= numValues) {
+                        chunkErrors[chunk] = i;
+                        return;
+                    }
+                    dst[i] = values[origIndices[j]];
+                }
+            });
+            size_t i = firstError();
+            if (i < numElements) {
+                // If the mapping results in an array bounds error, we report an error and
+                // return
                 int j = reverseIndices[i];
                 if (j >= numOrigIndices) {
-                    // If the mapping results in an array bounds error, we report an error and
-                    // return
                     TF_WARN(FILE_FORMAT_UTIL,
                             "error trying to remap primvar '%s' with interpolation '%s', "
                             "reverseIndex[%lu] value is %d and is >= %d",
@@ -640,23 +828,17 @@ mapPrimvarWithReverseIndex(const ReverseIndex& reverseIndices,
                             i,
                             j,
                             numOrigIndices);
-                    return;
-                }
-                int k = origFaceVertexIndices[j];
-                if (k >= numValues) {
-                    // If the mapping results in an array bounds error, we report an error and
-                    // return
+                } else {
                     TF_WARN(FILE_FORMAT_UTIL,
                             "error trying to remap primvar '%s' with interpolation '%s', "
                             "origFaceVertexIndices[%d] value is %d and is >= %d",
                             primvarName.c_str(),
                             primvar.interpolation.GetText(),
                             j,
-                            k,
+                            origIndices[j],
                             numValues);
-                    return;
                 }
-                newValues[i] = primvar.values[k];
+                return;
             }
         }
         primvar.values = std::move(newValues);
@@ -665,19 +847,28 @@ mapPrimvarWithReverseIndex(const ReverseIndex& reverseIndices,
         // stay the same
         VtIntArray newIndices(numElements);
         int numIndices = primvar.indices.size();
-        for (size_t i = 0; i < numElements; ++i) {
-            int idx = reverseIndices[i];
-            if (idx >= numIndices) {
-                TF_WARN("error trying to remap primvar '%s' with interpolation '%s', "
-                        "remapping index at %zu references index %d >= %d primvar indices",
-                        primvarName.c_str(),
-                        primvar.interpolation.GetText(),
-                        i,
-                        idx,
-                        numIndices);
-                return;
+        const int* indices = primvar.indices.cdata();
+        int* dst = newIndices.data();
+        forEachChunk(numElements, [&](size_t chunk, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                int idx = reverseIndices[i];
+                if (idx >= numIndices) {
+                    chunkErrors[chunk] = i;
+                    return;
+                }
+                dst[i] = indices[idx];
             }
-            newIndices[i] = primvar.indices[idx];
+        });
+        size_t i = firstError();
+        if (i < numElements) {
+            TF_WARN("error trying to remap primvar '%s' with interpolation '%s', "
+                    "remapping index at %zu references index %d >= %d primvar indices",
+                    primvarName.c_str(),
+                    primvar.interpolation.GetText(),
+                    i,
+                    reverseIndices[i],
+                    numIndices);
+            return;
         }
         primvar.indices = std::move(newIndices);
     }
@@ -725,6 +916,75 @@ mapPrimvarToTriangulatedMesh(const ReverseIndex& reverseFaceIndices,
     }
 }
 
+// Adds the weighted normal of a face corner to the accumulated normal of its vertex. Returns
+// false if the normal is skipped.
+bool
+accumulateVertexNormal(GfVec3f& vertexNormal, const GfVec3f& normal)
+{
+    // Before we add the weighted normal we check that the accumulated vertex normal is not
+    // reverted to zero. We check that we had a value before and then check that the new
+    // accumulated result is not becoming zero again. Skipping this value is better than
+    // producing a zero normal.
+    // Note, this can only happen with geometrically strange meshes. A vertex should not
+    // be surounded by faces with normals that add up to zero. But we've encountered bad
+    // meshes from scanned data with these kinds of issues.
+    GfVec3f newVertexNormal = vertexNormal + normal;
+    if (vertexNormal.GetLengthSq() != 0.0f &&
+        newVertexNormal.GetLengthSq() < (GF_MIN_VECTOR_LENGTH * GF_MIN_VECTOR_LENGTH)) {
+        // Skip adding the new weighted normal
+        return false;
+    }
+    // Add to accumulated normal for the shared vertex
+    vertexNormal = newVertexNormal;
+    return true;
+}
+
+// Calls fn(corner, vertex, normal) with the weighted normal of each corner of a face that
+// contributes to the normal of its vertex, in the order of the corners
+template<typename Fn>
+void
+forEachCornerNormal(const Mesh& mesh, int faceVertexIndexBase, int numFaceVertices, const Fn& fn)
+{
+    const size_t vertexCount = mesh.points.size();
+    const GfVec3f* points = mesh.points.cdata();
+    const int* faceVertexIndices = mesh.indices.cdata();
+
+    // We use the vertex indices of the current face vertex and the one before and after in the
+    // natural order of the faces. To only compute one index and point position per-iteration, we
+    // precompute the prev and current values and then move them forward by one in each iteration
+    int prevIndex = faceVertexIndices[faceVertexIndexBase + (numFaceVertices - 1)];
+    if (prevIndex < 0 || static_cast<size_t>(prevIndex) >= vertexCount) {
+        return;
+    }
+    GfVec3f prevP = points[prevIndex];
+    int currentIndex = faceVertexIndices[faceVertexIndexBase];
+    if (currentIndex < 0 || static_cast<size_t>(currentIndex) >= vertexCount) {
+        return;
+    }
+    GfVec3f currentP = points[currentIndex];
+
+    for (int i = 0; i < numFaceVertices; ++i) {
+        // Compute the next index and position
+        int nextIndex = faceVertexIndices[faceVertexIndexBase + (i + 1) % numFaceVertices];
+        if (nextIndex < 0 || static_cast<size_t>(nextIndex) >= vertexCount) {
+            continue;
+        }
+        GfVec3f nextP = points[nextIndex];
+
+        // Get vectors between the points, outwards from the current point
+        GfVec3f prevV = prevP - currentP;
+        GfVec3f nextV = nextP - currentP;
+
+        // Compute a weighted normal (ie non-normalized cross-product)
+        fn(faceVertexIndexBase + i, currentIndex, PXR_NS::GfCross(nextV, prevV));
+
+        // Move the indices and positions forward
+        currentIndex = nextIndex;
+        prevP = currentP;
+        currentP = nextP;
+    }
+}
+
 void
 computeSmoothNormals(Mesh& mesh)
 {
@@ -736,7 +996,8 @@ computeSmoothNormals(Mesh& mesh)
     mesh.normals.values.resize(vertexCount);
     std::uninitialized_fill(mesh.normals.values.begin(), mesh.normals.values.end(), GfVec3f(0.0f));
     mesh.normals.interpolation = UsdGeomTokens->vertex;
-    VtArray<GfVec3f>& vertexNormals = mesh.normals.values;
+    GfVec3f* vertexNormals = mesh.normals.values.data();
+    const int* faceVertexCounts = mesh.faces.cdata();
 
     // Generate normals for each vertex of each quad face
     TF_DEBUG_MSG(FILE_FORMAT_UTIL,
@@ -745,11 +1006,13 @@ computeSmoothNormals(Mesh& mesh)
                  vertexCount,
                  numFaces,
                  totalNumFaceVertices);
+
+    // Find where the vertices of each face start, -1 for the faces that are skipped
+    std::vector<int> faceVertexStarts(numFaces, -1);
     int faceVertexIndex = 0;
     int numBadFaces = 0;
-    int numBadNormals = 0;
     for (size_t faceIdx = 0; faceIdx < numFaces; ++faceIdx) {
-        int numFaceVertices = mesh.faces[faceIdx];
+        int numFaceVertices = faceVertexCounts[faceIdx];
         if (numFaceVertices < 3) {
             ++numBadFaces;
             continue;
@@ -762,69 +1025,82 @@ computeSmoothNormals(Mesh& mesh)
                     totalNumFaceVertices);
             break;
         }
-
-        // Starting index for the vertices of this face
-        int faceVertexIndexBase = faceVertexIndex;
+        faceVertexStarts[faceIdx] = faceVertexIndex;
         faceVertexIndex += numFaceVertices;
+    }
 
-        // We use the vertex indices of the current face vertex and the one before and after in the
-        // natural order of the faces. To only compute one index and point position per-iteration,
-        // we precompute the prev and current values and then move them forward by one in each
-        // iteration
-        int prevIndex = mesh.indices[faceVertexIndexBase + (numFaceVertices - 1)];
-        if (prevIndex < 0 || static_cast<size_t>(prevIndex) >= vertexCount) {
-            continue;
+    int numBadNormals = 0;
+    if (totalNumFaceVertices <= kGeometryParallelGrainSize) {
+        // Small meshes accumulate the corner normals into their vertex as they are computed
+        for (size_t faceIdx = 0; faceIdx < numFaces; ++faceIdx) {
+            if (faceVertexStarts[faceIdx] < 0) {
+                continue;
+            }
+            forEachCornerNormal(mesh,
+                                faceVertexStarts[faceIdx],
+                                faceVertexCounts[faceIdx],
+                                [&](int, int vertex, const GfVec3f& normal) {
+                                    if (!accumulateVertexNormal(vertexNormals[vertex], normal)) {
+                                        ++numBadNormals;
+                                    }
+                                });
         }
-        GfVec3f prevP = mesh.points[prevIndex];
-        int currentIndex = mesh.indices[faceVertexIndexBase];
-        if (currentIndex < 0 || static_cast<size_t>(currentIndex) >= vertexCount) {
-            continue;
+        for (size_t i = 0; i < vertexCount; ++i) {
+            vertexNormals[i].Normalize();
         }
-        GfVec3f currentP = mesh.points[currentIndex];
-
-        for (int i = 0; i < numFaceVertices; ++i) {
-            // Compute the next index and position
-            int nextIndex = mesh.indices[faceVertexIndexBase + (i + 1) % numFaceVertices];
-            if (nextIndex < 0 || static_cast<size_t>(nextIndex) >= vertexCount) {
-                continue;
+    } else {
+        // Compute the weighted normal of every face corner concurrently, along with the vertex it
+        // contributes to, or -1 if it doesn't contribute
+        std::vector<GfVec3f> cornerNormals(totalNumFaceVertices);
+        std::vector<int> cornerVertices(totalNumFaceVertices, -1);
+        forEachChunk(numFaces, [&](size_t, size_t begin, size_t end) {
+            for (size_t faceIdx = begin; faceIdx < end; ++faceIdx) {
+                if (faceVertexStarts[faceIdx] < 0) {
+                    continue;
+                }
+                forEachCornerNormal(mesh,
+                                    faceVertexStarts[faceIdx],
+                                    faceVertexCounts[faceIdx],
+                                    [&](int corner, int vertex, const GfVec3f& normal) {
+                                        cornerNormals[corner] = normal;
+                                        cornerVertices[corner] = vertex;
+                                    });
             }
-            GfVec3f nextP = mesh.points[nextIndex];
-
-            // Get vectors between the points, outwards from the current point
-            GfVec3f prevV = prevP - currentP;
-            GfVec3f nextV = nextP - currentP;
-
-            // Compute a weighted normal (ie non-normalized cross-product)
-            GfVec3f normal = PXR_NS::GfCross(nextV, prevV);
-
-            // Before we add the weighted normal we check that the accumulated vertex normal is not
-            // reverted to zero. We check that we had a value before and then check that the new
-            // accumulated result is not becoming zero again. Skipping this value is better than
-            // producing a zero normal.
-            // Note, this can only happen with geometrically strange meshes. A vertex should not
-            // be surounded by faces with normals that add up to zero. But we've encountered bad
-            // meshes from scanned data with these kinds of issues.
-            GfVec3f& vertexNormal = vertexNormals[currentIndex];
-            GfVec3f newVertexNormal = vertexNormal + normal;
-            if (vertexNormal.GetLengthSq() != 0.0f &&
-                newVertexNormal.GetLengthSq() < (GF_MIN_VECTOR_LENGTH * GF_MIN_VECTOR_LENGTH)) {
-                // Skip adding the new weighted normal
-                ++numBadNormals;
-            } else {
-                // Add to accumulated normal for the shared vertex
-                vertexNormal = newVertexNormal;
+        });
+
+        // The result depends on the order the corner normals of a vertex are accumulated in. Sort
+        // the corners by vertex, keeping them in face order, so that ranges of vertices can be
+        // accumulated concurrently with the same result as the serial loop
+        std::vector<int> vertexCornerStarts(vertexCount + 1, 0);
+        for (int vertex : cornerVertices) {
+            if (vertex >= 0) {
+                ++vertexCornerStarts[vertex + 1];
+            }
+        }
+        std::partial_sum(
+          vertexCornerStarts.begin(), vertexCornerStarts.end(), vertexCornerStarts.begin());
+        std::vector<int> vertexCorners(vertexCornerStarts.back());
+        std::vector<int> vertexCornerEnds(vertexCornerStarts.begin(), vertexCornerStarts.end() - 1);
+        for (size_t corner = 0; corner < totalNumFaceVertices; ++corner) {
+            int vertex = cornerVertices[corner];
+            if (vertex >= 0) {
+                vertexCorners[vertexCornerEnds[vertex]++] = corner;
             }
-
-            // Move the indices and positions forward
-            currentIndex = nextIndex;
-            prevP = currentP;
-            currentP = nextP;
         }
-    }
 
-    // normalize the accumulated vertex normals
-    for (unsigned int i = 0; i < vertexCount; ++i) {
-        vertexNormals[i].Normalize();
+        std::vector<int> chunkBadNormals(chunkCount(vertexCount), 0);
+        forEachChunk(vertexCount, [&](size_t chunk, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                for (int k = vertexCornerStarts[i]; k < vertexCornerStarts[i + 1]; ++k) {
+                    const GfVec3f& normal = cornerNormals[vertexCorners[k]];
+                    if (!accumulateVertexNormal(vertexNormals[i], normal)) {
+                        ++chunkBadNormals[chunk];
+                    }
+                }
+                vertexNormals[i].Normalize();
+            }
+        });
+        numBadNormals = std::accumulate(chunkBadNormals.begin(), chunkBadNormals.end(), 0);
     }
 
     if (numBadFaces > 0) {
@@ -904,22 +1180,26 @@ triangulateMesh(Mesh& mesh)
             facesMask[srcFaceIndex] = true;
         }
 
+        // Iterate over all faces in the new mesh
+        size_t numFaces = mesh.faces.size();
+        std::vector<std::vector<int>> chunkFaceIndices(chunkCount(numFaces));
+        forEachChunk(numFaces, [&](size_t chunk, size_t begin, size_t end) {
+            for (size_t faceIndex = begin; faceIndex < end; ++faceIndex) {
+                // Map the new face index to its original face and check if that face was part of
+                // the subset. All (new) faces that map back to the original subset are part of the
+                // (new) subset
+                int srcFaceIndex = reverseFaceIndex[faceIndex];
+                if (facesMask[srcFaceIndex]) {
+                    chunkFaceIndices[chunk].push_back(faceIndex);
+                }
+            }
+        });
+
         // We don't know how many faces will be in the new subset, but we know we have at least as
         // many as in the original subset
         VtIntArray newFaceIndices;
         newFaceIndices.reserve(subset.faces.size());
-
-        // Iterate over all faces in the new mesh
-        size_t numFaces = mesh.faces.size();
-        for (size_t faceIndex = 0; faceIndex < numFaces; ++faceIndex) {
-            // Map the new face index to its original face and check if that face was part of the
-            // subset. All (new) faces that map back to the original subset are part of the (new)
-            // subset
-            int srcFaceIndex = reverseFaceIndex[faceIndex];
-            if (facesMask[srcFaceIndex]) {
-                newFaceIndices.push_back(faceIndex);
-            }
-        }
+        appendChunks(chunkFaceIndices, newFaceIndices);
 
         TF_DEBUG_MSG(FILE_FORMAT_UTIL,
                      "Map face subset: %zu faces -> %zu faces\n",
@@ -1012,14 +1292,20 @@ expandPrimvarToFaceVarying(const VtIntArray& faceVertexCounts,
         // Uniform means a single value per face, so we need to transfer the data from the old faces
         // to the new per-vertex values in the expanded form, which matches face vertex layout.
         VtArray<T> newValues(numFaceVertices);
-        int idx = 0;
-        for (size_t i = 0; i < numFaces; ++i) {
-            int numFaceVertices = faceVertexCounts[i];
-            T faceValue = primvar.values[i];
-            for (int j = 0; j < numFaceVertices; ++j) {
-                newValues[idx++] = faceValue;
+        const int* counts = faceVertexCounts.cdata();
+        const T* faceValues = primvar.values.cdata();
+        T* dst = newValues.data();
+        std::vector<size_t> chunkOffsets = chunkFaceVertexOffsets(faceVertexCounts);
+        forEachChunk(numFaces, [&](size_t chunk, size_t begin, size_t end) {
+            size_t idx = chunkOffsets[chunk];
+            for (size_t i = begin; i < end; ++i) {
+                int numFaceVertices = counts[i];
+                T faceValue = faceValues[i];
+                for (int j = 0; j < numFaceVertices; ++j) {
+                    dst[idx++] = faceValue;
+                }
             }
-        }
+        });
         primvar.values = std::move(newValues);
         // Note, faceVarying and vertex interpolation are equivalent in this context
         primvar.interpolation = UsdGeomTokens->vertex;
@@ -1129,7 +1415,10 @@ forceVertexInterpolation(Mesh& mesh)
     }
 
     // Fill the indices with a simple increasing index to match the expanded points
-    std::iota(mesh.indices.begin(), mesh.indices.end(), 0);
+    int* indices = mesh.indices.data();
+    forEachChunk(mesh.indices.size(), [&](size_t, size_t begin, size_t end) {
+        std::iota(indices + begin, indices + end, static_cast<int>(begin));
+    });
 
     // Note, since the face count and order hasn't been changed, this operation does not affect any
     // subsets of this mesh.
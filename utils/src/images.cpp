@@ -12,15 +12,23 @@ governing permissions and limitations under the License.
 #include <OpenImageIO/filesystem.h>
 #include <OpenImageIO/imagebufalgo.h>
 #include <OpenImageIO/imageio.h>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <cstdint>
 #include <fileformatutils/common.h>
 #include <fileformatutils/debugCodes.h>
 #include <fileformatutils/images.h>
+#include <fileformatutils/profiling.h>
 #include <filesystem>
 #include <limits>
+#include <pxr/base/arch/hash.h>
 #include <pxr/base/tf/fileUtils.h>
+#include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/imaging/hio/image.h>
 #include <pxr/usd/ar/defaultResolver.h>
+#include <unordered_map>
 
 using namespace PXR_NS;
 
@@ -57,18 +65,259 @@ validateImageDimensions(unsigned int width,
     pixelCount = static_cast<size_t>(widthHeight * c);
     return true;
 }
+
+OIIO::TypeDesc
+getTypeDesc(ImagePixelType pixelType)
+{
+    switch (pixelType) {
+        case ImagePixelType::UInt8: return OIIO::TypeDesc::UINT8;
+        case ImagePixelType::UInt16: return OIIO::TypeDesc::UINT16;
+        case ImagePixelType::Half: return OIIO::TypeDesc::HALF;
+        case ImagePixelType::Float: break;
+    }
+    return OIIO::TypeDesc::FLOAT;
+}
+
+// The pixel type to keep for an image stored as `spec` in its file. Types we don't store natively,
+// and images with per channel types, are converted to float.
+ImagePixelType
+getSourcePixelType(const OIIO::ImageSpec& spec)
+{
+    if (!spec.channelformats.empty()) {
+        return ImagePixelType::Float;
+    }
+    switch (spec.format.basetype) {
+        case OIIO::TypeDesc::UINT8: return ImagePixelType::UInt8;
+        case OIIO::TypeDesc::UINT16: return ImagePixelType::UInt16;
+        case OIIO::TypeDesc::HALF: return ImagePixelType::Half;
+        default: return ImagePixelType::Float;
+    }
+}
+
+// Resizes the storage of `pixelType` to `valueCount` values and releases the other one. Returns
+// the start of the storage.
+void*
+resizePixels(Image& image, ImagePixelType pixelType, size_t valueCount)
+{
+    image.pixelType = pixelType;
+    if (pixelType == ImagePixelType::Float) {
+        image.nativePixels = std::vector<uint8_t>();
+        image.pixels.resize(valueCount);
+        return image.pixels.data();
+    }
+    image.pixels = std::vector<float>();
+    image.nativePixels.resize(valueCount * getPixelTypeSize(pixelType));
+    return image.nativePixels.data();
+}
+
+const void*
+getPixelData(const Image& image)
+{
+    return image.pixelType == ImagePixelType::Float
+             ? static_cast<const void*>(image.pixels.data())
+             : static_cast<const void*>(image.nativePixels.data());
+}
+
+void*
+getPixelData(Image& image)
+{
+    return const_cast<void*>(getPixelData(std::as_const(image)));
+}
+
+// Number of pixels up to which the image operations run serially. Larger images are split into
+// ranges of this many pixels, that are processed concurrently.
+constexpr size_t kImageParallelGrainSize = 1 << 16;
+
+// Number of pixels converted to float at a time, when reading pixels of another type
+constexpr size_t kFloatBlockSize = 4096;
+
+// Calls fn(begin, end) for ranges that cover [0, count), concurrently if count is large
+template<typename Fn>
+void
+forEachRange(size_t count, const Fn& fn)
+{
+    if (count <= kImageParallelGrainSize) {
+        fn(0, count);
+    } else {
+        WorkParallelForN(count, fn, kImageParallelGrainSize);
+    }
+}
+
+// Calls fn(values, first, count) for consecutive blocks covering the pixels [begin, end) of
+// `image`, with the values of the `count` pixels starting at pixel `first` as float. Float images
+// are passed as a single block pointing into the image, other types are converted block by block.
+template<typename Fn>
+void
+forEachFloatBlock(const Image& image, size_t begin, size_t end, const Fn& fn)
+{
+    const size_t channels = image.channels;
+    if (image.pixelType == ImagePixelType::Float) {
+        fn(image.pixels.data() + begin * channels, begin, end - begin);
+        return;
+    }
+    std::vector<float> buffer(std::min(end - begin, kFloatBlockSize) * channels);
+    for (size_t first = begin; first < end; first += kFloatBlockSize) {
+        const size_t count = std::min(end - first, kFloatBlockSize);
+        image.getFloatValues(first * channels, count * channels, buffer.data());
+        fn(buffer.data(), first, count);
+    }
+}
+
+// `image` if its pixels are stored as float, or else a float copy of it made in `storage`
+const Image&
+getFloatImage(const Image& image, Image& storage)
+{
+    if (image.pixelType == ImagePixelType::Float) {
+        return image;
+    }
+    storage = image;
+    storage.convertToFloat();
+    return storage;
+}
+
+// Copies a channel of values of the same size without converting them
+template<typename T>
+void
+copyChannelValues(const void* src,
+                  int numSrcChannels,
+                  int channelSrc,
+                  void* dst,
+                  int numDstChannels,
+                  int channelDst,
+                  size_t pixelCount)
+{
+    const T* srcValues = static_cast<const T*>(src) + channelSrc;
+    T* dstValues = static_cast<T*>(dst) + channelDst;
+    forEachRange(pixelCount, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            dstValues[i * numDstChannels] = srcValues[i * numSrcChannels];
+        }
+    });
+}
+
+// Sets all `pixelCount` pixels of `N` channels to `value`
+template<int N>
+void
+fillPixels(float* dst, size_t pixelCount, const float* value)
+{
+    forEachRange(pixelCount, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            for (int c = 0; c < N; c++) {
+                dst[i * N + c] = value[c];
+            }
+        }
+    });
+}
+
+// Per channel minimum and maximum of a range of pixels, reduced like a serial loop of
+// std::min(value, min) and std::max(value, max). In such a loop a NaN value becomes the minimum and
+// maximum, and the next value replaces it. A range therefore starts from NaN, so that its first
+// value is taken as is, and records whether it holds a NaN, in which case the values before the
+// range don't contribute to the result.
+struct PixelRange
+{
+    float minValues[4] = { NAN, NAN, NAN, NAN };
+    float maxValues[4] = { NAN, NAN, NAN, NAN };
+    bool hasNaN[4] = { false, false, false, false };
+};
+
+template<int N>
+void
+accumulateRange(const float* src, size_t pixelCount, PixelRange& range)
+{
+    for (size_t i = 0; i < pixelCount; i++) {
+        for (int c = 0; c < N; c++) {
+            const float value = src[i * N + c];
+            range.minValues[c] = std::min(value, range.minValues[c]);
+            range.maxValues[c] = std::max(value, range.maxValues[c]);
+            range.hasNaN[c] |= std::isnan(value);
+        }
+    }
+}
+
+void
+accumulateRange(const float* src, size_t pixelCount, int channels, PixelRange& range)
+{
+    switch (channels) {
+        case 1: accumulateRange<1>(src, pixelCount, range); break;
+        case 2: accumulateRange<2>(src, pixelCount, range); break;
+        case 3: accumulateRange<3>(src, pixelCount, range); break;
+        case 4: accumulateRange<4>(src, pixelCount, range); break;
+    }
+}
+
+// Defined with the srgb conversions below
+const float*
+getSrgbToLinearTable();
+const float*
+getLinearToSrgbTable();
+template<typename Fn>
+void
+transferChannels(float* values,
+                 int channels,
+                 int firstChannel,
+                 int channelCount,
+                 size_t begin,
+                 size_t end,
+                 const float* table,
+                 Fn exactFn);
+
+// Number of color channels of an image with `channels` channels, the last channel of 2 and 4
+// channel images being alpha
+int
+getColorChannelCount(int channels)
+{
+    return channels == 2 || channels == 4 ? channels - 1 : channels;
+}
+
+// Renormalizes the `pixelCount` tangent space normals of `values`, which are encoded as [0,1]
+// colors in the first 3 of `channels` channels. A zero normal is left as is.
+void
+renormalizeNormals(float* values, int channels, size_t pixelCount)
+{
+    for (size_t i = 0; i < pixelCount; i++) {
+        float* pixel = values + i * channels;
+        float normal[3];
+        for (int c = 0; c < 3; c++) {
+            normal[c] = 2.0f * pixel[c] - 1.0f;
+        }
+        const float length =
+          std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (length > 0.0f) {
+            for (int c = 0; c < 3; c++) {
+                pixel[c] = 0.5f * normal[c] / length + 0.5f;
+            }
+        }
+    }
+}
+}
+
+size_t
+getPixelTypeSize(ImagePixelType pixelType)
+{
+    switch (pixelType) {
+        case ImagePixelType::UInt8: return 1;
+        case ImagePixelType::UInt16: return 2;
+        case ImagePixelType::Half: return 2;
+        case ImagePixelType::Float: break;
+    }
+    return 4;
 }
 
 Image::Image()
   : width(0U)
   , height(0U)
   , channels(0U)
+  , pixelType(ImagePixelType::Float)
 {}
 
 Image::~Image() {}
 
 bool
-Image::allocate(unsigned int width, unsigned int height, unsigned int channels)
+Image::allocate(unsigned int width,
+                unsigned int height,
+                unsigned int channels,
+                ImagePixelType pixelType)
 {
     size_t pixelCount = 0;
     if (!validateImageDimensions(width, height, channels, pixelCount)) {
@@ -80,7 +329,7 @@ Image::allocate(unsigned int width, unsigned int height, unsigned int channels)
         this->width = 0;
         this->height = 0;
         this->channels = 0;
-        pixels.clear();
+        resizePixels(*this, ImagePixelType::Float, 0);
         return false;
     }
     // validateImageDimensions guarantees the product (and therefore each factor) fits in a
@@ -88,17 +337,19 @@ Image::allocate(unsigned int width, unsigned int height, unsigned int channels)
     this->width = static_cast<int>(width);
     this->height = static_cast<int>(height);
     this->channels = static_cast<int>(channels);
-    pixels.resize(pixelCount);
-    return !pixels.empty();
+    return resizePixels(*this, pixelType, pixelCount) != nullptr && pixelCount > 0;
 }
 
 bool
-Image::read(const ImageAsset& imageAsset, int forceChannels)
+Image::read(const ImageAsset& imageAsset, int forceChannels, bool keepPixelType)
 {
     std::string extension = getFormatExtension(imageAsset.format);
     if (extension.empty()) {
         return false;
     }
+    ProfilePhase decodePhase("imageDecode");
+    profileAddCounter("decodedImages", 1);
+    profileAddCounter("decodedImageBytes", imageAsset.image.size());
 
     OIIO::Filesystem::IOMemReader memreader(
       const_cast<void*>(reinterpret_cast<const void*>(imageAsset.image.data())),
@@ -142,15 +393,17 @@ Image::read(const ImageAsset& imageAsset, int forceChannels)
         width = 0;
         height = 0;
         channels = 0;
-        pixels.clear();
+        resizePixels(*this, ImagePixelType::Float, 0);
         return false;
     }
     width = spec.width;
     height = spec.height;
     // note we force to forceChannels, instead of the true spec.nchannels, when requested
     channels = newChannels;
-    pixels.resize(pixelCount);
-    input->read_image(0, 0, 0, channels, OIIO::TypeDesc::FLOAT, pixels.data());
+    const ImagePixelType newPixelType =
+      keepPixelType ? getSourcePixelType(spec) : ImagePixelType::Float;
+    void* data = resizePixels(*this, newPixelType, pixelCount);
+    input->read_image(0, 0, 0, channels, getTypeDesc(pixelType), data);
     input->close();
     return true;
 }
@@ -180,13 +433,19 @@ Image::write(ImageAsset& imageAsset) const
         return false;
     }
 
+    ProfilePhase encodePhase("imageEncode");
+    profileAddCounter("encodedImages", 1);
+
+    // The pixels are converted from their storage type by OIIO, so the file is encoded the same
+    // whichever type they are stored as
     OIIO::ImageSpec spec(width, height, channels, OIIO::TypeDesc::FLOAT);
     // XXX this is needed for PNG images to have correct alpha that is independent of the RGB
     // channels. This is important when packing channels into an image file, like color and opacity.
     // This allows having color pixels, but an opacity of zero.
     spec.attribute("oiio:UnassociatedAlpha", 1);
     std::string dummyFilename = "dummy." + extension;
-    OIIO::Filesystem::IOVecOutput memoryWriter(imageAsset.image); // I/O proxy object
+    std::vector<uint8_t> encoded;
+    OIIO::Filesystem::IOVecOutput memoryWriter(encoded); // I/O proxy object
     void* ptr = &memoryWriter;
     spec.attribute("oiio:ioproxy", OIIO::TypeDesc::PTR, &ptr);
 
@@ -211,11 +470,13 @@ Image::write(ImageAsset& imageAsset) const
         return false;
     }
 
-    if (!out->write_image(OIIO::TypeDesc::FLOAT, pixels.data())) {
+    if (!out->write_image(getTypeDesc(pixelType), getPixelData(*this))) {
         TF_WARN("Failed to write image data to %s", dummyFilename.c_str());
         return false;
     }
+    // close before using the encoded bytes, as extra bytes will be written on close
     out->close();
+    imageAsset.image = std::move(encoded);
     return true;
 }
 
@@ -315,131 +576,136 @@ Image::transformChannel(const Image& imageSrc,
     // width/height/channels are public, but every call site in this codebase only ever sets them
     // via the validated allocate()/read(), which guarantee width * height * channels fits in a
     // signed int, so this can't overflow either as long as that convention holds.
-    const uint32_t pixelCount = width * height;
-    const float* src = imageSrc.pixels.data();
+    const size_t pixelCount = static_cast<size_t>(width) * height;
     const int numSrcChannels = imageSrc.channels;
-    float* dst = pixels.data();
     const int numDstChannels = channels;
-    // If the scale and bias are default, just copy source channel to dest channel
-    if (scale == 1.0f && bias == 0.0f) {
-        for (uint32_t i = 0; i < pixelCount; i++) {
-            dst[i * numDstChannels + channelDst] = src[i * numSrcChannels + channelSrc];
-        }
-    } else {
-        // Apply scale and bias to source channel and store in dest channel
-        for (uint32_t i = 0; i < pixelCount; i++) {
-            dst[i * numDstChannels + channelDst] =
-              src[i * numSrcChannels + channelSrc] * scale + bias;
+    // If the scale and bias are default and both images store the same type, just copy source
+    // channel to dest channel, without converting the values
+    if (scale == 1.0f && bias == 0.0f && pixelType == imageSrc.pixelType) {
+        const void* src = getPixelData(imageSrc);
+        void* dst = getPixelData(*this);
+        switch (getPixelTypeSize(pixelType)) {
+            case 1:
+                copyChannelValues<uint8_t>(
+                  src, numSrcChannels, channelSrc, dst, numDstChannels, channelDst, pixelCount);
+                break;
+            case 2:
+                copyChannelValues<uint16_t>(
+                  src, numSrcChannels, channelSrc, dst, numDstChannels, channelDst, pixelCount);
+                break;
+            default:
+                copyChannelValues<float>(
+                  src, numSrcChannels, channelSrc, dst, numDstChannels, channelDst, pixelCount);
+                break;
         }
+        return true;
     }
+
+    // Apply scale and bias to source channel and store in dest channel, as float
+    convertToFloat();
+    float* dst = pixels.data() + channelDst;
+    forEachRange(pixelCount, [&](size_t begin, size_t end) {
+        forEachFloatBlock(imageSrc, begin, end, [&](const float* src, size_t first, size_t count) {
+            src += channelSrc;
+            float* dstBlock = dst + first * numDstChannels;
+            for (size_t i = 0; i < count; i++) {
+                dstBlock[i * numDstChannels] = src[i * numSrcChannels] * scale + bias;
+            }
+        });
+    });
     return true;
 }
 
 void
 Image::set(float r, float g, float b, float a)
 {
-    // See transformChannel() above: width/height/channels aren't expected to overflow here.
-    int pixelCount = width * height;
+    // Every value is overwritten, so native pixels are replaced rather than converted
+    if (pixelType != ImagePixelType::Float) {
+        resizePixels(*this, ImagePixelType::Float, getValueCount());
+    }
+    const size_t pixelCount = static_cast<size_t>(width) * height;
+    const float value[4] = { r, g, b, a };
     float* dst = pixels.data();
     switch (channels) {
-        case 1:
-            for (int i = 0; i < pixelCount; i++) {
-                dst[i] = r;
-            }
-            break;
-        case 2:
-            for (int i = 0; i < pixelCount; i++) {
-                dst[2 * i] = r;
-                dst[2 * i + 1] = g;
-            }
-            break;
-        case 3:
-            for (int i = 0; i < pixelCount; i++) {
-                dst[3 * i] = r;
-                dst[3 * i + 1] = g;
-                dst[3 * i + 2] = b;
-            }
-            break;
-        case 4:
-            for (int i = 0; i < pixelCount; i++) {
-                dst[4 * i] = r;
-                dst[4 * i + 1] = g;
-                dst[4 * i + 2] = b;
-                dst[4 * i + 3] = a;
-            }
-            break;
+        case 1: fillPixels<1>(dst, pixelCount, value); break;
+        case 2: fillPixels<2>(dst, pixelCount, value); break;
+        case 3: fillPixels<3>(dst, pixelCount, value); break;
+        case 4: fillPixels<4>(dst, pixelCount, value); break;
     }
 }
 
 std::pair<GfVec4f, GfVec4f>
 Image::computeRange() const
 {
-    float minr = FLT_MAX;
-    float ming = FLT_MAX;
-    float minb = FLT_MAX;
-    float mina = FLT_MAX;
-    float maxr = -FLT_MAX;
-    float maxg = -FLT_MAX;
-    float maxb = -FLT_MAX;
-    float maxa = -FLT_MAX;
-
-    int pixelCount = width * height;
-    const float* src = pixels.data();
-    switch (channels) {
-        case 1:
-            for (int i = 0; i < pixelCount; i++) {
-                float r = src[i];
-                minr = std::min(r, minr);
-                maxr = std::max(r, maxr);
-            }
-            break;
-        case 2:
-            for (int i = 0; i < pixelCount; i++) {
-                float r = src[2 * i + 0];
-                float g = src[2 * i + 1];
-                minr = std::min(r, minr);
-                maxr = std::max(r, maxr);
-                ming = std::min(g, ming);
-                maxg = std::max(g, maxg);
-            }
-            break;
-        case 3:
-            for (int i = 0; i < pixelCount; i++) {
-                float r = src[3 * i + 0];
-                float g = src[3 * i + 1];
-                float b = src[3 * i + 2];
-                minr = std::min(r, minr);
-                maxr = std::max(r, maxr);
-                ming = std::min(g, ming);
-                maxg = std::max(g, maxg);
-                minb = std::min(b, minb);
-                maxb = std::max(b, maxb);
-            }
-            break;
-        case 4:
-            for (int i = 0; i < pixelCount; i++) {
-                float r = src[4 * i + 0];
-                float g = src[4 * i + 1];
-                float b = src[4 * i + 2];
-                float a = src[4 * i + 3];
-                minr = std::min(r, minr);
-                maxr = std::max(r, maxr);
-                ming = std::min(g, ming);
-                maxg = std::max(g, maxg);
-                minb = std::min(b, minb);
-                maxb = std::max(b, maxb);
-                mina = std::min(a, mina);
-                maxa = std::max(a, maxa);
+    // The pixels are split in ranges that only depend on the image size, and the ranges are
+    // merged in order, so the result is the same whether they are processed concurrently or not
+    const size_t pixelCount = static_cast<size_t>(width) * height;
+    const size_t rangeCount = (pixelCount + kImageParallelGrainSize - 1) / kImageParallelGrainSize;
+    std::vector<PixelRange> ranges(rangeCount);
+    auto computeRanges = [&](size_t beginRange, size_t endRange) {
+        for (size_t r = beginRange; r < endRange; r++) {
+            const size_t begin = r * kImageParallelGrainSize;
+            const size_t end = std::min(begin + kImageParallelGrainSize, pixelCount);
+            forEachFloatBlock(*this, begin, end, [&](const float* src, size_t, size_t count) {
+                accumulateRange(src, count, channels, ranges[r]);
+            });
+        }
+    };
+    if (rangeCount <= 1) {
+        computeRanges(0, rangeCount);
+    } else {
+        WorkParallelForN(rangeCount, computeRanges, 1);
+    }
+
+    // Channels the image doesn't have keep the initial values
+    GfVec4f minValues(FLT_MAX);
+    GfVec4f maxValues(-FLT_MAX);
+    const int channelCount = std::min(channels, 4);
+    for (const PixelRange& range : ranges) {
+        for (int c = 0; c < channelCount; c++) {
+            if (range.hasNaN[c]) {
+                minValues[c] = range.minValues[c];
+                maxValues[c] = range.maxValues[c];
+            } else {
+                minValues[c] = std::min(range.minValues[c], minValues[c]);
+                maxValues[c] = std::max(range.maxValues[c], maxValues[c]);
             }
-            break;
+        }
+    }
+    return { minValues, maxValues };
+}
+
+void
+Image::convertToFloat()
+{
+    if (pixelType == ImagePixelType::Float) {
+        return;
     }
+    std::vector<float> values(getValueCount());
+    getFloatValues(0, values.size(), values.data());
+    resizePixels(*this, ImagePixelType::Float, 0);
+    pixels = std::move(values);
+}
 
-    return { GfVec4f(minr, ming, minb, mina), GfVec4f(maxr, maxg, maxb, maxa) };
+void
+Image::getFloatValues(size_t offset, size_t count, float* dst) const
+{
+    if (pixelType == ImagePixelType::Float) {
+        std::copy_n(pixels.data() + offset, count, dst);
+        return;
+    }
+    // Converts like OIIO does when decoding to float, so both give the same values
+    const uint8_t* src = nativePixels.data() + offset * getPixelTypeSize(pixelType);
+    OIIO::convert_pixel_values(
+      getTypeDesc(pixelType), src, OIIO::TypeDesc::FLOAT, dst, static_cast<int>(count));
 }
 
 bool
-imageMult(const Image& in, const Image& factor, Image& out)
+imageMult(const Image& inImage, const Image& factorImage, Image& out)
 {
+    Image inStorage;
+    const Image& in = getFloatImage(inImage, inStorage);
+    const Image& factor = factorImage;
     out.allocate(in.width, in.height, in.channels);
     if (in.width != factor.width || in.height != factor.height) {
         // If factor is invalid or doesn't match the side of the in image, we just copy
@@ -453,33 +719,41 @@ imageMult(const Image& in, const Image& factor, Image& out)
         return false;
     }
 
-    unsigned int pixelCount = in.width * in.height;
-    const float* factorSrc = factor.pixels.data();
-    int factorChannels = factor.channels;
-    const float* src = in.pixels.data();
-    int srcChannels = in.channels;
-    float* dst = out.pixels.data();
-    for (unsigned int i = 0; i < pixelCount; i++) {
-        float f = factorSrc[i * factorChannels]; // takes value from first channel
-        for (int j = 0; j < srcChannels; j++) {
-            dst[i * srcChannels + j] = src[i * srcChannels + j] * f;
-        }
-    }
+    const size_t pixelCount = static_cast<size_t>(in.width) * in.height;
+    const int factorChannels = factor.channels;
+    const int srcChannels = in.channels;
+    forEachRange(pixelCount, [&](size_t begin, size_t end) {
+        forEachFloatBlock(
+          factor, begin, end, [&](const float* factorSrc, size_t first, size_t count) {
+              const float* src = in.pixels.data() + first * srcChannels;
+              float* dst = out.pixels.data() + first * srcChannels;
+              for (size_t i = 0; i < count; i++) {
+                  float f = factorSrc[i * factorChannels]; // takes value from first channel
+                  for (int j = 0; j < srcChannels; j++) {
+                      dst[i * srcChannels + j] = src[i * srcChannels + j] * f;
+                  }
+              }
+          });
+    });
 
     return true;
 }
 
 bool
-imageTransformAffine(const Image& in, float scale, float bias, Image& out)
+imageTransformAffine(const Image& inImage, float scale, float bias, Image& out)
 {
+    Image inStorage;
+    const Image& in = getFloatImage(inImage, inStorage);
     const int channels = in.channels;
     out.allocate(in.width, in.height, channels);
-    size_t valueCount = in.width * in.height * channels;
+    const size_t valueCount = in.getValueCount();
     const float* src = in.pixels.data();
     float* dst = out.pixels.data();
-    for (size_t i = 0; i < valueCount; i++) {
-        *dst++ = scale * (*src++) + bias;
-    }
+    forEachRange(valueCount, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            dst[i] = scale * src[i] + bias;
+        }
+    });
     return true;
 }
 
@@ -491,11 +765,86 @@ imageExtractChannel(const Image& in, int channelSrc, float scale, float bias, Im
         return false;
     }
 
-    // allocate space for single channel image and copy from source
-    out.allocate(in.width, in.height, 1);
+    // allocate space for single channel image and copy from source. A plain copy keeps the
+    // source pixel type, so 8 bit channels are not expanded to float.
+    const bool copy = scale == 1.0f && bias == 0.0f;
+    out.allocate(in.width, in.height, 1, copy ? in.pixelType : ImagePixelType::Float);
     return out.transformChannel(in, channelSrc, scale, bias, 0);
 }
 
+bool
+imageDownsample(const Image& in, int factor, Image& out, ImageDownsampleMode mode)
+{
+    GUARD(!in.isEmpty() && factor >= 1, "Invalid image or factor");
+    const int width = (in.width + factor - 1) / factor;
+    const int height = (in.height + factor - 1) / factor;
+    const int channels = in.channels;
+    GUARD(out.allocate(width, height, channels), "Invalid image dimensions");
+    // Averaging srgb values darkens high contrast details, so colors are averaged in linear
+    // space. Averaging normals shortens them, so they are renormalized.
+    const int srgbChannels = mode == ImageDownsampleMode::Srgb ? getColorChannelCount(channels) : 0;
+    const bool normals = mode == ImageDownsampleMode::Normal && channels >= 3;
+
+    // Each output row accumulates its source rows, which are converted to float one at a time, so
+    // 8 and 16 bit images are never expanded to float as a whole
+    const size_t srcRowValues = static_cast<size_t>(in.width) * channels;
+    const size_t rowValues = static_cast<size_t>(width) * channels;
+    const size_t rowGrain = std::max<size_t>(1, kImageParallelGrainSize / (srcRowValues * factor));
+    WorkParallelForN(
+      height,
+      [&](size_t begin, size_t end) {
+          std::vector<float> srcRow(srcRowValues);
+          for (size_t y = begin; y < end; ++y) {
+              float* dst = out.pixels.data() + y * rowValues;
+              std::fill(dst, dst + rowValues, 0.0f);
+              const int firstRow = static_cast<int>(y) * factor;
+              const int lastRow = std::min(firstRow + factor, in.height);
+              for (int row = firstRow; row < lastRow; ++row) {
+                  in.getFloatValues(row * srcRowValues, srcRowValues, srcRow.data());
+                  if (srgbChannels > 0) {
+                      transferChannels(srcRow.data(),
+                                       channels,
+                                       0,
+                                       srgbChannels,
+                                       0,
+                                       in.width,
+                                       getSrgbToLinearTable(),
+                                       static_cast<float (*)(float)>(srgbToLinear));
+                  }
+                  for (int x = 0; x < in.width; ++x) {
+                      float* sum = dst + (x / factor) * channels;
+                      const float* src = srcRow.data() + static_cast<size_t>(x) * channels;
+                      for (int c = 0; c < channels; ++c) {
+                          sum[c] += src[c];
+                      }
+                  }
+              }
+              const int rows = lastRow - firstRow;
+              for (int x = 0; x < width; ++x) {
+                  const int columns = std::min(factor, in.width - x * factor);
+                  const float weight = 1.0f / (rows * columns);
+                  for (int c = 0; c < channels; ++c) {
+                      dst[x * channels + c] *= weight;
+                  }
+              }
+              if (srgbChannels > 0) {
+                  transferChannels(dst,
+                                   channels,
+                                   0,
+                                   srgbChannels,
+                                   0,
+                                   width,
+                                   getLinearToSrgbTable(),
+                                   static_cast<float (*)(float)>(linearToSRGB));
+              } else if (normals) {
+                  renormalizeNormals(dst, channels, width);
+              }
+          }
+      },
+      rowGrain);
+    return true;
+}
+
 void
 imageWrite(const adobe::usd::ImageAsset& image, const std::string& filename, bool overwrite)
 {
@@ -517,6 +866,205 @@ imageWrite(const adobe::usd::ImageAsset& image, const std::string& filename, boo
     ofile.close();
 }
 
+std::vector<int>
+deduplicateImages(std::vector<ImageAsset>& images)
+{
+    std::vector<uint64_t> hashes(images.size());
+    WorkParallelForN(
+      images.size(),
+      [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+              const ImageBuffer& bytes = images[i].image;
+              if (!bytes.empty()) {
+                  hashes[i] =
+                    ArchHash64(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+              }
+          }
+      },
+      1);
+
+    std::vector<int> remap(images.size());
+    std::vector<ImageAsset> unique;
+    std::unordered_multimap<uint64_t, int> uniqueByHash;
+    for (size_t i = 0; i < images.size(); ++i) {
+        const ImageBuffer& bytes = images[i].image;
+        int index = -1;
+        if (!bytes.empty()) {
+            // Hashes only select the candidates, the bytes decide
+            const auto [first, last] = uniqueByHash.equal_range(hashes[i]);
+            for (auto it = first; it != last && index < 0; ++it) {
+                const ImageBuffer& other = unique[it->second].image;
+                if (other.sharesWith(bytes) ||
+                    (other.size() == bytes.size() &&
+                     std::equal(bytes.begin(), bytes.end(), other.begin()))) {
+                    index = it->second;
+                }
+            }
+        }
+        if (index < 0) {
+            index = unique.size();
+            if (!bytes.empty()) {
+                uniqueByHash.emplace(hashes[i], index);
+            }
+            unique.push_back(std::move(images[i]));
+        } else {
+            TF_DEBUG_MSG(FILE_FORMAT_UTIL,
+                         "Image %s has the same content as %s\n",
+                         images[i].uri.c_str(),
+                         unique[index].uri.c_str());
+        }
+        remap[i] = index;
+    }
+    profileAddCounter("duplicateImages", images.size() - unique.size());
+    images = std::move(unique);
+    return remap;
+}
+
+bool
+readImageInfo(const ImageAsset& imageAsset, int& width, int& height, int& channels)
+{
+    std::string extension = getFormatExtension(imageAsset.format);
+    if (extension.empty() || imageAsset.image.empty()) {
+        return false;
+    }
+    OIIO::Filesystem::IOMemReader memreader(
+      const_cast<void*>(reinterpret_cast<const void*>(imageAsset.image.data())),
+      imageAsset.image.size());
+    void* ptr = &memreader;
+    OIIO::ImageSpec config;
+    config.attribute("oiio:ioproxy", OIIO::TypeDesc::PTR, &ptr);
+    std::string filename = "dummy." + extension;
+    std::unique_ptr<OIIO::ImageInput> input = OIIO::ImageInput::open(filename, &config);
+    if (!input) {
+        TF_WARN("readImageInfo() OpenImageIO failed to open ImageInput with URI=%s: %s\n",
+                imageAsset.uri.c_str(),
+                OIIO::geterror().c_str());
+        return false;
+    }
+    const OIIO::ImageSpec& spec = input->spec();
+    width = spec.width;
+    height = spec.height;
+    channels = spec.nchannels;
+    input->close();
+    return width > 0 && height > 0 && channels > 0;
+}
+
+std::string
+getProxyImageUri(const std::string& uri, int maxSize, ImageDownsampleMode mode)
+{
+    const std::string extension = TfGetExtension(uri);
+    std::string proxy = ".proxy" + std::to_string(maxSize);
+    if (mode == ImageDownsampleMode::Srgb) {
+        proxy += "s";
+    } else if (mode == ImageDownsampleMode::Normal) {
+        proxy += "n";
+    }
+    if (extension.empty()) {
+        return uri + proxy;
+    }
+    return uri.substr(0, uri.size() - extension.size() - 1) + proxy + "." + extension;
+}
+
+bool
+parseProxyImageUri(const std::string& proxyUri,
+                   std::string& uri,
+                   int& maxSize,
+                   ImageDownsampleMode& mode)
+{
+    static const std::string marker = ".proxy";
+    const size_t markerPos = proxyUri.rfind(marker);
+    if (markerPos == std::string::npos) {
+        return false;
+    }
+    const size_t digits = markerPos + marker.size();
+    size_t end = digits;
+    while (end < proxyUri.size() && std::isdigit(static_cast<unsigned char>(proxyUri[end]))) {
+        end++;
+    }
+    const size_t digitsEnd = end;
+    mode = ImageDownsampleMode::Linear;
+    if (end < proxyUri.size() && (proxyUri[end] == 's' || proxyUri[end] == 'n')) {
+        mode = proxyUri[end] == 's' ? ImageDownsampleMode::Srgb : ImageDownsampleMode::Normal;
+        end++;
+    }
+    // The size is followed by the mode and the extension, if any, and limited to a sensible number
+    // of digits
+    if (digitsEnd == digits || digitsEnd - digits > 6 ||
+        (end < proxyUri.size() && proxyUri[end] != '.')) {
+        return false;
+    }
+    maxSize = std::stoi(proxyUri.substr(digits, digitsEnd - digits));
+    uri = proxyUri.substr(0, markerPos) + proxyUri.substr(end);
+    return maxSize > 0;
+}
+
+bool
+parseProxyImageUri(const std::string& proxyUri, std::string& uri, int& maxSize)
+{
+    ImageDownsampleMode mode;
+    return parseProxyImageUri(proxyUri, uri, maxSize, mode);
+}
+
+bool
+makeProxyImage(const ImageAsset& image, int maxSize, ImageAsset& proxy, ImageDownsampleMode mode)
+{
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    if (maxSize <= 0 || !readImageInfo(image, width, height, channels) ||
+        std::max(width, height) <= maxSize) {
+        return false;
+    }
+    int factor = 2;
+    while ((std::max(width, height) + factor - 1) / factor > maxSize) {
+        factor *= 2;
+    }
+
+    Image source;
+    GUARD(source.read(image, -1, true), "Couldn't read image %s", image.uri.c_str());
+    Image reduced;
+    GUARD(imageDownsample(source, factor, reduced, mode),
+          "Couldn't downsample image %s",
+          image.uri.c_str());
+    proxy.name = image.name;
+    proxy.uri = getProxyImageUri(image.uri, maxSize, mode);
+    proxy.format = image.format;
+    GUARD(reduced.write(proxy), "Couldn't write proxy of image %s", image.uri.c_str());
+    TF_DEBUG_MSG(FILE_FORMAT_UTIL,
+                 "Proxy %s: %dx%d -> %dx%d\n",
+                 proxy.uri.c_str(),
+                 width,
+                 height,
+                 reduced.width,
+                 reduced.height);
+    return true;
+}
+
+size_t
+makeProxyImages(std::vector<ImageAsset>& images,
+                int maxSize,
+                const std::vector<ImageDownsampleMode>& modes)
+{
+    std::vector<char> replaced(images.size(), false);
+    WorkParallelForN(
+      images.size(),
+      [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+              ImageAsset proxy;
+              const ImageDownsampleMode mode =
+                i < modes.size() ? modes[i] : ImageDownsampleMode::Linear;
+              if (makeProxyImage(images[i], maxSize, proxy, mode)) {
+                  images[i] = std::move(proxy);
+                  replaced[i] = true;
+              }
+          }
+      },
+      1);
+    const size_t count = std::count(replaced.begin(), replaced.end(), true);
+    profileAddCounter("proxyImages", count);
+    return count;
+}
+
 float
 srgbToLinear(float s)
 {
@@ -533,6 +1081,217 @@ linearToSRGB(float s)
     return 1.055f * std::pow(s, (1.0f / 2.4f)) - 0.055f;
 }
 
+namespace {
+
+// Number of intervals of the tables that convert float components in [0, 1]. With linear
+// interpolation, this keeps the srgb to linear conversion within 5e-7 of the exact one, and the
+// linear to srgb conversion within 5e-6, the largest error being just above its linear segment.
+constexpr int kTransferTableSize = 1 << 14;
+
+template<typename Fn>
+std::vector<float>
+buildTransferTable(Fn fn)
+{
+    std::vector<float> table(kTransferTableSize + 1);
+    for (int i = 0; i <= kTransferTableSize; i++) {
+        table[i] = fn(static_cast<float>(i) / kTransferTableSize);
+    }
+    return table;
+}
+
+const float*
+getSrgbToLinearTable()
+{
+    static const std::vector<float> table =
+      buildTransferTable([](float s) { return srgbToLinear(s); });
+    return table.data();
+}
+
+const float*
+getLinearToSrgbTable()
+{
+    static const std::vector<float> table =
+      buildTransferTable([](float s) { return linearToSRGB(s); });
+    return table.data();
+}
+
+// The linear value of every 8 or 16 bit srgb value, exactly as srgbToLinear() computes it from
+// the value decoded as float
+std::vector<float>
+buildIntegerSrgbToLinearTable(ImagePixelType pixelType)
+{
+    const size_t size = pixelType == ImagePixelType::UInt8 ? 1 << 8 : 1 << 16;
+    std::vector<uint16_t> values(size);
+    for (size_t i = 0; i < size; i++) {
+        values[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<uint8_t> bytes(size);
+    const void* src = values.data();
+    if (pixelType == ImagePixelType::UInt8) {
+        std::copy(values.begin(), values.end(), bytes.begin());
+        src = bytes.data();
+    }
+    std::vector<float> table(size);
+    OIIO::convert_pixel_values(
+      getTypeDesc(pixelType), src, OIIO::TypeDesc::FLOAT, table.data(), static_cast<int>(size));
+    for (float& value : table) {
+        value = srgbToLinear(value);
+    }
+    return table;
+}
+
+const float*
+getIntegerSrgbToLinearTable(ImagePixelType pixelType)
+{
+    if (pixelType == ImagePixelType::UInt8) {
+        static const std::vector<float> table8 = buildIntegerSrgbToLinearTable(pixelType);
+        return table8.data();
+    }
+    static const std::vector<float> table16 = buildIntegerSrgbToLinearTable(pixelType);
+    return table16.data();
+}
+
+// Interpolates `table` at `s`, which must be in [0, 1]
+inline float
+lookupTransferTable(const float* table, float s)
+{
+    const float x = s * kTransferTableSize;
+    const int i = std::min(static_cast<int>(x), kTransferTableSize - 1);
+    const float t = x - i;
+    return table[i] + (table[i + 1] - table[i]) * t;
+}
+
+// Converts channels [firstChannel, firstChannel + channelCount) of the pixels [begin, end) of
+// `values`, which has `channels` channels. Components outside [0, 1] use `exactFn`.
+template<typename Fn>
+void
+transferChannels(float* values,
+                 int channels,
+                 int firstChannel,
+                 int channelCount,
+                 size_t begin,
+                 size_t end,
+                 const float* table,
+                 Fn exactFn)
+{
+    for (size_t i = begin; i < end; i++) {
+        float* pixel = values + i * channels + firstChannel;
+        for (int c = 0; c < channelCount; c++) {
+            const float s = pixel[c];
+            pixel[c] = s >= 0.0f && s <= 1.0f ? lookupTransferTable(table, s) : exactFn(s);
+        }
+    }
+}
+
+bool
+validateTransferChannels(const Image& image, int firstChannel, int channelCount)
+{
+    if (firstChannel < 0 || channelCount < 0 || firstChannel + channelCount > image.channels) {
+        TF_WARN("Invalid channels [%d, %d) for an image with %d channels",
+                firstChannel,
+                firstChannel + channelCount,
+                image.channels);
+        return false;
+    }
+    return true;
+}
+}
+
+void
+srgbToLinear(float* values, size_t count)
+{
+    transferChannels(values,
+                     1,
+                     0,
+                     1,
+                     0,
+                     count,
+                     getSrgbToLinearTable(),
+                     static_cast<float (*)(float)>(srgbToLinear));
+}
+
+void
+linearToSRGB(float* values, size_t count)
+{
+    transferChannels(values,
+                     1,
+                     0,
+                     1,
+                     0,
+                     count,
+                     getLinearToSrgbTable(),
+                     static_cast<float (*)(float)>(linearToSRGB));
+}
+
+bool
+imageSrgbToLinear(Image& image, int firstChannel, int channelCount)
+{
+    if (!validateTransferChannels(image, firstChannel, channelCount)) {
+        return false;
+    }
+    const size_t pixelCount = static_cast<size_t>(image.width) * image.height;
+    const int channels = image.channels;
+    if (image.pixelType == ImagePixelType::UInt8 || image.pixelType == ImagePixelType::UInt16) {
+        // Integer values have an exact entry in a table, which also covers the conversion to float
+        const float* table = getIntegerSrgbToLinearTable(image.pixelType);
+        std::vector<float> values(image.getValueCount());
+        image.getFloatValues(0, values.size(), values.data());
+        const uint8_t* src8 = image.getPixels<uint8_t>();
+        const uint16_t* src16 = image.getPixels<uint16_t>();
+        forEachRange(pixelCount, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const size_t first = i * channels + firstChannel;
+                for (int c = 0; c < channelCount; c++) {
+                    values[first + c] = table[src8 ? src8[first + c] : src16[first + c]];
+                }
+            }
+        });
+        image.nativePixels = std::vector<uint8_t>();
+        image.pixels = std::move(values);
+        image.pixelType = ImagePixelType::Float;
+        return true;
+    }
+
+    image.convertToFloat();
+    const float* table = getSrgbToLinearTable();
+    float* values = image.pixels.data();
+    forEachRange(pixelCount, [&](size_t begin, size_t end) {
+        transferChannels(values,
+                         channels,
+                         firstChannel,
+                         channelCount,
+                         begin,
+                         end,
+                         table,
+                         static_cast<float (*)(float)>(srgbToLinear));
+    });
+    return true;
+}
+
+bool
+imageLinearToSRGB(Image& image, int firstChannel, int channelCount)
+{
+    if (!validateTransferChannels(image, firstChannel, channelCount)) {
+        return false;
+    }
+    const size_t pixelCount = static_cast<size_t>(image.width) * image.height;
+    const int channels = image.channels;
+    image.convertToFloat();
+    const float* table = getLinearToSrgbTable();
+    float* values = image.pixels.data();
+    forEachRange(pixelCount, [&](size_t begin, size_t end) {
+        transferChannels(values,
+                         channels,
+                         firstChannel,
+                         channelCount,
+                         begin,
+                         end,
+                         table,
+                         static_cast<float (*)(float)>(linearToSRGB));
+    });
+    return true;
+}
+
 static std::string
 _getAssetFileExtension(const std::string& resolvedAssetPath)
 {
@@ -17,8 +17,10 @@ governing permissions and limitations under the License.
 #include <fileformatutils/geometry.h>
 #include <fileformatutils/images.h>
 #include <fileformatutils/layerWriteShared.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/usdData.h>
 
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdGeom/camera.h>
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
@@ -407,6 +409,40 @@ findTextureCoordinatePrimvars(const UsdGeomPrimvarsAPI& api)
     return texCoordPrimvarNames;
 }
 
+// After reading the geometry subsets and potentially triangulating and expanding the mesh to force
+// vertex interpolation we pre-compute a set of face vertex indices for each subset that index into
+// the points buffer of the main mesh
+void
+computeSubsetFaceVertexIndices(Mesh& mesh)
+{
+    for (Subset& subset : mesh.subsets) {
+        // Compute the face vertex indices of the subset based on the face indices that define the
+        // subset
+        computeFaceVertexIndicesForSubset(mesh.faces, mesh.indices, subset.faces, subset.indices);
+    }
+}
+
+// Triangulates the meshes collected while reading the prims, concurrently, since they are
+// independent of each other
+void
+triangulateMeshes(ReadLayerContext& ctx)
+{
+    ProfilePhase triangulatePhase("triangulate");
+    WorkParallelForN(ctx.meshesToTriangulate.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Mesh& mesh = ctx.usd->meshes[ctx.meshesToTriangulate[i]];
+            if (triangulateMesh(mesh)) {
+                // Separate flag for this?
+                forceVertexInterpolation(mesh);
+            } else {
+                // The topology is left untouched, the subsets still index into it below
+                TF_WARN("Failed to triangulate mesh %s", mesh.name.c_str());
+            }
+            computeSubsetFaceVertexIndices(mesh);
+        }
+    });
+}
+
 bool
 readMeshOrPointsData(ReadLayerContext& ctx, Mesh& mesh, int meshIndex, const UsdPrim& prim)
 {
@@ -557,21 +593,10 @@ readMeshOrPointsData(ReadLayerContext& ctx, Mesh& mesh, int meshIndex, const Usd
         }
 
         if (ctx.options->triangulate) {
-            if (!triangulateMesh(mesh)) {
-                return false;
-            }
-            // Separate flag for this?
-            forceVertexInterpolation(mesh);
-        }
-
-        // After reading the geometry subsets and potentially triangulating and expanding the mesh
-        // to force vertex interpolation we pre-compute a set of face vertex indices for each subset
-        // that index into the points buffer of the main mesh
-        for (Subset& subset : mesh.subsets) {
-            // Compute the face vertex indices of the subset based on the face indices that define
-            // the subset
-            computeFaceVertexIndicesForSubset(
-              mesh.faces, mesh.indices, subset.faces, subset.indices);
+            // The meshes are triangulated together in triangulateMeshes
+            ctx.meshesToTriangulate.push_back(meshIndex);
+        } else {
+            computeSubsetFaceVertexIndices(mesh);
         }
     } else if (prim.IsA<UsdGeomPoints>()) {
         mesh.asPoints = true;
@@ -1509,6 +1534,7 @@ readLayer(const ReadLayerOptions& options,
           const std::string& debugTag)
 {
     TF_DEBUG_MSG(FILE_FORMAT_UTIL, "%s: layer::read Start\n", debugTag.c_str());
+    ProfilePhase readPhase("readLayer");
     auto layer = SdfCreateNonConstHandle<SdfLayer>(&constLayer);
     auto stage = UsdStage::Open(layer);
     ReadLayerContext ctx;
@@ -1521,6 +1547,8 @@ readLayer(const ReadLayerOptions& options,
         usd.metersPerUnit = UsdGeomGetStageMetersPerUnit(ctx.stage);
     }
     usd.metadata = stage->GetRootLayer()->GetCustomLayerData();
+    // The profiling stats of the import that produced the layer are not carried over to exports
+    usd.metadata.erase(kProfileStatsCustomDataKey);
     usd.timeCodesPerSecond = stage->GetTimeCodesPerSecond();
 
     UsdPrim defaultPrim;
@@ -1544,11 +1572,16 @@ readLayer(const ReadLayerOptions& options,
     splitAnimationTracks(usd);
 
     resolveMaterialBindings(ctx);
+
+    triangulateMeshes(ctx);
     TF_DEBUG_MSG(FILE_FORMAT_UTIL, "%s: layer::read End\n", ctx.debugTag.c_str());
 
     // These checks are only active when the the FILE_FORMAT_UTIL TfDebug flag is on
     checkAndPrintMeshIssues(usd);
 
+    readPhase.stop();
+    profileAddUsdDataCounters(usd);
+
     return true;
 }
 }
@@ -234,7 +234,9 @@ readImage(ReadLayerContext& ctx, const SdfAssetPath& assetPath)
             // "material_roughness.png"). image.uri has not been assigned yet at this point, so it
             // cannot be used as the filename.
             std::string transcodedFilename = name + "." + extension;
-            transcodeImageAssetToMemory(resolvedAssetPath, transcodedFilename, image.image);
+            std::vector<uint8_t> transcoded;
+            transcodeImageAssetToMemory(resolvedAssetPath, transcodedFilename, transcoded);
+            image.image = std::move(transcoded);
             // Update filePath so that image.uri uses the transcoded extension, not ".sbsarimage"
             filePath = transcodedFilename;
         } else {
@@ -244,8 +246,16 @@ readImage(ReadLayerContext& ctx, const SdfAssetPath& assetPath)
     } else {
         auto asset = ArGetResolver().OpenAsset(ArResolvedPath(resolvedAssetPath));
         if (asset) {
-            image.image.resize(asset->GetSize());
-            memcpy(image.image.data(), asset->GetBuffer().get(), asset->GetSize());
+            // In memory assets, like the images of the package resolvers, are shared rather than
+            // copied. Assets backed by a file are copied, so the file isn't kept mapped.
+            std::shared_ptr<const char> buffer = asset->GetBuffer();
+            if (buffer && !asset->GetFileUnsafe().first) {
+                image.image = ImageBuffer(
+                  std::reinterpret_pointer_cast<const uint8_t>(buffer), asset->GetSize());
+            } else if (buffer) {
+                image.image =
+                  ImageBuffer(reinterpret_cast<const uint8_t*>(buffer.get()), asset->GetSize());
+            }
         } else {
             if (ctx.warnAboutMissingAssets) {
                 TF_WARN("%s: Unable to open asset: %s\n",
@@ -14,9 +14,11 @@ governing permissions and limitations under the License.
 #include <fileformatutils/common.h>
 #include <fileformatutils/debugCodes.h>
 #include <fileformatutils/geometry.h>
+#include <fileformatutils/images.h>
 #include <fileformatutils/layerWriteMaterial.h>
 #include <fileformatutils/layerWriteOpenPBR.h>
 #include <fileformatutils/naming.h>
+#include <fileformatutils/profiling.h>
 #include <fileformatutils/sdfMaterialUtils.h>
 #include <fileformatutils/sdfUtils.h>
 #include <fileformatutils/usdData.h>
@@ -25,6 +27,7 @@ governing permissions and limitations under the License.
 #include <pxr/base/gf/range3f.h>
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/assetPath.h>
 #include <pxr/usd/usdGeom/tokens.h>
@@ -62,6 +65,8 @@ TF_DEFINE_PRIVATE_TOKENS(_tokens,
     ((primarySetting, "PrimarySetting"))
     // Geometry subsets
     ((subsetFamilyMaterialBindFamilyType, "subsetFamily:materialBind:familyType"))
+    // Point instancers
+    ((prototype, kPointInstancerPrototypeName))
 );
 // clang-format on
 
@@ -393,36 +398,44 @@ _writeRenderSettingsPrim(SdfAbstractData* sdfData, const SdfPath& parentPath)
 }
 
 template<typename T, typename CT = T>
+SdfTimeSampleMap
+_buildTimeSamples(const TimeValues<T>& timeValues, const Node& node, const TfToken& attribute)
+{
+    // Defense-in-depth: a TimeValues with mismatched times/values sizes can be produced by
+    // malformed input (e.g. a glTF animation sampler whose input and output accessors disagree on
+    // count). Indexing values[i] using times.size() as the bound would read past the values
+    // buffer. Clamp to the shorter of the two.
+    SdfTimeSampleMap timeSamples;
+    const size_t pairedCount = std::min(timeValues.times.size(), timeValues.values.size());
+    if (pairedCount != timeValues.times.size()) {
+        TF_WARN("%s of node %s has %zu times but %zu values; truncating to %zu samples",
+                attribute.GetText(),
+                node.name.c_str(),
+                timeValues.times.size(),
+                timeValues.values.size(),
+                pairedCount);
+    }
+    for (size_t i = 0; i < pairedCount; ++i) {
+        timeSamples.emplace(timeValues.times[i], VtValue(CT(timeValues.values[i])));
+    }
+    return timeSamples;
+}
+
 void
 _writeTimeSamples(SdfAbstractData* sdfData,
                   const SdfPath& propertyPath,
-                  const TimeValues<T>& timeValues)
+                  const SdfTimeSampleMap& timeSamples)
 {
-    if (!timeValues.times.empty()) {
-        // Defense-in-depth: a TimeValues with mismatched times/values sizes can be produced
-        // by malformed input (e.g. a glTF animation sampler whose input and output accessors
-        // disagree on count). Indexing values[i] using times.size() as the bound would read
-        // past the values buffer. Clamp to the shorter of the two.
-        const size_t pairedCount = std::min(timeValues.times.size(), timeValues.values.size());
-        if (pairedCount != timeValues.times.size()) {
-            TF_WARN("TimeValues for <%s> has %zu times but %zu values; truncating to %zu samples",
-                    propertyPath.GetText(),
-                    timeValues.times.size(),
-                    timeValues.values.size(),
-                    pairedCount);
-        }
-        SdfTimeSampleMap timeSamples;
-        for (size_t i = 0; i < pairedCount; ++i) {
-            timeSamples.emplace(timeValues.times[i], VtValue(CT(timeValues.values[i])));
-        }
-        if (!timeSamples.empty()) {
-            setAttributeTimeSampledValues(sdfData, propertyPath, timeSamples);
-        }
+    if (!timeSamples.empty()) {
+        setAttributeTimeSampledValues(sdfData, propertyPath, timeSamples);
     }
 }
 
 void
-_writeXformAttributes(SdfAbstractData* sdfData, const SdfPath& primPath, const Node& node)
+_writeXformAttributes(SdfAbstractData* sdfData,
+                      const SdfPath& primPath,
+                      const Node& node,
+                      const NodeTimeSamples& timeSamples)
 {
     // At this point in time there should only 1 animations per node
     if (node.animations.size() > 1) {
@@ -449,8 +462,7 @@ _writeXformAttributes(SdfAbstractData* sdfData, const SdfPath& primPath, const N
         if (hasTranslation) {
             setAttributeDefaultValue(sdfData, p, node.translation, SdfValueTypeNames->Double3);
         }
-        // XXX currently the translations is stored as GfVec3f, but needs to be authored as GfVec3d
-        _writeTimeSamples<GfVec3f, GfVec3d>(sdfData, p, nodeAnimation.translations);
+        _writeTimeSamples(sdfData, p, timeSamples.translations);
     }
     bool hasRotation = node.rotation != GfQuatf(0);
     if (hasRotation || nodeAnimation.rotations.times.size()) {
@@ -461,7 +473,7 @@ _writeXformAttributes(SdfAbstractData* sdfData, const SdfPath& primPath, const N
         if (hasRotation) {
             setAttributeDefaultValue(sdfData, p, node.rotation, SdfValueTypeNames->Quatf);
         }
-        _writeTimeSamples(sdfData, p, nodeAnimation.rotations);
+        _writeTimeSamples(sdfData, p, timeSamples.rotations);
     }
     bool hasScale = node.scale != GfVec3f(1);
     if (hasScale || nodeAnimation.scales.times.size()) {
@@ -472,7 +484,7 @@ _writeXformAttributes(SdfAbstractData* sdfData, const SdfPath& primPath, const N
         if (hasScale) {
             setAttributeDefaultValue(sdfData, p, node.scale, SdfValueTypeNames->Float3);
         }
-        _writeTimeSamples(sdfData, p, nodeAnimation.scales);
+        _writeTimeSamples(sdfData, p, timeSamples.scales);
     }
     if (node.hasTransform && node.transform != GfMatrix4d().SetIdentity()) {
         SdfPath p = createAttributeSpec(
@@ -671,6 +683,7 @@ _writeMesh(SdfAbstractData* sdfData,
            const SdfPath& parentPath,
            const SdfPathVector& materialMap,
            const Mesh& mesh,
+           const VtVec3fArray& extent,
            const std::string& meshName,
            const SdfPath& skeletonPath = SdfPath::EmptyPath())
 {
@@ -708,13 +721,8 @@ _writeMesh(SdfAbstractData* sdfData,
 
     // Author extent so downstream UsdGeomBBoxCache queries are O(1); without it bounds are
     // re-derived from every vertex on each selection, framing and gizmo query.
-    if (!mesh.points.empty()) {
-        GfRange3f extent;
-        for (const GfVec3f& pt : mesh.points) {
-            extent.UnionWith(pt);
-        }
-        VtVec3fArray extentArray{ extent.GetMin(), extent.GetMax() };
-        createAttr(UsdGeomTokens->extent, SdfValueTypeNames->Float3Array, extentArray);
+    if (!extent.empty()) {
+        createAttr(UsdGeomTokens->extent, SdfValueTypeNames->Float3Array, extent);
     }
 
     // Subdivision rules
@@ -793,13 +801,19 @@ void
 _writePointsOrMesh(WriteSdfContext& ctx,
                    const SdfPath& parentPath,
                    const Mesh& mesh,
+                   int meshIndex,
                    const SdfPath& skeletonPath = SdfPath::EmptyPath())
 {
     if (mesh.asPoints) {
         _writePoints(ctx.sdfData, parentPath, mesh);
     } else {
-        SdfPath meshPath =
-          _writeMesh(ctx.sdfData, parentPath, ctx.materialMap, mesh, mesh.name, skeletonPath);
+        SdfPath meshPath = _writeMesh(ctx.sdfData,
+                                      parentPath,
+                                      ctx.materialMap,
+                                      mesh,
+                                      ctx.meshExtents[meshIndex],
+                                      mesh.name,
+                                      skeletonPath);
         _bindMeshMaterial(ctx.sdfData, meshPath, ctx.materialMap, mesh);
     }
 }
@@ -834,7 +848,8 @@ _writeInstancedMesh(WriteSdfContext& ctx,
         prototypePath =
           createPrimSpec(ctx.sdfData, parentPath, meshPrototypeName, TfToken(), SdfSpecifierOver);
 
-        _writeMesh(ctx.sdfData, prototypePath, ctx.materialMap, mesh, meshName);
+        _writeMesh(
+          ctx.sdfData, prototypePath, ctx.materialMap, mesh, ctx.meshExtents[meshIdx], meshName);
 
         // Add this to the list of prototypes
         ctx.meshPrototypeMap[meshIdx] = prototypePath;
@@ -863,6 +878,76 @@ _writeInstancedMesh(WriteSdfContext& ctx,
                  meshName.c_str());
 }
 
+void
+_writeStaticMeshes(WriteSdfContext& ctx,
+                   const SdfPath& parentPath,
+                   const std::vector<int>& meshIndices)
+{
+    // Uninstanced meshes first
+    for (int meshIndex : meshIndices) {
+        const Mesh& mesh = ctx.usdData->meshes[meshIndex];
+        if (!mesh.instanceable) {
+            _writePointsOrMesh(ctx, parentPath, mesh, meshIndex);
+        }
+    }
+
+    // Instanced meshes second. They need a name resolution to make sure they are unique
+    UniqueNameEnforcer enforcer;
+    for (int meshIndex : meshIndices) {
+        const Mesh& mesh = ctx.usdData->meshes[meshIndex];
+        if (mesh.instanceable) {
+            std::string meshName = mesh.name;
+            enforcer.enforceUniqueness(meshName);
+            _writeInstancedMesh(ctx, parentPath, mesh, meshIndex, meshName);
+        }
+    }
+}
+
+// Writes a UsdGeomPointInstancer with a single prototype, an Xform holding the instanced meshes.
+// The prototype is nested under the instancer, so it is only drawn through the instances.
+SdfPath
+_writePointInstancer(WriteSdfContext& ctx,
+                     const SdfPath& parentPath,
+                     const PointInstancer& instancer)
+{
+    SdfPath primPath = createPrimSpec(
+      ctx.sdfData, parentPath, TfToken(instancer.name), UsdGeomTokens->PointInstancer);
+    if (!instancer.displayName.empty()) {
+        setPrimMetadata(
+          ctx.sdfData, primPath, SdfFieldKeys->DisplayName, VtValue(instancer.displayName));
+    }
+
+    SdfPath prototypePath =
+      createPrimSpec(ctx.sdfData, primPath, _tokens->prototype, UsdGeomTokens->Xform);
+    _writeStaticMeshes(ctx, prototypePath, instancer.meshes);
+    SdfPath prototypesPath =
+      createRelationshipSpec(ctx.sdfData, primPath, UsdGeomTokens->prototypes);
+    appendRelationshipTarget(ctx.sdfData, prototypesPath, prototypePath);
+
+    auto createAttr = [&](const TfToken& name, const SdfValueTypeName& type, const auto& value) {
+        SdfPath p = createAttributeSpec(ctx.sdfData, primPath, name, type);
+        setAttributeDefaultValue(ctx.sdfData, p, value, type);
+    };
+    createAttr(UsdGeomTokens->protoIndices,
+               SdfValueTypeNames->IntArray,
+               VtIntArray(instancer.positions.size(), 0));
+    createAttr(UsdGeomTokens->positions, SdfValueTypeNames->Point3fArray, instancer.positions);
+    if (!instancer.orientations.empty()) {
+        createAttr(
+          UsdGeomTokens->orientations, SdfValueTypeNames->QuathArray, instancer.orientations);
+    }
+    if (!instancer.scales.empty()) {
+        createAttr(UsdGeomTokens->scales, SdfValueTypeNames->Float3Array, instancer.scales);
+    }
+
+    TF_DEBUG_MSG(FILE_FORMAT_UTIL,
+                 "layer::write point instancer %s, %zu instances of %zu meshes\n",
+                 primPath.GetText(),
+                 instancer.positions.size(),
+                 instancer.meshes.size());
+    return primPath;
+}
+
 // Layout of control points in USD is: row-major with U considered rows, and V columns.
 // So: u0v0, u0v1, ... u0vx, u1v0, ...
 // but after tests, seems USD is really column-major, as are its transforms.
@@ -1012,10 +1097,12 @@ _writeNodes(WriteSdfContext& ctx,
 void
 _createNode(WriteSdfContext& ctx,
             const SdfPath& parentPath,
-            const Node& node,
+            int nodeIndex,
             std::vector<SdfPath>& childPaths,
             std::vector<TfToken>& children)
 {
+    const Node& node = ctx.usdData->nodes[nodeIndex];
+
     // Uniquify the node name against siblings already created under this parent (including the
     // synthesized "Materials" scope, which the import-time uniquify pass cannot see). The same
     // uniquified name must be used for the spec path AND the child token added to the parent's
@@ -1036,7 +1123,6 @@ _createNode(WriteSdfContext& ctx,
         setPrimMetadata(ctx.sdfData, primPath, SdfFieldKeys->DisplayName, VtValue(displayName));
     }
 
-    int nodeIndex = std::distance(ctx.usdData->nodes.data(), &node);
     ctx.nodeMap[nodeIndex] = primPath;
 
     childPaths.push_back(primPath);
@@ -1047,9 +1133,10 @@ _createNode(WriteSdfContext& ctx,
 // Note when the node cache data contains SkelMesh data, it spawns an extra UsdSkelRoot prim
 // with its associated relationships/prims.
 bool
-_writeNode(WriteSdfContext& ctx, const SdfPath& primPath, const Node& node)
+_writeNode(WriteSdfContext& ctx, const SdfPath& primPath, int nodeIndex)
 {
-    _writeXformAttributes(ctx.sdfData, primPath, node);
+    const Node& node = ctx.usdData->nodes[nodeIndex];
+    _writeXformAttributes(ctx.sdfData, primPath, node, ctx.nodeTimeSamples[nodeIndex]);
 
     // The display name will have already been set by uniquifyNames() if the original node name
     // was sanitized, so we don't need to check the node name
@@ -1074,24 +1161,11 @@ _writeNode(WriteSdfContext& ctx, const SdfPath& primPath, const Node& node)
         _writeLight(ctx.sdfData, primPath, ctx.usdData->lights[node.light]);
     }
 
-    // Uninstanced meshes first
-    for (int meshIndex : node.staticMeshes) {
-        const Mesh& mesh = ctx.usdData->meshes[meshIndex];
-        if (!mesh.instanceable) {
-            _writePointsOrMesh(ctx, primPath, mesh);
-        }
+    if (node.pointInstancer >= 0) {
+        _writePointInstancer(ctx, primPath, ctx.usdData->pointInstancers[node.pointInstancer]);
     }
 
-    // Instanced meshes second. They need a name resolution to make sure they are unique
-    UniqueNameEnforcer enforcer;
-    for (int meshIndex : node.staticMeshes) {
-        const Mesh& mesh = ctx.usdData->meshes[meshIndex];
-        if (mesh.instanceable) {
-            std::string meshName = mesh.name;
-            enforcer.enforceUniqueness(meshName);
-            _writeInstancedMesh(ctx, primPath, mesh, meshIndex, meshName);
-        }
-    }
+    _writeStaticMeshes(ctx, primPath, node.staticMeshes);
 
     // Curves
     for (int curveIndex : node.curves) {
@@ -1111,29 +1185,32 @@ _writeNode(WriteSdfContext& ctx, const SdfPath& primPath, const Node& node)
 }
 
 void
-_writeNodes(WriteSdfContext& ctx, const SdfPath& parentPath, const std::vector<const Node*>& nodes)
+_writeNodes(WriteSdfContext& ctx,
+            const SdfPath& parentPath,
+            const std::vector<int>& childNodeIndices)
 {
-    if (nodes.empty())
+    if (childNodeIndices.empty())
         return;
 
     std::vector<SdfPath> childPaths;
     std::vector<TfToken> childTokens;
-    std::vector<const Node*> nodesCreated;
-    const size_t numChildren = nodes.size();
+    std::vector<int> nodesCreated;
+    const size_t numChildren = childNodeIndices.size();
     childPaths.reserve(numChildren);
     childTokens.reserve(numChildren);
     nodesCreated.reserve(numChildren);
 
     // Create all the child prims first and then add them all as children. This is
     // much more efficient than creating each child and adding each child to the parent.
-    for (const Node* node : nodes) {
-        if (ctx.options->pruneJoints && node->isJoint) {
+    for (int nodeIndex : childNodeIndices) {
+        const Node& node = ctx.usdData->nodes[nodeIndex];
+        if (ctx.options->pruneJoints && node.isJoint) {
             TF_DEBUG_MSG(
-              FILE_FORMAT_UTIL, "sdfData::write pruned joint node %s\n", node->name.c_str());
+              FILE_FORMAT_UTIL, "sdfData::write pruned joint node %s\n", node.name.c_str());
             continue;
         }
-        _createNode(ctx, parentPath, *node, childPaths, childTokens);
-        nodesCreated.push_back(node);
+        _createNode(ctx, parentPath, nodeIndex, childPaths, childTokens);
+        nodesCreated.push_back(nodeIndex);
     }
 
     if (nodesCreated.size() > 0) {
@@ -1143,28 +1220,11 @@ _writeNodes(WriteSdfContext& ctx, const SdfPath& parentPath, const std::vector<c
         // write/convert each child node to USD
         const size_t numNewChildren = nodesCreated.size();
         for (size_t i = 0; i < numNewChildren; ++i) {
-            const Node* childNode = nodesCreated[i];
-            _writeNode(ctx, childPaths[i], *childNode);
+            _writeNode(ctx, childPaths[i], nodesCreated[i]);
         }
     }
 }
 
-void
-_writeNodes(WriteSdfContext& ctx,
-            const SdfPath& parentPath,
-            const std::vector<int>& childNodeIndices)
-{
-    if (childNodeIndices.empty())
-        return;
-    std::vector<const Node*> childNodes;
-    childNodes.reserve(childNodeIndices.size());
-    for (int childNodeIndex : childNodeIndices) {
-        const Node& childNode = ctx.usdData->nodes[childNodeIndex];
-        childNodes.push_back(&childNode);
-    }
-    _writeNodes(ctx, parentPath, childNodes);
-}
-
 void
 _writeNonParentedNodes(WriteSdfContext& ctx,
                        const SdfPath& parentPath,
@@ -1173,14 +1233,14 @@ _writeNonParentedNodes(WriteSdfContext& ctx,
     if (nodes.empty())
         return;
 
-    std::vector<const Node*> filteredNodes;
+    std::vector<int> filteredNodes;
     filteredNodes.reserve(nodes.size());
-    for (const Node& node : nodes) {
+    for (size_t i = 0; i < nodes.size(); ++i) {
         // Skip nodes with a parent, since they are a child of another node
-        if (node.parent != -1) {
+        if (nodes[i].parent != -1) {
             continue;
         }
-        filteredNodes.push_back(&node);
+        filteredNodes.push_back(static_cast<int>(i));
     }
     _writeNodes(ctx, parentPath, filteredNodes);
 }
@@ -1470,6 +1530,50 @@ _writeAnimationTracks(const WriteLayerOptions& options, UsdData& data)
     }
 }
 
+// Computes the values of the meshes and nodes that don't depend on the SdfData, concurrently,
+// since they are independent of each other. Only the authoring of the specs, which can't be
+// parallelized, is left for the traversal of the nodes.
+void
+_prepareMeshesAndNodes(WriteSdfContext& ctx)
+{
+    ProfilePhase preparePhase("prepare");
+    const UsdData& usdData = *ctx.usdData;
+    ctx.meshExtents.resize(usdData.meshes.size());
+    WorkParallelForN(usdData.meshes.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const Mesh& mesh = usdData.meshes[i];
+            if (mesh.asPoints || mesh.points.empty()) {
+                continue;
+            }
+            GfRange3f extent;
+            for (const GfVec3f& pt : mesh.points) {
+                extent.UnionWith(pt);
+            }
+            ctx.meshExtents[i] = VtVec3fArray{ extent.GetMin(), extent.GetMax() };
+        }
+    });
+
+    ctx.nodeTimeSamples.resize(usdData.nodes.size());
+    WorkParallelForN(usdData.nodes.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const Node& node = usdData.nodes[i];
+            if (node.animations.empty()) {
+                continue;
+            }
+            const NodeAnimation& nodeAnimation = node.animations.front();
+            NodeTimeSamples& timeSamples = ctx.nodeTimeSamples[i];
+            // XXX currently the translations is stored as GfVec3f, but needs to be authored as
+            // GfVec3d
+            timeSamples.translations = _buildTimeSamples<GfVec3f, GfVec3d>(
+              nodeAnimation.translations, node, _tokens->xformOpTranslate);
+            timeSamples.rotations =
+              _buildTimeSamples(nodeAnimation.rotations, node, _tokens->xformOpOrient);
+            timeSamples.scales =
+              _buildTimeSamples(nodeAnimation.scales, node, _tokens->xformOpScale);
+        }
+    });
+}
+
 bool
 _writeLayerSdfData(const WriteLayerOptions& options,
                    const UsdData& usdData,
@@ -1508,8 +1612,12 @@ _writeLayerSdfData(const WriteLayerOptions& options,
     }
 
     _writeMetadata(sdfData, usdData, rootNodePath, sourceFileType, renderSettingsPath);
+    if (options.metadataOnly) {
+        return true;
+    }
 
     phaseSW.Start();
+    ProfilePhase materialsPhase("materials");
     if (!usdData.materials.empty()) {
         ctx.materialMap.resize(usdData.materials.size());
         TfToken materialsPrimName("Materials");
@@ -1543,6 +1651,7 @@ _writeLayerSdfData(const WriteLayerOptions& options,
             printOpenPbrMaterial("layer::write", materialPath, material, ctx.debugTag);
         }
     }
+    materialsPhase.stop();
     phaseSW.Stop();
     const size_t materialCount =
       usdData.materials.empty() ? usdData.openPbrMaterials.size() : usdData.materials.size();
@@ -1556,6 +1665,8 @@ _writeLayerSdfData(const WriteLayerOptions& options,
     ctx.meshPrototypeMap.resize(usdData.meshes.size());
 
     phaseSW.Start();
+    ProfilePhase nodesPhase("nodes");
+    _prepareMeshesAndNodes(ctx);
     if (!usdData.nodes.empty()) {
         ctx.nodeMap.resize(usdData.nodes.size());
 
@@ -1569,6 +1680,7 @@ _writeLayerSdfData(const WriteLayerOptions& options,
             _writeNonParentedNodes(ctx, rootNodePath, usdData.nodes);
         }
     }
+    nodesPhase.stop();
     phaseSW.Stop();
     TF_DEBUG_MSG(FILE_FORMAT_UTIL,
                  "_writeLayerSdfData nodes time: %ld ms (%zu nodes, %zu meshes)\n",
@@ -1578,6 +1690,7 @@ _writeLayerSdfData(const WriteLayerOptions& options,
     phaseSW.Reset();
 
     // Write skeletons after nodes, as we sometimes want skeletons to be parented to the nodes
+    ProfilePhase skeletonsPhase("skeletons");
     if (!usdData.skeletons.empty()) {
         ctx.skeletonMap.resize(usdData.skeletons.size());
 
@@ -1610,7 +1723,7 @@ _writeLayerSdfData(const WriteLayerOptions& options,
                 const Mesh& mesh = ctx.usdData->meshes[meshIndex];
 
                 // Note, skinned meshes are never emitted as instanced
-                _writePointsOrMesh(ctx, skelRootPath, mesh, skeletonPath);
+                _writePointsOrMesh(ctx, skelRootPath, mesh, meshIndex, skeletonPath);
             }
 
             if (!skeleton.skeletonAnimations.empty()) {
@@ -1623,7 +1736,10 @@ _writeLayerSdfData(const WriteLayerOptions& options,
         }
     }
 
+    skeletonsPhase.stop();
+
     // If requested, write the images to files on disk
+    ProfilePhase imagesPhase("images");
     if (!options.assetsPath.empty() && usdData.images.size()) {
         const std::filesystem::path baseDir =
           std::filesystem::path(options.assetsPath).lexically_normal();
@@ -1656,6 +1772,62 @@ _writeLayerSdfData(const WriteLayerOptions& options,
     return true;
 }
 
+// The mode in which to downsample each image to its proxy, from the material inputs that use it:
+// srgb for the color inputs read as srgb, normal for the normal maps, and linear for the others. An
+// image used in two different modes falls back to linear.
+std::vector<ImageDownsampleMode>
+_getProxyImageModes(const UsdData& data)
+{
+    std::vector<ImageDownsampleMode> modes(data.images.size(), ImageDownsampleMode::Linear);
+    std::vector<bool> used(data.images.size(), false);
+    std::vector<bool> conflicting(data.images.size(), false);
+    auto useImage = [&](const Input& input, ImageDownsampleMode mode) {
+        if (input.image < 0 || static_cast<size_t>(input.image) >= data.images.size()) {
+            return;
+        }
+        if (used[input.image] && modes[input.image] != mode) {
+            conflicting[input.image] = true;
+        }
+        used[input.image] = true;
+        modes[input.image] = mode;
+    };
+    auto useColor = [&](const Input& input) {
+        const bool srgb = input.colorspace == AdobeTokens->sRGB;
+        useImage(input, srgb ? ImageDownsampleMode::Srgb : ImageDownsampleMode::Linear);
+    };
+
+    for (const Material& m : data.materials) {
+        for (const Input* input : { &m.diffuseColor,
+                                    &m.emissiveColor,
+                                    &m.specularColor,
+                                    &m.clearcoatColor,
+                                    &m.sheenColor }) {
+            useColor(*input);
+        }
+        useImage(m.normal, ImageDownsampleMode::Normal);
+        useImage(m.clearcoatNormal, ImageDownsampleMode::Normal);
+    }
+    for (const OpenPbrMaterial& m : data.openPbrMaterials) {
+        for (const Input* input : { &m.base_color,
+                                    &m.specular_color,
+                                    &m.transmission_color,
+                                    &m.subsurface_color,
+                                    &m.fuzz_color,
+                                    &m.coat_color,
+                                    &m.emission_color }) {
+            useColor(*input);
+        }
+        useImage(m.geometry_normal, ImageDownsampleMode::Normal);
+        useImage(m.geometry_coat_normal, ImageDownsampleMode::Normal);
+    }
+    for (size_t i = 0; i < modes.size(); ++i) {
+        if (conflicting[i]) {
+            modes[i] = ImageDownsampleMode::Linear;
+        }
+    }
+    return modes;
+}
+
 bool
 writeLayer(const WriteLayerOptions& options,
            UsdData& data,
@@ -1667,6 +1839,7 @@ writeLayer(const WriteLayerOptions& options,
 {
     TfStopwatch layerWriteSW;
     layerWriteSW.Start();
+    ProfilePhase writePhase("writeLayer");
 
     // These checks are only active when the the FILE_FORMAT_UTIL TfDebug flag is on
     checkAndPrintMeshIssues(data);
@@ -1675,10 +1848,19 @@ writeLayer(const WriteLayerOptions& options,
     // Note, this potentially modifies the usdData
     uniquifyNames(data);
 
+    // The proxies replace the images before the materials reference them by uri, and the callers
+    // populate the image cache with them instead of the originals
+    if (options.maxTextureSize > 0 && !options.metadataOnly) {
+        ProfilePhase proxyPhase("proxyImages");
+        makeProxyImages(data.images, options.maxTextureSize, _getProxyImageModes(data));
+    }
+
     // USD does not natively support animation tracks, so we need to put animation
     // track data into metadata, and then join all tracks together into one track
     _writeAnimationTracks(options, data);
 
+    profileAddUsdDataCounters(data);
+
     // Add file names to metadata
     if (!data.importedFileNames.empty()) {
         PXR_NS::VtArray<std::string> filenames(data.importedFileNames.begin(),
@@ -1694,6 +1876,22 @@ writeLayer(const WriteLayerOptions& options,
                              sourceFileType,
                              debugTag),
           "Error writing to the SdfData\n");
+    writePhase.stop();
+
+    // The stats are a snapshot, so they include everything up to here, but not the phases of the
+    // plugin that follow
+    ProfileStats stats;
+    if (options.writeProfileStats && getCurrentProfileStats(stats)) {
+        VtDictionary customLayerData;
+        const SdfPath& rootPath = SdfPath::AbsoluteRootPath();
+        VtValue value = sdfData->Get(rootPath, SdfFieldKeys->CustomLayerData);
+        if (value.IsHolding<VtDictionary>()) {
+            customLayerData = value.UncheckedGet<VtDictionary>();
+        }
+        customLayerData[kProfileStatsCustomDataKey] = VtValue(stats.toDictionary());
+        setLayerMetadata(
+          get_pointer(sdfData), SdfFieldKeys->CustomLayerData, VtValue(customLayerData));
+    }
 
     if (setLayerDataFn)
         setLayerDataFn(layer, sdfData);
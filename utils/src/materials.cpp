@@ -13,8 +13,15 @@ governing permissions and limitations under the License.
 #include <fileformatutils/debugCodes.h>
 #include <fileformatutils/images.h>
 #include <fileformatutils/materials.h>
+#include <fileformatutils/profiling.h>
+#include <fileformatutils/textureCache.h>
+#include <pxr/base/arch/hash.h>
 #include <pxr/base/gf/vec3f.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/pxr.h>
+#include <algorithm>
+#include <map>
+#include <unordered_map>
 #include <vector>
 
 using namespace PXR_NS;
@@ -316,6 +323,7 @@ InputTranslator::InputTranslator(bool exportImages,
     }
     mDecodedImages.resize(mImagesSrc.size());
     mDecodedMap.resize(mImagesSrc.size(), false);
+    mDiskCache = &TextureDiskCache::getInstance();
 }
 
 InputTranslator::~InputTranslator() {}
@@ -341,17 +349,27 @@ InputTranslator::translateDirectInternal(int imageIdx, Input& out)
         newAsset.uri = key;
         newAsset.name = asset.name;
         if (asset.format == ImageFormatUnknown && imageIdx < (int)mDecodedMap.size() &&
-            mDecodedMap[imageIdx]) {
+            (mDecodedMap[imageIdx] || isPendingImage(imageIdx))) {
             // Intermediate image: decoded pixels exist but no encoded bytes (format is Unknown).
             // Infer the encode format from the URI extension (e.g. a cache key ending in ".exr"
             // should stay EXR); fall back to PNG if the extension is absent or unrecognised.
             const ImageFormat inferredFormat = getFormat(TfStringGetSuffix(asset.uri));
             newAsset.format =
               (inferredFormat != ImageFormatUnknown) ? inferredFormat : ImageFormatPng;
-            mDecodedImages[imageIdx].write(newAsset);
+            if (mBatching) {
+                _BatchJob job;
+                job.reads = { { imageIdx, false } };
+                job.run = [this, imageIdx, imageIndex]() {
+                    mDecodedImages[imageIdx].write(mImagesDst[imageIndex]);
+                    return true;
+                };
+                queueJob(std::move(job));
+            } else {
+                mDecodedImages[imageIdx].write(newAsset);
+            }
         } else {
             newAsset.format = asset.format;
-            newAsset.image = asset.image; // create a copy
+            newAsset.image = asset.image; // shares the encoded bytes
         }
         mCache[key] = imageIndex;
     }
@@ -483,15 +501,25 @@ InputTranslator::translateFactor(const Input& in,
         if (it != mCache.end()) {
             imageIndex = it->second;
         } else {
-            Image outImage;
-            if (mExportImages) {
-                auto [inImageValid, inImage] = getDecodedImage(in.image);
-                auto [factorImageValid, factorImage] = getDecodedImage(factor.image);
-                GUARD(inImageValid && factorImageValid, "Invalid images");
-                imageMult(inImage, factorImage, outImage);
+            const int inIndex = in.image;
+            const int factorIndex = factor.image;
+            imageIndex = addImageJob(
+              { { inIndex, true }, { factorIndex, true } },
+              [this, inIndex, factorIndex](Image& outImage) {
+                  auto [inImageValid, inImage] = getDecodedImage(inIndex);
+                  auto [factorImageValid, factorImage] = getDecodedImage(factorIndex);
+                  GUARD(inImageValid && factorImageValid, "Invalid images");
+                  imageMult(inImage, factorImage, outImage);
+                  return true;
+              },
+              assetName,
+              key,
+              inImageAsset.format,
+              intermediate,
+              getDiskCacheKey(key, { inIndex, factorIndex }));
+            if (imageIndex < 0) {
+                return false;
             }
-            imageIndex =
-              addImage(std::move(outImage), assetName, key, inImageAsset.format, intermediate);
         }
         // Copy the input image's settings and update to the new image index
         out = in;
@@ -615,60 +643,71 @@ _getConstantInputValues(const Input& input, int outChannels, float* values)
     }
 }
 
-// Samples an input image at normalized UV coordinates using bilinear filtering.
+// The two source texels and the interpolation weight of a normalized coordinate along one axis of
+// an image, with texel centers at x+0.5.
+struct _BilinearTap
+{
+    int i0;
+    int i1;
+    float t;
+};
+
+_BilinearTap
+_getBilinearTap(float u, int size)
+{
+    // Clamp u to [0,1] first so that floor() gives a consistent i0 and t stays in [0,1)
+    const float p = std::max(0.0f, std::min(1.0f, u)) * size - 0.5f;
+    const float fp = std::floor(p);
+    const int i0 = std::max(0, static_cast<int>(fp));
+    return { i0, std::min(size - 1, i0 + 1), p - fp };
+}
+
+// How an image input is sampled into output texels, resolved once per image and input so that
+// the sampling loops neither compare channel tokens nor pick a filter per texel.
+struct _ImageSampler
+{
+    const float* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    int outChannels = 0;
+    // The leading output channels read from the image. The remaining one, if any, is an alpha of 1.
+    int sampledChannels = 0;
+    int srcChannels[4] = {};
+    float scale[4] = {};
+    float bias[4] = {};
+    // Taps of each output column, when the image is resampled to a new width without a transform
+    std::vector<_BilinearTap> columns;
+    // Whether every column lands on a texel center, so rows that do too are copied unfiltered
+    bool exactColumns = false;
+};
+
+// Resolves the channels of `input` read from `image` into `outChannels` values per texel, and the
+// column taps for resampling the image to `outWidth` texels wide. Fails if the input channel is
+// not in the image.
 bool
-_sampleInputImageBilinear(const Input& input,
-                          const Image& image,
-                          float u,
-                          float v,
-                          int outChannels,
-                          float* values)
-{
-    const int w = image.width;
-    const int h = image.height;
+_makeImageSampler(const Input& input,
+                  const Image& image,
+                  int outChannels,
+                  int outWidth,
+                  _ImageSampler& sampler)
+{
     const int ch = image.channels;
+    sampler.pixels = image.pixels.data();
+    sampler.width = image.width;
+    sampler.height = image.height;
+    sampler.channels = ch;
+    sampler.outChannels = outChannels;
 
-    // Map UV to pixel space with pixel centers at x+0.5.  Clamp UV to [0,1] first so that
-    // floor() gives consistent x0/y0 and the fractional parts tx/ty stay in [0,1).
-    const float px = std::max(0.0f, std::min(1.0f, u)) * w - 0.5f;
-    const float py = std::max(0.0f, std::min(1.0f, v)) * h - 0.5f;
-    const float fpx = std::floor(px);
-    const float fpy = std::floor(py);
-    const int x0 = std::max(0, static_cast<int>(fpx));
-    const int y0 = std::max(0, static_cast<int>(fpy));
-    const int x1 = std::min(w - 1, x0 + 1);
-    const int y1 = std::min(h - 1, y0 + 1);
-    const float tx = px - fpx;
-    const float ty = py - fpy;
-
-    // Per-corner base pointers — the (y*width + x)*channels offset is constant per corner;
-    // adding the channel index c gives the exact element without per-iteration arithmetic.
-    // p00 is always needed; p10/p01/p11 are only needed for bilinear interpolation.
-    const float* const pixels = image.pixels.data();
-    const float* const p00 = pixels + (y0 * w + x0) * ch;
-
-    // Exact-pixel fast path: when both fractional parts are zero the UV lands directly on
-    // pixel (x0, y0) — no interpolation is needed and the three other corners are never
-    // touched.  This is always the case when the source image and the output image share
-    // the same dimensions (pixel-centre UVs map back to exact integers after the round-trip).
-    if (tx == 0.0f && ty == 0.0f) {
-        if (input.channel == AdobeTokens->rgb || input.channel == AdobeTokens->rgba) {
-            const int srcChannels = std::min(outChannels, ch);
-            for (int c = 0; c < srcChannels; ++c) {
-                values[c] = p00[c] * input.scale[c] + input.bias[c];
-            }
-            if (outChannels > ch) {
-                const float lastVal = p00[ch - 1];
-                const int broadcastEnd = std::min(outChannels, 3);
-                for (int c = ch; c < broadcastEnd; ++c) {
-                    values[c] = lastVal * input.scale[c] + input.bias[c];
-                }
-                if (outChannels == 4) {
-                    values[3] = 1.0f;
-                }
-            }
-            return true;
+    if (input.channel == AdobeTokens->rgb || input.channel == AdobeTokens->rgba) {
+        // Output channels missing from the source repeat its last channel, except for alpha
+        sampler.sampledChannels = outChannels > ch ? std::min(outChannels, 3) : outChannels;
+        for (int c = 0; c < sampler.sampledChannels; ++c) {
+            sampler.srcChannels[c] = std::min(c, ch - 1);
+            sampler.scale[c] = input.scale[c];
+            sampler.bias[c] = input.bias[c];
         }
+    } else {
         int srcChannel = token2Channel(input.channel);
         if (srcChannel < 0) {
             return false;
@@ -683,82 +722,137 @@ _sampleInputImageBilinear(const Input& input,
                 return false;
             }
         }
-        const float val = p00[srcChannel] * input.scale[0] + input.bias[0];
-        values[0] = val;
-        for (int c = 1; c < outChannels; ++c) {
-            values[c] = (c == 3) ? 1.0f : val;
+        // The scalar is repeated in every output channel. A synthetic alpha is 1, not a copy.
+        sampler.sampledChannels = std::min(outChannels, 3);
+        for (int c = 0; c < sampler.sampledChannels; ++c) {
+            sampler.srcChannels[c] = srcChannel;
+            sampler.scale[c] = input.scale[0];
+            sampler.bias[c] = input.bias[0];
         }
-        return true;
     }
 
-    // Bilinear path — compute the three remaining corner pointers and the four weights.
-    const float* const p10 = pixels + (y0 * w + x1) * ch;
-    const float* const p01 = pixels + (y1 * w + x0) * ch;
-    const float* const p11 = pixels + (y1 * w + x1) * ch;
+    sampler.columns.resize(outWidth);
+    sampler.exactColumns = true;
+    for (int x = 0; x < outWidth; ++x) {
+        sampler.columns[x] = _getBilinearTap((x + 0.5f) / outWidth, sampler.width);
+        sampler.exactColumns = sampler.exactColumns && sampler.columns[x].t == 0.0f;
+    }
+    return true;
+}
 
+// Writes the output values of one texel, given its source corners and their weights. N is the
+// number of sampled channels, so that the channel loop is unrolled.
+template<int N>
+inline void
+_writeBilinearTexel(const _ImageSampler& s,
+                    const float* p00,
+                    const float* p10,
+                    const float* p01,
+                    const float* p11,
+                    float tx,
+                    float ty,
+                    float* values)
+{
     const float w00 = (1.0f - tx) * (1.0f - ty);
     const float w10 = tx * (1.0f - ty);
     const float w01 = (1.0f - tx) * ty;
     const float w11 = tx * ty;
+    for (int c = 0; c < N; ++c) {
+        const int k = s.srcChannels[c];
+        const float val = w00 * p00[k] + w10 * p10[k] + w01 * p01[k] + w11 * p11[k];
+        values[c] = val * s.scale[c] + s.bias[c];
+    }
+    for (int c = N; c < s.outChannels; ++c) {
+        values[c] = 1.0f;
+    }
+}
 
-    if (input.channel == AdobeTokens->rgb || input.channel == AdobeTokens->rgba) {
-        if (outChannels == ch) {
-            // Fast path: source and output channel counts match — no broadcasting or alpha
-            // synthesis needed.  The inner loop is branch-free.
-            for (int c = 0; c < outChannels; ++c) {
-                const float val = w00 * p00[c] + w10 * p10[c] + w01 * p01[c] + w11 * p11[c];
-                values[c] = val * input.scale[c] + input.bias[c];
-            }
-            return true;
-        }
-
-        // Slow path: output channel count differs from the source.
-        // Region 1: channels that exist in the source — direct indexed, no clamping.
-        const int srcChannels = std::min(outChannels, ch);
-        for (int c = 0; c < srcChannels; ++c) {
-            const float val = w00 * p00[c] + w10 * p10[c] + w01 * p01[c] + w11 * p11[c];
-            values[c] = val * input.scale[c] + input.bias[c];
-        }
-        if (outChannels > ch) {
-            // Region 2: broadcast the last source channel into any non-alpha slots.
-            // The bilinear value is the same for every broadcast channel, so compute it once.
-            const float lastVal =
-              w00 * p00[ch - 1] + w10 * p10[ch - 1] + w01 * p01[ch - 1] + w11 * p11[ch - 1];
-            const int broadcastEnd = std::min(outChannels, 3);
-            for (int c = ch; c < broadcastEnd; ++c) {
-                values[c] = lastVal * input.scale[c] + input.bias[c];
+template<int N>
+void
+_resampleImageRow(const _ImageSampler& s, const _BilinearTap& row, float* values)
+{
+    const size_t rowSize = static_cast<size_t>(s.width) * s.channels;
+    const float* const row0 = s.pixels + row.i0 * rowSize;
+    const int count = static_cast<int>(s.columns.size());
+    if (row.t == 0.0f && s.exactColumns) {
+        // Every texel lands on a source texel center, which is always the case when the image is
+        // not resized, so the other corners are never read
+        for (int x = 0; x < count; ++x) {
+            const float* const p = row0 + s.columns[x].i0 * s.channels;
+            float* const dst = values + static_cast<size_t>(x) * s.outChannels;
+            for (int c = 0; c < N; ++c) {
+                dst[c] = p[s.srcChannels[c]] * s.scale[c] + s.bias[c];
             }
-            // Region 3: synthesize alpha = 1.0 when the source has no alpha channel.
-            if (outChannels == 4) {
-                values[3] = 1.0f;
+            for (int c = N; c < s.outChannels; ++c) {
+                dst[c] = 1.0f;
             }
         }
-        return true;
+        return;
+    }
+    const float* const row1 = s.pixels + row.i1 * rowSize;
+    for (int x = 0; x < count; ++x) {
+        const _BilinearTap& column = s.columns[x];
+        const size_t x0 = static_cast<size_t>(column.i0) * s.channels;
+        const size_t x1 = static_cast<size_t>(column.i1) * s.channels;
+        _writeBilinearTexel<N>(s,
+                               row0 + x0,
+                               row0 + x1,
+                               row1 + x0,
+                               row1 + x1,
+                               column.t,
+                               row.t,
+                               values + static_cast<size_t>(x) * s.outChannels);
     }
+}
 
-    int srcChannel = token2Channel(input.channel);
-    if (srcChannel < 0) {
-        return false;
+template<int N>
+void
+_sampleImageRow(const _ImageSampler& s, const float* us, const float* vs, int count, float* values)
+{
+    const size_t rowSize = static_cast<size_t>(s.width) * s.channels;
+    for (int i = 0; i < count; ++i) {
+        const _BilinearTap column = _getBilinearTap(us[i], s.width);
+        const _BilinearTap row = _getBilinearTap(vs[i], s.height);
+        const float* const row0 = s.pixels + row.i0 * rowSize;
+        const float* const row1 = s.pixels + row.i1 * rowSize;
+        const size_t x0 = static_cast<size_t>(column.i0) * s.channels;
+        const size_t x1 = static_cast<size_t>(column.i1) * s.channels;
+        _writeBilinearTexel<N>(s,
+                               row0 + x0,
+                               row0 + x1,
+                               row1 + x0,
+                               row1 + x1,
+                               column.t,
+                               row.t,
+                               values + static_cast<size_t>(i) * s.outChannels);
     }
-    if (srcChannel >= ch) {
-        if (ch == 1) {
-            srcChannel = 0;
-        } else {
-            TF_WARN("Input channel %s out of range for source image with %d channels",
-                    input.channel.GetText(),
-                    ch);
-            return false;
-        }
+}
+
+// Bilinearly samples row `y` of the image resized to the sampler's columns and `outHeight` rows,
+// writing outChannels values per texel to `values`.
+void
+_resampleImageRow(const _ImageSampler& s, int y, int outHeight, float* values)
+{
+    const _BilinearTap row = _getBilinearTap((y + 0.5f) / outHeight, s.height);
+    switch (s.sampledChannels) {
+        case 1: _resampleImageRow<1>(s, row, values); break;
+        case 2: _resampleImageRow<2>(s, row, values); break;
+        case 3: _resampleImageRow<3>(s, row, values); break;
+        case 4: _resampleImageRow<4>(s, row, values); break;
     }
-    const float val =
-      w00 * p00[srcChannel] + w10 * p10[srcChannel] + w01 * p01[srcChannel] + w11 * p11[srcChannel];
-    values[0] = val * input.scale[0] + input.bias[0];
-    for (int c = 1; c < outChannels; ++c) {
-        // Synthetic alpha (channel 3 when the source is single-channel) should be 1.0,
-        // not a copy of the sampled scalar value.
-        values[c] = (c == 3) ? 1.0f : values[0];
+}
+
+// Bilinearly samples the image at `count` normalized coordinates (us[i], vs[i]), writing
+// outChannels values per texel to `values`.
+void
+_sampleImageRow(const _ImageSampler& s, const float* us, const float* vs, int count, float* values)
+{
+    switch (s.sampledChannels) {
+        case 1: _sampleImageRow<1>(s, us, vs, count, values); break;
+        case 2: _sampleImageRow<2>(s, us, vs, count, values); break;
+        case 3: _sampleImageRow<3>(s, us, vs, count, values); break;
+        case 4: _sampleImageRow<4>(s, us, vs, count, values); break;
     }
-    return true;
 }
 
 void
@@ -789,6 +883,27 @@ _setTranslatedInputConstant(const std::vector<float>& values, Input& out)
     out.bias = kDefaultTexBias;
 }
 
+// Whether the input is a constant with all of its `outChannels` components equal to `value`
+bool
+_isUniformConstant(const Input& input, int outChannels, float value)
+{
+    if (input.image >= 0 || input.value.IsEmpty()) {
+        return false;
+    }
+    std::vector<float> values(outChannels);
+    _getConstantInputValues(input, outChannels, values.data());
+    return std::all_of(values.begin(), values.end(), [value](float v) { return v == value; });
+}
+
+// Whether an image input reads as the result of an `outChannels` operation that doesn't change
+// its pixels, so that the source image can be used instead of encoding the result
+bool
+_isPassthroughImage(const Input& input, int outChannels)
+{
+    return input.image >= 0 && _getInputComponentCount(input) == outChannels &&
+           input.scale == kDefaultTexScale && input.bias == kDefaultTexBias;
+}
+
 }
 
 template<typename T>
@@ -932,6 +1047,22 @@ _uvTransformKey(const Input& input)
                           input.uvTranslation[1]);
 }
 
+// Describes the parameters of an input that affect the values sampled from it, for the keys of
+// the texture disk cache, which outlive the translation and so can't leave any of them out.
+std::string
+_describeInput(const Input& input)
+{
+    return TfStringPrintf("%s_%s_%s_%s_%s_%s_uv%d",
+                          input.channel.GetText(),
+                          TfStringify(input.value).c_str(),
+                          TfStringify(input.scale).c_str(),
+                          TfStringify(input.bias).c_str(),
+                          input.wrapS.GetText(),
+                          input.wrapT.GetText(),
+                          input.uvIndex) +
+           _uvTransformKey(input);
+}
+
 // ---------------------------------------------------------------------------
 // _applyImageOp — shared implementation for translateProduct / translateMax / translateLerp
 // ---------------------------------------------------------------------------
@@ -971,7 +1102,7 @@ InputTranslator::_applyImageOp(const std::string& name,
             break;
         }
     }
-    GUARD(reference && getDecodedImage(reference->image).first, "Invalid reference image");
+    GUARD(reference != nullptr, "Invalid reference image");
 
     // When UV transforms differ across image inputs, each input's transform is baked into the
     // pixel data; the cache key must then include the transform parameters to avoid collisions.
@@ -995,20 +1126,35 @@ InputTranslator::_applyImageOp(const std::string& name,
     if (it != mCache.end()) {
         imageIndex = it->second;
     } else {
-        Image outImage;
-        if (mExportImages) {
+        // The inputs are copied, since in a batch the image is computed after this returns
+        std::vector<Input> inputs;
+        std::vector<std::pair<int, bool>> reads;
+        for (const auto& slot : slotsVec) {
+            inputs.push_back(*slot.input);
+            if (slot.input->image >= 0) {
+                reads.emplace_back(slot.input->image, true);
+            }
+        }
+        auto produce = [this, name, slotsVec, inputs, transformsMatch, outChannels, pixelFn](
+                         Image& outImage) {
+            const int slotCount = static_cast<int>(slotsVec.size());
+
             // Per-slot decode state.
             struct SlotState
             {
                 Image image;
                 UVTransform xf = {};
+                _ImageSampler sampler;
+                // The sampled values of the current row, or the constant value of the slot
+                std::vector<float> values;
+                int stride = 0; // Between the values of consecutive texels, 0 for constants
             };
             std::vector<SlotState> state(slotCount);
 
             // Decode each image-bearing slot.
             for (int s = 0; s < slotCount; ++s) {
-                if (slotsVec[s].input->image >= 0) {
-                    auto [ok, img] = getDecodedImage(slotsVec[s].input->image);
+                if (inputs[s].image >= 0) {
+                    auto [ok, img] = getDecodedImage(inputs[s].image);
                     if (!ok) {
                         TF_WARN("Failed to decode image for '%s'", name.c_str());
                         return false;
@@ -1020,52 +1166,80 @@ InputTranslator::_applyImageOp(const std::string& name,
             // Output resolution = union of all contributing image dimensions.
             int outW = 0, outH = 0;
             for (int s = 0; s < slotCount; ++s) {
-                if (slotsVec[s].input->image >= 0) {
+                if (inputs[s].image >= 0) {
                     outW = std::max(outW, state[s].image.width);
                     outH = std::max(outH, state[s].image.height);
                 }
             }
             outImage.allocate(outW, outH, outChannels);
 
-            // Build per-slot affine UV transforms once, outside the pixel loop.
-            for (int s = 0; s < slotCount; ++s)
-                state[s].xf = _buildUVTransform(transformsMatch ? Input{} : *slotsVec[s].input);
-
-            // Allocate per-slot sample buffers.
-            std::vector<std::vector<float>> bufs(slotCount);
-            std::vector<float*> bufPtrs(slotCount);
+            // Resolve the UV transform, channels and column taps of each slot once, and evaluate
+            // the constant slots, outside the pixel loop.
             for (int s = 0; s < slotCount; ++s) {
-                bufs[s].resize(slotsVec[s].channels);
-                bufPtrs[s] = bufs[s].data();
+                const int channels = slotsVec[s].channels;
+                if (inputs[s].image >= 0) {
+                    state[s].xf = _buildUVTransform(transformsMatch ? Input{} : inputs[s]);
+                    if (!_makeImageSampler(
+                          inputs[s], state[s].image, channels, outW, state[s].sampler)) {
+                        TF_WARN("Failed to sample image for '%s'", name.c_str());
+                        return false;
+                    }
+                    state[s].values.resize(static_cast<size_t>(outW) * channels);
+                    state[s].stride = channels;
+                } else {
+                    state[s].values.resize(channels);
+                    _getConstantInputValues(inputs[s], channels, state[s].values.data());
+                }
             }
 
-            const int pixelCount = outW * outH;
-            for (int i = 0; i < pixelCount; ++i) {
-                const float u = (i % outW + 0.5f) / outW;
-                const float v = (i / outW + 0.5f) / outH;
-                float su, sv;
+            // Each row of every image slot is sampled in bulk, then combined texel by texel
+            std::vector<float*> bufPtrs(slotCount);
+            std::vector<float> us(outW);
+            std::vector<float> vs(outW);
+            float* const dst = outImage.pixels.data();
+            for (int y = 0; y < outH; ++y) {
                 for (int s = 0; s < slotCount; ++s) {
-                    const _ImageOpSlot& slot = slotsVec[s];
-                    float* buf = bufPtrs[s];
-                    if (slot.input->image >= 0) {
-                        _applyUVTransform(state[s].xf, u, v, su, sv);
-                        if (!_sampleInputImageBilinear(
-                              *slot.input, state[s].image, su, sv, slot.channels, buf)) {
-                            TF_WARN("Failed to sample image for '%s'", name.c_str());
-                            return false;
-                        }
-                        if (slot.linearize) {
-                            for (int c = 0; c < slot.channels; ++c)
-                                buf[c] = srgbToLinear(buf[c]);
-                        }
+                    if (inputs[s].image < 0) {
+                        continue;
+                    }
+                    SlotState& slotState = state[s];
+                    float* const values = slotState.values.data();
+                    if (slotState.xf.isIdentity) {
+                        _resampleImageRow(slotState.sampler, y, outH, values);
                     } else {
-                        _getConstantInputValues(*slot.input, slot.channels, buf);
+                        const float v = (y + 0.5f) / outH;
+                        for (int x = 0; x < outW; ++x) {
+                            _applyUVTransform(slotState.xf, (x + 0.5f) / outW, v, us[x], vs[x]);
+                        }
+                        _sampleImageRow(slotState.sampler, us.data(), vs.data(), outW, values);
+                    }
+                    if (slotsVec[s].linearize) {
+                        srgbToLinear(values, slotState.values.size());
+                    }
+                }
+                float* const dstRow = dst + static_cast<size_t>(y) * outW * outChannels;
+                for (int x = 0; x < outW; ++x) {
+                    for (int s = 0; s < slotCount; ++s) {
+                        bufPtrs[s] = state[s].values.data() + x * state[s].stride;
                     }
+                    pixelFn(bufPtrs.data(), dstRow + x * outChannels, outChannels);
                 }
-                pixelFn(bufPtrs.data(), outImage.pixels.data() + i * outChannels, outChannels);
             }
+            return true;
+        };
+        std::string description = key + TfStringPrintf("|%d", outChannels);
+        std::vector<int> sources;
+        for (const auto& slot : slotsVec) {
+            description += TfStringPrintf("|%d_%d_", slot.channels, slot.linearize) +
+                           _describeInput(*slot.input);
+            sources.push_back(slot.input->image);
+        }
+        const std::string diskKey = getDiskCacheKey(description, sources);
+        imageIndex = addImageJob(
+          std::move(reads), produce, name, key, ImageFormatPng, intermediate, diskKey);
+        if (imageIndex < 0) {
+            return false;
         }
-        imageIndex = addImage(std::move(outImage), name, key, ImageFormatPng, intermediate);
         mCache[key] = imageIndex;
     }
 
@@ -1101,6 +1275,14 @@ InputTranslator::translateProduct(const std::string& name,
         return true;
     }
 
+    // Multiplying by one keeps the image as it is
+    if (_isPassthroughImage(in, outChannels) && _isUniformConstant(factor, outChannels, 1.0f)) {
+        return translateDirect(in, out, intermediate);
+    }
+    if (_isPassthroughImage(factor, outChannels) && _isUniformConstant(in, outChannels, 1.0f)) {
+        return translateDirect(factor, out, intermediate);
+    }
+
     return _applyImageOp(name,
                          "product",
                          linearize ? "-lin" : "",
@@ -1110,8 +1292,10 @@ InputTranslator::translateProduct(const std::string& name,
                          out,
                          [linearize](float* const* b, float* dst, int ch) {
                              for (int c = 0; c < ch; ++c) {
-                                 const float val = b[0][c] * b[1][c];
-                                 dst[c] = linearize ? linearToSRGB(val) : val;
+                                 dst[c] = b[0][c] * b[1][c];
+                             }
+                             if (linearize) {
+                                 linearToSRGB(dst, ch);
                              }
                          });
 }
@@ -1195,6 +1379,14 @@ InputTranslator::translateLerp(const std::string& name,
         return true;
     }
 
+    // A constant mask of 0 or 1 selects one of the inputs as it is
+    if (_isUniformConstant(mask, 1, 0.0f) && _isPassthroughImage(in0, outChannels)) {
+        return translateDirect(in0, out, intermediate);
+    }
+    if (_isUniformConstant(mask, 1, 1.0f) && _isPassthroughImage(in1, outChannels)) {
+        return translateDirect(in1, out, intermediate);
+    }
+
     // The mask drives blending weight; include it in the transform check so that a mask on a
     // different UV set than in0/in1 also triggers per-input baking.
     return _applyImageOp(
@@ -1208,8 +1400,10 @@ InputTranslator::translateLerp(const std::string& name,
       [linearize](float* const* b, float* dst, int ch) {
           const float t = std::clamp(b[2][0], 0.0f, 1.0f);
           for (int c = 0; c < ch; ++c) {
-              const float val = b[0][c] * (1.0f - t) + b[1][c] * t;
-              dst[c] = linearize ? linearToSRGB(val) : val;
+              dst[c] = b[0][c] * (1.0f - t) + b[1][c] * t;
+          }
+          if (linearize) {
+              linearToSRGB(dst, ch);
           }
       });
 }
@@ -1247,11 +1441,10 @@ InputTranslator::extractChannel(const std::string& name,
         if (it != mCache.end()) {
             texture = it->second;
         } else {
-            Image outImage;
-            if (mExportImages) {
-                auto [inImageValid, inImage] = getDecodedImage(in.image);
-                GUARD(inImageValid, "Invalid image");
-                if (inImage.channels == 1 && newscale == 1.0f && newbias == 0.0f) {
+            if (mExportImages && newscale == 1.0f && newbias == 0.0f) {
+                const int inChannels = getImageChannels(in.image);
+                GUARD(inChannels > 0, "Invalid image");
+                if (inChannels == 1) {
                     // If the source image has a single channel and there isn't a
                     // scale or bias to be applied, we just copy but ensure we set
                     // the out channel to 'r' and reset the scale and bias
@@ -1262,12 +1455,26 @@ InputTranslator::extractChannel(const std::string& name,
                         out.bias = kDefaultTexBias;
                     }
                     return result;
-                } else {
-                    // apply scale and bias to source channel and store in single channel outImage
-                    imageExtractChannel(inImage, channelIndex, newscale, newbias, outImage);
                 }
             }
-            texture = addImage(std::move(outImage), assetName, key, inImageAsset.format, false);
+            // apply scale and bias to source channel and store in single channel outImage
+            const int inIndex = in.image;
+            texture = addImageJob(
+              { { inIndex, false } },
+              [this, inIndex, channelIndex, newscale, newbias](Image& outImage) {
+                  auto [inImageValid, inImage] = getDecodedImage(inIndex, false);
+                  GUARD(inImageValid, "Invalid image");
+                  imageExtractChannel(inImage, channelIndex, newscale, newbias, outImage);
+                  return true;
+              },
+              assetName,
+              key,
+              inImageAsset.format,
+              false,
+              getDiskCacheKey(key + TfStringPrintf("|%.9g|%.9g", newscale, newbias), { inIndex }));
+            if (texture < 0) {
+                return false;
+            }
         }
         out.image = texture;
         out.channel = AdobeTokens->r;
@@ -1310,17 +1517,30 @@ InputTranslator::translateAffine(const std::string& name,
         std::string key = assetName + "." + getFormatExtension(inImageAsset.format);
         int texture = -1;
         const auto& it = mCache.find(key);
-        if (it != mCache.end()) {
+        if (scale == 1.0f && bias == 0.0f) {
+            // The pixels are unchanged, so the source image is used as it is
+            translateDirect(in, out, intermediate);
+            texture = out.image;
+        } else if (it != mCache.end()) {
             texture = it->second;
         } else {
-            Image outImage;
-            if (mExportImages) {
-                auto [inImageValid, inImage] = getDecodedImage(in.image);
-                GUARD(inImageValid, "Invalid image");
-                imageTransformAffine(inImage, scale, bias, outImage);
+            const int inIndex = in.image;
+            texture = addImageJob(
+              { { inIndex, true } },
+              [this, inIndex, scale, bias](Image& outImage) {
+                  auto [inImageValid, inImage] = getDecodedImage(inIndex);
+                  GUARD(inImageValid, "Invalid image");
+                  imageTransformAffine(inImage, scale, bias, outImage);
+                  return true;
+              },
+              assetName,
+              key,
+              inImageAsset.format,
+              intermediate,
+              getDiskCacheKey(key + TfStringPrintf("|%.9g|%.9g", scale, bias), { inIndex }));
+            if (texture < 0) {
+                return false;
             }
-            texture =
-              addImage(std::move(outImage), assetName, key, inImageAsset.format, intermediate);
         }
         out.image = texture;
     }
@@ -1379,11 +1599,12 @@ InputTranslator::translatePhong2PBR(const Input& diffuseIn,
             metallicTexture = metIt->second;
             roughnessTexture = rouIt->second;
         } else {
-            Image albedo;
-            Image roughness;
-            Image metallic;
-
-            if (mExportImages) {
+            // The bake reads the source images itself, with the channel counts it needs
+            const int diffuseIndex = diffuseIn.image;
+            const int specularIndex = specularIn.image;
+            const int glosinessIndex = glosinessIn.image;
+            auto bake = [this, diffuseIndex, specularIndex, glosinessIndex](
+                          Image& albedo, Image& roughness, Image& metallic) {
                 Image diffuse;
                 Image specular;
                 Image shininess;
@@ -1392,12 +1613,12 @@ InputTranslator::translatePhong2PBR(const Input& diffuseIn,
                 // below substitutes a sensible default. A present but corrupt or over-sized
                 // source still fails read() and aborts, preserving the dimension/overflow
                 // guards.
-                if (diffuseIn.image != -1)
-                    GUARD(diffuse.read(mImagesSrc[diffuseIn.image], 3), "Invalid diffuse image");
-                if (specularIn.image != -1)
-                    GUARD(specular.read(mImagesSrc[specularIn.image], 3), "Invalid specular image");
-                if (glosinessIn.image != -1)
-                    GUARD(shininess.read(mImagesSrc[glosinessIn.image], 1), "Invalid gloss image");
+                if (diffuseIndex != -1)
+                    GUARD(diffuse.read(mImagesSrc[diffuseIndex], 3), "Invalid diffuse image");
+                if (specularIndex != -1)
+                    GUARD(specular.read(mImagesSrc[specularIndex], 3), "Invalid specular image");
+                if (glosinessIndex != -1)
+                    GUARD(shininess.read(mImagesSrc[glosinessIndex], 1), "Invalid gloss image");
 
                 // We need to regularize dimensions. Diffuse component has priority.
                 int width = diffuse.width;
@@ -1444,31 +1665,78 @@ InputTranslator::translatePhong2PBR(const Input& diffuseIn,
                     shininess.set(0.5f, 0.5f, 0.5f, 1.0f);
                 }
                 phongToPbr(diffuse, specular, shininess, albedo, roughness, metallic, 20);
+                return true;
+            };
+
+            // The three images are baked together, so they are only read from the disk cache
+            // when all of them are there
+            const std::vector<int> sources = { diffuseIndex, specularIndex, glosinessIndex };
+            const std::string diskKeys[3] = { getDiskCacheKey(diffuseKey, sources),
+                                              getDiskCacheKey(metallicKey, sources),
+                                              getDiskCacheKey(roughnessKey, sources) };
+            ImageAsset cachedImages[3];
+            bool cached = !diskKeys[0].empty();
+            const std::string* keys[3] = { &diffuseKey, &metallicKey, &roughnessKey };
+            for (int i = 0; cached && i < 3; ++i) {
+                cachedImages[i].name = *keys[i];
+                cachedImages[i].uri = *keys[i];
+                cachedImages[i].format = ImageFormatPng;
+                cached = mDiskCache->read(diskKeys[i], cachedImages[i]);
+            }
+            if (!diskKeys[0].empty()) {
+                profileAddCounter(cached ? "textureCacheHits" : "textureCacheMisses", 3);
             }
+            auto writeToDiskCache = [this, diskKeys](int diffuse, int metallic, int roughness) {
+                if (!diskKeys[0].empty()) {
+                    mDiskCache->write(diskKeys[0], mImagesDst[diffuse]);
+                    mDiskCache->write(diskKeys[1], mImagesDst[metallic]);
+                    mDiskCache->write(diskKeys[2], mImagesDst[roughness]);
+                }
+            };
 
-            diffuseTexture = mImagesDst.size();
-            mImagesDst.push_back(ImageAsset());
-            ImageAsset& diff = mImagesDst.back();
-            diff.uri = diffuseKey;
-            diff.name = TfToken(diffuseKey);
-            diff.format = ImageFormatPng;
-            albedo.write(diff); // no-op if texture empty
-
-            metallicTexture = mImagesDst.size();
-            mImagesDst.push_back(ImageAsset());
-            ImageAsset& met = mImagesDst.back();
-            met.uri = metallicKey;
-            met.name = TfToken(metallicKey);
-            met.format = ImageFormatPng;
-            metallic.write(met); // no-op if texture empty
-
-            roughnessTexture = mImagesDst.size();
-            mImagesDst.push_back(ImageAsset());
-            ImageAsset& rou = mImagesDst.back();
-            rou.uri = roughnessKey;
-            rou.name = TfToken(roughnessKey);
-            rou.format = ImageFormatPng;
-            roughness.write(rou); // no-op if texture empty
+            if (cached) {
+                diffuseTexture = addImage(std::move(cachedImages[0]));
+                metallicTexture = addImage(std::move(cachedImages[1]));
+                roughnessTexture = addImage(std::move(cachedImages[2]));
+            } else {
+                Image albedo;
+                Image roughness;
+                Image metallic;
+                if (!mBatching && mExportImages && !bake(albedo, roughness, metallic)) {
+                    return false;
+                }
+                diffuseTexture = reserveImage(diffuseKey, diffuseKey, ImageFormatPng);
+                metallicTexture = reserveImage(metallicKey, metallicKey, ImageFormatPng);
+                roughnessTexture = reserveImage(roughnessKey, roughnessKey, ImageFormatPng);
+                if (mBatching && mExportImages) {
+                    _BatchJob job;
+                    job.run = [this,
+                               bake,
+                               writeToDiskCache,
+                               diffuseTexture,
+                               metallicTexture,
+                               roughnessTexture]() {
+                        Image albedo;
+                        Image roughness;
+                        Image metallic;
+                        if (!bake(albedo, roughness, metallic)) {
+                            return false;
+                        }
+                        albedo.write(mImagesDst[diffuseTexture]);
+                        metallic.write(mImagesDst[metallicTexture]);
+                        roughness.write(mImagesDst[roughnessTexture]);
+                        writeToDiskCache(diffuseTexture, metallicTexture, roughnessTexture);
+                        return true;
+                    };
+                    queueJob(std::move(job));
+                } else {
+                    // no-op if texture empty
+                    albedo.write(mImagesDst[diffuseTexture]);
+                    metallic.write(mImagesDst[metallicTexture]);
+                    roughness.write(mImagesDst[roughnessTexture]);
+                    writeToDiskCache(diffuseTexture, metallicTexture, roughnessTexture);
+                }
+            }
 
             mCache[diffuseKey] = diffuseTexture;
             mCache[metallicKey] = metallicTexture;
@@ -1555,20 +1823,23 @@ InputTranslator::translateNormals(const Input& bumpIn, const Input& normalsIn, I
         if (const auto& it = mCache.find(key); it != mCache.end()) {
             normalTexture = it->second;
         } else {
-            Image normal;
-            if (mExportImages) {
-                const ImageAsset& bumpAsset = mImagesSrc[bumpIn.image];
-                Image bump;
-                GUARD(bump.read(bumpAsset, 1), "Invalid bump image");
-                bumpToNormal(bump, normal, 3);
+            const int bumpIndex = bumpIn.image;
+            normalTexture = addImageJob(
+              {},
+              [this, bumpIndex](Image& normal) {
+                  Image bump;
+                  GUARD(bump.read(mImagesSrc[bumpIndex], 1), "Invalid bump image");
+                  bumpToNormal(bump, normal, 3);
+                  return true;
+              },
+              key,
+              key,
+              ImageFormatPng,
+              false,
+              getDiskCacheKey(key, { bumpIndex }));
+            if (normalTexture < 0) {
+                return false;
             }
-            normalTexture = mImagesDst.size();
-            mImagesDst.push_back(ImageAsset());
-            ImageAsset& norm = mImagesDst.back();
-            norm.uri = key;
-            norm.name = key;
-            norm.format = ImageFormatPng;
-            normal.write(norm); // no-op if texture empty
         }
         normalsOut.image = normalTexture;
         normalsOut.uvIndex = 0;
@@ -1685,9 +1956,10 @@ InputTranslator::translateMultiscatterToSingleScatter(const std::string& name,
         if (it != mCache.end()) {
             texture = it->second;
         } else {
-            Image outImage;
-            if (mExportImages) {
-                auto [inImageValid, inImage] = getDecodedImage(in.image);
+            const int inIndex = in.image;
+            const GfVec4f scale = in.scale;
+            auto produce = [this, inIndex, scale, anisotropy, key](Image& outImage) {
+                auto [inImageValid, inImage] = getDecodedImage(inIndex);
                 GUARD(inImageValid, "Invalid image");
                 const int outputChannels = inImage.channels >= 4 ? 4 : 3;
                 if (!outImage.allocate(inImage.width, inImage.height, outputChannels)) {
@@ -1703,9 +1975,9 @@ InputTranslator::translateMultiscatterToSingleScatter(const std::string& name,
                     const float rawR = inImage.pixels[inIdx + 0];
                     const float rawG = inImage.channels >= 3 ? inImage.pixels[inIdx + 1] : rawR;
                     const float rawB = inImage.channels >= 3 ? inImage.pixels[inIdx + 2] : rawR;
-                    const float r = std::clamp(rawR * in.scale[0], 0.0f, 1.0f);
-                    const float g = std::clamp(rawG * in.scale[1], 0.0f, 1.0f);
-                    const float b = std::clamp(rawB * in.scale[2], 0.0f, 1.0f);
+                    const float r = std::clamp(rawR * scale[0], 0.0f, 1.0f);
+                    const float g = std::clamp(rawG * scale[1], 0.0f, 1.0f);
+                    const float b = std::clamp(rawB * scale[2], 0.0f, 1.0f);
                     outImage.pixels[outIdx + 0] = multiscatterToSingleScatter(r, anisotropy);
                     outImage.pixels[outIdx + 1] = multiscatterToSingleScatter(g, anisotropy);
                     outImage.pixels[outIdx + 2] = multiscatterToSingleScatter(b, anisotropy);
@@ -1714,8 +1986,18 @@ InputTranslator::translateMultiscatterToSingleScatter(const std::string& name,
                           inImage.channels >= 4 ? inImage.pixels[inIdx + 3] : 1.0f;
                     }
                 }
+                return true;
+            };
+            texture = addImageJob({ { inIndex, true } },
+                                  produce,
+                                  key,
+                                  key,
+                                  ImageFormatPng,
+                                  false,
+                                  getDiskCacheKey(key, { inIndex }));
+            if (texture < 0) {
+                return false;
             }
-            texture = addImage(std::move(outImage), key, key, ImageFormatPng, false);
             mCache[key] = texture;
         }
         out.image = texture;
@@ -1765,9 +2047,10 @@ InputTranslator::translateSingleScatterToMultiscatter(const std::string& name,
         if (it != mCache.end()) {
             texture = it->second;
         } else {
-            Image outImage;
-            if (mExportImages) {
-                auto [inImageValid, inImage] = getDecodedImage(in.image);
+            const int inIndex = in.image;
+            const GfVec4f scale = in.scale;
+            auto produce = [this, inIndex, scale, anisotropy, key](Image& outImage) {
+                auto [inImageValid, inImage] = getDecodedImage(inIndex);
                 GUARD(inImageValid, "Invalid image");
                 const int outputChannels = inImage.channels >= 4 ? 4 : 3;
                 if (!outImage.allocate(inImage.width, inImage.height, outputChannels)) {
@@ -1783,9 +2066,9 @@ InputTranslator::translateSingleScatterToMultiscatter(const std::string& name,
                     const float rawR = inImage.pixels[inIdx + 0];
                     const float rawG = inImage.channels >= 3 ? inImage.pixels[inIdx + 1] : rawR;
                     const float rawB = inImage.channels >= 3 ? inImage.pixels[inIdx + 2] : rawR;
-                    const float r = std::clamp(rawR * in.scale[0], 0.0f, 1.0f);
-                    const float g = std::clamp(rawG * in.scale[1], 0.0f, 1.0f);
-                    const float b = std::clamp(rawB * in.scale[2], 0.0f, 1.0f);
+                    const float r = std::clamp(rawR * scale[0], 0.0f, 1.0f);
+                    const float g = std::clamp(rawG * scale[1], 0.0f, 1.0f);
+                    const float b = std::clamp(rawB * scale[2], 0.0f, 1.0f);
                     outImage.pixels[outIdx + 0] = singleScatterToMultiscatter(r, anisotropy);
                     outImage.pixels[outIdx + 1] = singleScatterToMultiscatter(g, anisotropy);
                     outImage.pixels[outIdx + 2] = singleScatterToMultiscatter(b, anisotropy);
@@ -1794,7 +2077,8 @@ InputTranslator::translateSingleScatterToMultiscatter(const std::string& name,
                           inImage.channels >= 4 ? inImage.pixels[inIdx + 3] : 1.0f;
                     }
                 }
-            }
+                return true;
+            };
             // Before adding an intermediate image to mImagesSrc, ensure mDecodedImages is
             // sized to match so the new entry lands at the correct index.
             while (mDecodedImages.size() < mImagesSrc.size()) {
@@ -1805,7 +2089,16 @@ InputTranslator::translateSingleScatterToMultiscatter(const std::string& name,
             // correctly encodes and references this image via translateDirectInternal.
             // Using intermediate=false would put it in mImagesDst with an index that
             // translateDirect would then misinterpret as a mImagesSrc index.
-            texture = addImage(std::move(outImage), key, key, ImageFormatPng, true);
+            texture = addImageJob({ { inIndex, true } },
+                                  produce,
+                                  key,
+                                  key,
+                                  ImageFormatPng,
+                                  true,
+                                  getDiskCacheKey(key, { inIndex }));
+            if (texture < 0) {
+                return false;
+            }
             mCache[key] = texture;
         }
         out.image = texture;
@@ -1882,35 +2175,36 @@ InputTranslator::translateMix(const std::string& name,
             if (it != mCache.end()) {
                 imageIndex = it->second;
             } else {
-                imageIndex = mImagesDst.size();
-                mImagesDst.push_back(ImageAsset());
-                if (mExportImages) {
-                    ImageAsset& newImage = mImagesDst.back();
-                    Image mixed;
-                    auto copyChannel = [&](int image, int channelSrc, int channelDst) -> bool {
-                        if (image == -1 || channelSrc == -1) {
-                            return true;
-                        }
-                        auto [imageValid, imageSrc] = getDecodedImage(image);
-                        if (!imageValid) {
-                            return false;
+                const int images[4] = { im0, im1, im2, im3 };
+                const int channels[4] = { ch0, ch1, ch2, ch3 };
+                std::vector<std::pair<int, bool>> reads;
+                for (int c = 0; c < 4; ++c) {
+                    if (images[c] != -1 && channels[c] != -1) {
+                        reads.emplace_back(images[c], true);
+                    }
+                }
+                const GfVec4f values(val0, val1, val2, val3);
+                auto produce = [this, images, channels, values](Image& mixed) {
+                    for (int c = 0; c < 4; ++c) {
+                        if (images[c] == -1 || channels[c] == -1) {
+                            continue;
                         }
+                        auto [imageValid, imageSrc] = getDecodedImage(images[c]);
+                        GUARD(imageValid, "Invalid source image for channel %d", c);
                         if (mixed.pixels.empty()) {
                             mixed.allocate(imageSrc.width, imageSrc.height, 4);
-                            mixed.set(val0, val1, val2, val3);
+                            mixed.set(values[0], values[1], values[2], values[3]);
                         }
-                        mixed.copyChannel(imageSrc, channelSrc, channelDst);
-                        return true;
-                    };
-                    GUARD(copyChannel(im0, ch0, 0), "Invalid source image for channel 0");
-                    GUARD(copyChannel(im1, ch1, 1), "Invalid source image for channel 1");
-                    GUARD(copyChannel(im2, ch2, 2), "Invalid source image for channel 2");
-                    GUARD(copyChannel(im3, ch3, 3), "Invalid source image for channel 3");
-                    newImage.uri = key + ".png";
-                    newImage.name = key;
-                    // We need to set the format before we can write to it
-                    newImage.format = ImageFormatPng;
-                    mixed.write(newImage);
+                        mixed.copyChannel(imageSrc, channels[c], c);
+                    }
+                    return true;
+                };
+                const std::string diskKey = getDiskCacheKey(
+                  key + "|" + TfStringify(values), { images[0], images[1], images[2], images[3] });
+                imageIndex = addImageJob(
+                  std::move(reads), produce, key, key + ".png", ImageFormatPng, false, diskKey);
+                if (imageIndex < 0) {
+                    return false;
                 }
                 mCache[key] = imageIndex;
             }
@@ -1978,6 +2272,7 @@ InputTranslator::getImage(int i) const
 std::vector<ImageAsset>&
 InputTranslator::getImages()
 {
+    runBatchJobs();
     return mImagesDst;
 }
 
@@ -2007,7 +2302,7 @@ InputTranslator::computeRange(const Input& input)
 {
     std::pair<GfVec4f, GfVec4f> result = { GfVec4f(FLT_MAX), GfVec4f(-FLT_MAX) };
     if (input.image != -1) {
-        auto [imageValid, imageSrc] = getDecodedImage(input.image);
+        auto [imageValid, imageSrc] = getDecodedImage(input.image, false);
         if (imageValid) {
             result = imageSrc.computeRange();
         }
@@ -2039,23 +2334,29 @@ InputTranslator::computeRange(const Input& input)
 }
 
 std::pair<bool, Image&>
-InputTranslator::getDecodedImage(int index)
+InputTranslator::getDecodedImage(int index, bool floatPixels)
 {
     static Image defaultImage;
     if (index < 0 || index >= (int)mDecodedMap.size()) {
         TF_WARN("Invalid image index: %d", index);
         return { false, defaultImage };
     }
-    if (mDecodedMap[index]) {
-        return { true, mDecodedImages[index] };
-    } else {
+    if (isPendingImage(index)) {
+        runBatchJobs();
+    }
+    if (!mDecodedMap[index]) {
         ImageAsset& imageAsset = mImagesSrc[index];
-        mDecodedMap[index] = mDecodedImages[index].read(imageAsset);
+        mDecodedMap[index] = mDecodedImages[index].read(imageAsset, -1, true);
         if (!mDecodedMap[index]) {
             TF_RUNTIME_ERROR("Couldn't read image %s (index %d)", imageAsset.uri.c_str(), index);
+            return { false, mDecodedImages[index] };
         }
-        return { mDecodedMap[index], mDecodedImages[index] };
     }
+    // The conversion is kept, so later operations on the same image don't convert it again
+    if (floatPixels) {
+        mDecodedImages[index].convertToFloat();
+    }
+    return { true, mDecodedImages[index] };
 }
 
 int
@@ -2100,4 +2401,292 @@ InputTranslator::addImage(ImageAsset&& image)
     return texture;
 }
 
+int
+InputTranslator::getImageChannels(int index)
+{
+    if (index < 0 || index >= (int)mDecodedMap.size()) {
+        TF_WARN("Invalid image index: %d", index);
+        return -1;
+    }
+    if (!mDecodedMap[index] && !isPendingImage(index)) {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        if (readImageInfo(mImagesSrc[index], width, height, channels)) {
+            return channels;
+        }
+    }
+    auto [imageValid, image] = getDecodedImage(index, false);
+    return imageValid ? image.channels : -1;
+}
+
+int
+InputTranslator::reserveImage(const std::string& assetName,
+                              const std::string& assetUri,
+                              ImageFormat format)
+{
+    ImageAsset imageAsset;
+    imageAsset.name = assetName;
+    imageAsset.uri = assetUri;
+    imageAsset.format = format;
+    return addImage(std::move(imageAsset));
+}
+
+int
+InputTranslator::addImageJob(std::vector<std::pair<int, bool>> reads,
+                             std::function<bool(Image&)> produce,
+                             const std::string& assetName,
+                             const std::string& assetUri,
+                             ImageFormat format,
+                             bool intermediate,
+                             const std::string& diskKey)
+{
+    if (!diskKey.empty() && !intermediate) {
+        const int texture = readDiskCacheImage(diskKey, assetName, assetUri, format);
+        if (texture >= 0) {
+            return texture;
+        }
+    }
+
+    if (!mBatching || !mExportImages) {
+        Image image;
+        if (mExportImages && !produce(image)) {
+            return -1;
+        }
+        const int texture = addImage(std::move(image), assetName, assetUri, format, intermediate);
+        if (!diskKey.empty()) {
+            if (intermediate) {
+                mImageHashes.resize(mImagesSrc.size());
+                mImageHashes[texture] = diskKey;
+            } else {
+                mDiskCache->write(diskKey, mImagesDst[texture]);
+            }
+        }
+        return texture;
+    }
+
+    _BatchJob job;
+    job.reads = std::move(reads);
+    int texture = -1;
+    if (intermediate) {
+        // Reserved the same way as a decoded intermediate image, which it is once the job ran
+        texture = addImage(Image(), assetName, assetUri, format, true);
+        mDecodedMap[texture] = false;
+        job.intermediate = texture;
+        job.run = [this, produce = std::move(produce), texture]() {
+            return produce(mDecodedImages[texture]);
+        };
+        if (!diskKey.empty()) {
+            mImageHashes.resize(mImagesSrc.size());
+            mImageHashes[texture] = diskKey;
+        }
+    } else {
+        texture = reserveImage(assetName, assetUri, format);
+        job.run = [this, produce = std::move(produce), texture, diskKey]() {
+            Image image;
+            if (!produce(image)) {
+                return false;
+            }
+            image.write(mImagesDst[texture]);
+            if (!diskKey.empty()) {
+                mDiskCache->write(diskKey, mImagesDst[texture]);
+            }
+            return true;
+        };
+    }
+    queueJob(std::move(job));
+    return texture;
+}
+
+std::string
+InputTranslator::getDiskCacheKey(const std::string& description, const std::vector<int>& sources)
+{
+    if (!mExportImages || !mDiskCache || !mDiskCache->isEnabled()) {
+        return std::string();
+    }
+    std::string text = description;
+    for (int index : sources) {
+        if (index < 0) {
+            continue;
+        }
+        const std::string& hash = getImageContentHash(index);
+        if (hash.empty()) {
+            return std::string();
+        }
+        text += "|" + hash;
+    }
+    return TextureDiskCache::makeKey(text);
+}
+
+const std::string&
+InputTranslator::getImageContentHash(int index)
+{
+    static const std::string noHash;
+    if (index < 0 || index >= (int)mImagesSrc.size()) {
+        return noHash;
+    }
+    mImageHashes.resize(mImagesSrc.size());
+    std::string& hash = mImageHashes[index];
+    if (!hash.empty()) {
+        return hash;
+    }
+    const ImageBuffer& bytes = mImagesSrc[index].image;
+    if (!bytes.empty()) {
+        const uint64_t h = ArchHash64(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        hash = TfStringPrintf("%016llx", (unsigned long long)h);
+    } else if (index < (int)mDecodedMap.size() && mDecodedMap[index]) {
+        // An intermediate image added already decoded
+        const Image& image = mDecodedImages[index];
+        uint64_t h = ArchHash64(reinterpret_cast<const char*>(image.pixels.data()),
+                                image.pixels.size() * sizeof(float));
+        h = ArchHash64(
+          reinterpret_cast<const char*>(image.nativePixels.data()), image.nativePixels.size(), h);
+        hash = TfStringPrintf("%dx%dx%d_%d_%016llx",
+                              image.width,
+                              image.height,
+                              image.channels,
+                              static_cast<int>(image.pixelType),
+                              (unsigned long long)h);
+    }
+    return hash;
+}
+
+int
+InputTranslator::readDiskCacheImage(const std::string& diskKey,
+                                    const std::string& assetName,
+                                    const std::string& assetUri,
+                                    ImageFormat format)
+{
+    ImageAsset imageAsset;
+    imageAsset.name = assetName;
+    imageAsset.uri = assetUri;
+    imageAsset.format = format;
+    if (!mDiskCache->read(diskKey, imageAsset)) {
+        profileAddCounter("textureCacheMisses", 1);
+        return -1;
+    }
+    profileAddCounter("textureCacheHits", 1);
+    return addImage(std::move(imageAsset));
+}
+
+void
+InputTranslator::queueJob(_BatchJob&& job)
+{
+    if (job.intermediate >= 0) {
+        mPendingImages.resize(std::max(mPendingImages.size(), mImagesSrc.size()), false);
+        mPendingImages[job.intermediate] = true;
+    }
+    mBatchJobs.push_back(std::move(job));
+}
+
+void
+InputTranslator::beginBatch()
+{
+    mBatching = true;
+}
+
+bool
+InputTranslator::endBatch()
+{
+    mBatching = false;
+    return runBatchJobs();
+}
+
+bool
+InputTranslator::runBatchJobs()
+{
+    if (mBatchJobs.empty()) {
+        return true;
+    }
+    std::vector<_BatchJob> jobs = std::move(mBatchJobs);
+    mBatchJobs.clear();
+
+    // Jobs are grouped in levels, each after the levels of the jobs producing the intermediate
+    // images it reads. Within a level, jobs keep the order they were queued in.
+    std::unordered_map<int, size_t> producerLevels;
+    std::vector<std::vector<size_t>> levels;
+    for (size_t j = 0; j < jobs.size(); ++j) {
+        size_t level = 0;
+        for (const auto& [index, floatPixels] : jobs[j].reads) {
+            const auto it = producerLevels.find(index);
+            if (it != producerLevels.end()) {
+                level = std::max(level, it->second + 1);
+            }
+        }
+        if (jobs[j].intermediate >= 0) {
+            producerLevels[jobs[j].intermediate] = level;
+        }
+        if (levels.size() <= level) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(j);
+    }
+
+    std::vector<char> failedImages(mImagesSrc.size(), false);
+    bool success = true;
+    for (const std::vector<size_t>& level : levels) {
+        // Decode each source image read by the level once, as float if any job reads it so, so
+        // that the jobs only read the decoded images
+        std::map<int, bool> readMap;
+        for (size_t j : level) {
+            for (const auto& [index, floatPixels] : jobs[j].reads) {
+                if (index >= 0 && index < (int)mDecodedImages.size() && !failedImages[index]) {
+                    readMap[index] = readMap[index] || floatPixels;
+                }
+            }
+        }
+        const std::vector<std::pair<int, bool>> reads(readMap.begin(), readMap.end());
+        std::vector<char> decoded(reads.size(), false);
+        WorkParallelForN(
+          reads.size(),
+          [&](size_t begin, size_t end) {
+              for (size_t i = begin; i < end; ++i) {
+                  const auto [index, floatPixels] = reads[i];
+                  Image& image = mDecodedImages[index];
+                  decoded[i] = mDecodedMap[index] || image.read(mImagesSrc[index], -1, true);
+                  if (decoded[i] && floatPixels) {
+                      image.convertToFloat();
+                  }
+              }
+          },
+          1);
+        for (size_t i = 0; i < reads.size(); ++i) {
+            const int index = reads[i].first;
+            if (decoded[i]) {
+                mDecodedMap[index] = true;
+            } else {
+                TF_RUNTIME_ERROR(
+                  "Couldn't read image %s (index %d)", mImagesSrc[index].uri.c_str(), index);
+                failedImages[index] = true;
+            }
+        }
+
+        std::vector<char> results(level.size(), false);
+        WorkParallelForN(
+          level.size(),
+          [&](size_t begin, size_t end) {
+              for (size_t i = begin; i < end; ++i) {
+                  const _BatchJob& job = jobs[level[i]];
+                  bool readable = true;
+                  for (const auto& [index, floatPixels] : job.reads) {
+                      readable = readable && !(index >= 0 && index < (int)failedImages.size() &&
+                                               failedImages[index]);
+                  }
+                  results[i] = readable && job.run();
+              }
+          },
+          1);
+        for (size_t i = 0; i < level.size(); ++i) {
+            const int intermediate = jobs[level[i]].intermediate;
+            if (intermediate >= 0) {
+                mPendingImages[intermediate] = false;
+                mDecodedMap[intermediate] = results[i];
+                failedImages[intermediate] = !results[i];
+            }
+            success = success && results[i];
+        }
+    }
+    return success;
+}
+
 }
@@ -0,0 +1,272 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#include <fileformatutils/profiling.h>
+
+#include <fileformatutils/debugCodes.h>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+
+using namespace PXR_NS;
+
+namespace adobe::usd {
+
+namespace {
+
+// The innermost scope and phase name of the calling thread. Work that runs on other threads, for
+// example in parallel loops, is not attributed to a scope.
+thread_local ProfileScope* tCurrentScope = nullptr;
+thread_local std::string tPhasePrefix;
+
+std::mutex registryMutex;
+std::deque<ProfileStats> registry;
+
+template<typename T>
+void
+accumulate(std::vector<std::pair<std::string, T>>& entries, const std::string& name, T value)
+{
+    auto it = std::find_if(
+      entries.begin(), entries.end(), [&](const auto& entry) { return entry.first == name; });
+    if (it != entries.end()) {
+        it->second += value;
+    } else {
+        entries.emplace_back(name, value);
+    }
+}
+
+template<typename T>
+T
+find(const std::vector<std::pair<std::string, T>>& entries, const std::string& name)
+{
+    auto it = std::find_if(
+      entries.begin(), entries.end(), [&](const auto& entry) { return entry.first == name; });
+    return it != entries.end() ? it->second : T();
+}
+
+}
+
+double
+ProfileStats::getPhaseMs(const std::string& name) const
+{
+    return find(phases, name);
+}
+
+int64_t
+ProfileStats::getCounter(const std::string& name) const
+{
+    return find(counters, name);
+}
+
+VtDictionary
+ProfileStats::toDictionary() const
+{
+    VtDictionary phasesDict;
+    for (const auto& [name, ms] : phases) {
+        phasesDict[name] = VtValue(ms);
+    }
+    VtDictionary countersDict;
+    for (const auto& [name, value] : counters) {
+        countersDict[name] = VtValue(value);
+    }
+    VtDictionary dict;
+    dict["plugin"] = VtValue(plugin);
+    dict["operation"] = VtValue(operation);
+    dict["totalMs"] = VtValue(totalMs);
+    dict["phasesMs"] = VtValue(phasesDict);
+    dict["counters"] = VtValue(countersDict);
+    return dict;
+}
+
+ProfileScope::ProfileScope(const std::string& plugin,
+                           const std::string& operation,
+                           const std::string& path)
+  : mPreviousScope(tCurrentScope)
+  , mPreviousPrefix(std::move(tPhasePrefix))
+{
+    mStats.plugin = plugin;
+    mStats.operation = operation;
+    mStats.path = path;
+    tCurrentScope = this;
+    tPhasePrefix.clear();
+    mWatch.Start();
+}
+
+ProfileScope::~ProfileScope()
+{
+    mWatch.Stop();
+    mStats.totalMs = mWatch.GetSeconds() * 1000.0;
+    tCurrentScope = mPreviousScope;
+    tPhasePrefix = std::move(mPreviousPrefix);
+
+    if (TfDebug::IsEnabled(FILE_FORMAT_UTIL)) {
+        TF_DEBUG_MSG(FILE_FORMAT_UTIL,
+                     "Profile %s %s %s: %.1f ms\n",
+                     mStats.plugin.c_str(),
+                     mStats.operation.c_str(),
+                     mStats.path.c_str(),
+                     mStats.totalMs);
+        for (const auto& [name, ms] : mStats.phases) {
+            TF_DEBUG_MSG(FILE_FORMAT_UTIL, "    %s: %.1f ms\n", name.c_str(), ms);
+        }
+        for (const auto& [name, value] : mStats.counters) {
+            TF_DEBUG_MSG(FILE_FORMAT_UTIL, "    %s: %lld\n", name.c_str(), (long long)value);
+        }
+    }
+
+    const std::lock_guard<std::mutex> lock(registryMutex);
+    registry.push_back(std::move(mStats));
+    while (registry.size() > kMaxRecordedProfileStats) {
+        registry.pop_front();
+    }
+}
+
+ProfileScope*
+ProfileScope::current()
+{
+    return tCurrentScope;
+}
+
+void
+ProfileScope::addPhase(const std::string& name, double ms)
+{
+    accumulate(mStats.phases, name, ms);
+}
+
+void
+ProfileScope::addCounter(const std::string& name, int64_t value)
+{
+    accumulate(mStats.counters, name, value);
+}
+
+ProfileStats
+ProfileScope::snapshot() const
+{
+    ProfileStats stats = mStats;
+    TfStopwatch watch = mWatch;
+    watch.Stop();
+    stats.totalMs = watch.GetSeconds() * 1000.0;
+    return stats;
+}
+
+ProfilePhase::ProfilePhase(const char* name)
+  : mScope(tCurrentScope)
+{
+    if (!mScope) {
+        return;
+    }
+    mPreviousPrefix = tPhasePrefix;
+    if (!tPhasePrefix.empty()) {
+        tPhasePrefix += '/';
+    }
+    tPhasePrefix += name;
+    mName = tPhasePrefix;
+    mWatch.Start();
+}
+
+ProfilePhase::~ProfilePhase()
+{
+    stop();
+}
+
+void
+ProfilePhase::stop()
+{
+    // Only record into the scope the phase started in, and only while it is still the current
+    // one, so a phase that outlives its scope is dropped
+    if (!mScope) {
+        return;
+    }
+    mWatch.Stop();
+    if (mScope == tCurrentScope) {
+        mScope->addPhase(mName, mWatch.GetSeconds() * 1000.0);
+        tPhasePrefix = std::move(mPreviousPrefix);
+    }
+    mScope = nullptr;
+}
+
+void
+profileAddCounter(const std::string& name, int64_t value)
+{
+    if (ProfileScope* scope = tCurrentScope) {
+        scope->addCounter(name, value);
+    }
+}
+
+void
+profileAddUsdDataCounters(const UsdData& data)
+{
+    ProfileScope* scope = tCurrentScope;
+    if (!scope) {
+        return;
+    }
+    int64_t points = 0;
+    int64_t faces = 0;
+    int64_t indices = 0;
+    for (const Mesh& mesh : data.meshes) {
+        points += mesh.points.size();
+        faces += mesh.faces.size();
+        indices += mesh.indices.size();
+    }
+    int64_t imageBytes = 0;
+    for (const ImageAsset& image : data.images) {
+        imageBytes += image.image.size();
+    }
+    scope->addCounter("nodes", data.nodes.size());
+    scope->addCounter("meshes", data.meshes.size());
+    scope->addCounter("points", points);
+    scope->addCounter("faces", faces);
+    scope->addCounter("faceVertexIndices", indices);
+    scope->addCounter("materials", data.materials.size() + data.openPbrMaterials.size());
+    scope->addCounter("skeletons", data.skeletons.size());
+    scope->addCounter("images", data.images.size());
+    scope->addCounter("imageBytes", imageBytes);
+}
+
+bool
+getCurrentProfileStats(ProfileStats& stats)
+{
+    if (!tCurrentScope) {
+        return false;
+    }
+    stats = tCurrentScope->snapshot();
+    return true;
+}
+
+std::vector<ProfileStats>
+getProfileStats()
+{
+    const std::lock_guard<std::mutex> lock(registryMutex);
+    return std::vector<ProfileStats>(registry.begin(), registry.end());
+}
+
+bool
+getLatestProfileStats(const std::string& path, ProfileStats& stats, const std::string& operation)
+{
+    const std::lock_guard<std::mutex> lock(registryMutex);
+    for (auto it = registry.rbegin(); it != registry.rend(); ++it) {
+        if (it->path == path && (operation.empty() || it->operation == operation)) {
+            stats = *it;
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+clearProfileStats()
+{
+    const std::lock_guard<std::mutex> lock(registryMutex);
+    registry.clear();
+}
+
+}
@@ -15,17 +15,29 @@ governing permissions and limitations under the License.
 #include <fileformatutils/images.h>
 #include <fileformatutils/resolver.h>
 #include <pxr/base/tf/fileUtils.h>
+#include <pxr/base/tf/pathUtils.h>
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/ar/asset.h>
 #include <pxr/usd/ar/defaultResolver.h>
 #include <pxr/usd/sdf/layer.h>
 
+#include <tbb/concurrent_hash_map.h>
+
 #include <fstream>
 #include <thread>
 
 using namespace PXR_NS;
 namespace adobe::usd {
 
+// The asset maps are pinned for the lifetime of the scope, so they stay valid even if the shared
+// asset cache evicts the package in the meantime.
+struct Resolver::ScopedCache
+{
+    using Map = tbb::concurrent_hash_map<std::string, AssetMapConstPtr>;
+    Map assetMaps;
+};
+
 Resolver::Resolver(const std::string& name)
   : mName(name)
 {
@@ -64,35 +76,87 @@ Resolver::Resolve(const std::string& resolvedPackagePath, const std::string& pac
 std::shared_ptr<ArAsset>
 Resolver::OpenAsset(const std::string& resolvedPackagePath, const std::string& resolvedPackagedPath)
 {
-    std::thread::id threadId = std::this_thread::get_id();
-    std::stringstream ss;
-    ss << threadId;
+    // Fast path for packages already opened in the current cache scope
+    ThreadLocalScopedCaches::CachePtr scopedCache = mScopedCaches.GetCurrentCache();
+    AssetMapConstPtr assetMap;
+    if (scopedCache) {
+        ScopedCache::Map::const_accessor accessor;
+        if (scopedCache->assetMaps.find(accessor, resolvedPackagePath)) {
+            assetMap = accessor->second;
+        }
+    }
 
-    AssetMap* assetMap = AssetCacheSingleton::getInstance().acquireAssetMap(
-      resolvedPackagePath,
-      resolvedPackagedPath,
-      ss,
-      [this](const std::string& path, std::vector<adobe::usd::ImageAsset>& images) {
-          readCache(path,
-                    images); // Assuming 'readCache' is a member function of the 'Resolver' class
-      });
+    if (!assetMap) {
+        std::thread::id threadId = std::this_thread::get_id();
+        std::stringstream ss;
+        ss << threadId;
+
+        assetMap = AssetCacheSingleton::getInstance().acquireAssetMap(
+          resolvedPackagePath,
+          resolvedPackagedPath,
+          ss,
+          [this](const std::string& path, std::vector<adobe::usd::ImageAsset>& images) {
+              readCache(path, images); // defined by each plugin's resolver
+          });
+        if (scopedCache && assetMap) {
+            scopedCache->assetMaps.insert({ resolvedPackagePath, assetMap });
+        }
+    }
     if (assetMap) {
         TF_DEBUG_MSG(UTIL_PACKAGE_RESOLVER, " : %s \n", resolvedPackagedPath.c_str());
         auto it = assetMap->assets.find(resolvedPackagedPath);
         if (it != assetMap->assets.end()) {
             return it->second;
         }
+        // A proxy image is missing when the package was read again after being evicted, since
+        // reading a package only yields the full resolution images. It's generated again from
+        // its original, in the mode recorded in its uri, and replaces the original in the cache,
+        // so that the cache only holds the proxies again.
+        std::string uri;
+        int maxSize = 0;
+        ImageDownsampleMode mode;
+        if (parseProxyImageUri(resolvedPackagedPath, uri, maxSize, mode)) {
+            it = assetMap->assets.find(uri);
+            if (it != assetMap->assets.end() && it->second) {
+                ImageAsset image;
+                image.name = TfStringGetBeforeSuffix(TfGetBaseName(uri));
+                image.uri = uri;
+                image.format = getFormat(TfGetExtension(uri));
+                image.image = ImageBuffer(
+                  std::reinterpret_pointer_cast<const uint8_t>(it->second->GetBuffer()),
+                  it->second->GetSize());
+                std::vector<ImageAsset> proxies(1);
+                if (makeProxyImage(image, maxSize, proxies[0], mode) &&
+                    proxies[0].uri == resolvedPackagedPath) {
+                    assetMap = AssetCacheSingleton::getInstance().populateCache(
+                      resolvedPackagePath, std::move(proxies), { uri });
+                    if (scopedCache && assetMap) {
+                        ScopedCache::Map::accessor accessor;
+                        scopedCache->assetMaps.insert(accessor, resolvedPackagePath);
+                        accessor->second = assetMap;
+                    }
+                    it = assetMap->assets.find(resolvedPackagedPath);
+                    if (it != assetMap->assets.end()) {
+                        return it->second;
+                    }
+                }
+            }
+        }
     }
     return std::shared_ptr<ArAsset>();
 }
 
 void
 Resolver::BeginCacheScope(VtValue* data)
-{}
+{
+    mScopedCaches.BeginCacheScope(data);
+}
 
 void
 Resolver::EndCacheScope(VtValue* data)
-{}
+{
+    mScopedCaches.EndCacheScope(data);
+}
 
 void
 Resolver::clearCache(const std::string& resolvedPackagePath)
@@ -472,12 +472,15 @@ FileFormatDataBase::parseFromFileFormatArgs(const SdfLayer::FileFormatArguments&
                                             const std::string& debugTag)
 {
     using adobe::usd::argReadBool;
+    using adobe::usd::argReadInt;
     using adobe::usd::argReadString;
     argReadBool(args, "writeUsdPreviewSurface", writeUsdPreviewSurface, debugTag);
     argReadBool(args, "writeASM", writeASM, debugTag);
     argReadBool(args, "writeOpenPBR", writeOpenPBR, debugTag);
     argReadBool(args, "preserveExtraMaterialInfo", preserveExtraMaterialInfo, debugTag);
     argReadString(args, "assetsPath", assetsPath, debugTag);
+    argReadBool(args, "writeProfileStats", writeProfileStats, debugTag);
+    argReadInt(args, "maxTextureSize", maxTextureSize, debugTag);
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,300 @@
+/*
+Copyright 2026 Adobe. All rights reserved.
+This file is licensed to you under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License. You may obtain a copy
+of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed under
+the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+OF ANY KIND, either express or implied. See the License for the specific language
+governing permissions and limitations under the License.
+*/
+#include <fileformatutils/textureCache.h>
+
+#include <fileformatutils/common.h>
+#include <fileformatutils/debugCodes.h>
+#include <fileformatutils/featureFlags.h>
+
+#include <pxr/base/arch/hash.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace PXR_NS;
+
+namespace adobe::usd {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Bumped when the encoding of the generated images changes, so older entries are not reused
+constexpr const char* kTextureCacheVersion = "1";
+
+// Suffix of the files being written, which are not entries until they are renamed
+constexpr const char* kTemporarySuffix = ".tmp";
+
+// Age after which a temporary file is considered left behind by a writer that crashed before
+// renaming it. Writing an entry takes far less.
+constexpr std::chrono::minutes kStaleTemporaryAge(10);
+
+// Whether the file is a cache entry: a key of 32 hex characters and the extension of an image
+// format. The directory may be shared with other files, which are never counted nor evicted.
+bool
+isEntryFile(const fs::path& path)
+{
+    const std::string stem = path.stem().string();
+    auto isHexDigit = [](char c) { return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'); };
+    if (stem.size() != 32 || !std::all_of(stem.begin(), stem.end(), isHexDigit)) {
+        return false;
+    }
+    const std::string extension = path.extension().string();
+    for (int format = ImageFormatBmp; format <= ImageFormatHdr; format++) {
+        if (extension == "." + getFormatExtension(static_cast<ImageFormat>(format))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether the file is a temporary file of an entry: the name of an entry followed by
+// kTemporarySuffix and a suffix unique to its writer
+bool
+isTemporaryFile(const fs::path& path)
+{
+    const std::string filename = path.filename().string();
+    const size_t suffix = filename.rfind(kTemporarySuffix);
+    return suffix != std::string::npos && isEntryFile(filename.substr(0, suffix));
+}
+
+}
+
+TextureDiskCache::TextureDiskCache(const std::string& directory, size_t maxBytes)
+  : mDirectory(directory)
+  , mMaxBytes(maxBytes)
+{}
+
+TextureDiskCache&
+TextureDiskCache::getInstance()
+{
+    static TextureDiskCache instance(getTextureCacheDirectory(), getTextureCacheMaxBytes());
+    return instance;
+}
+
+std::string
+TextureDiskCache::makeKey(const std::string& description)
+{
+    // Two differently seeded 64 bit hashes, so that collisions between the entries of a long lived
+    // shared directory are not a practical concern
+    const std::string text = std::string(kTextureCacheVersion) + ":" + description;
+    const uint64_t h0 = ArchHash64(text.data(), text.size());
+    const uint64_t h1 = ArchHash64(text.data(), text.size(), h0);
+    char key[33];
+    snprintf(key,
+             sizeof(key),
+             "%016llx%016llx",
+             static_cast<unsigned long long>(h0),
+             static_cast<unsigned long long>(h1));
+    return key;
+}
+
+std::string
+TextureDiskCache::getEntryPath(const std::string& key, ImageFormat format) const
+{
+    return (fs::path(mDirectory) / (key + "." + getFormatExtension(format))).string();
+}
+
+bool
+TextureDiskCache::read(const std::string& key, ImageAsset& image)
+{
+    if (!isEnabled()) {
+        return false;
+    }
+    const std::string path = getEntryPath(key, image.format);
+    std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    const std::streamoff size = file.tellg();
+    if (size <= 0) {
+        return false;
+    }
+    std::vector<uint8_t> bytes(static_cast<size_t>(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), size)) {
+        return false;
+    }
+    file.close();
+    image.image = ImageBuffer(std::move(bytes));
+
+    // The modification time orders the entries for eviction, so a hit marks the entry as recently
+    // used. Failing to update it only makes the entry an earlier candidate.
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    TF_DEBUG_MSG(FILE_FORMAT_UTIL, "TextureDiskCache: hit %s\n", path.c_str());
+    return true;
+}
+
+bool
+TextureDiskCache::write(const std::string& key, const ImageAsset& image)
+{
+    if (!isEnabled() || image.image.empty()) {
+        return false;
+    }
+    std::error_code ec;
+    fs::create_directories(mDirectory, ec);
+    if (ec) {
+        if (!mDirectoryWarned.exchange(true)) {
+            TF_WARN("Could not create the texture cache directory %s: %s",
+                    mDirectory.c_str(),
+                    ec.message().c_str());
+        }
+        return false;
+    }
+
+    // Write to a name unique to this writer and rename it into place, so that readers and other
+    // processes writing the same entry never see a partial file
+    static std::atomic<uint64_t> writeCount{ 0 };
+    const std::string path = getEntryPath(key, image.format);
+    const std::string temporaryPath =
+      path + kTemporarySuffix +
+      std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "_" +
+      std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "_" +
+      std::to_string(writeCount++);
+    if (!writeDataToDisk(temporaryPath, image.image.data(), image.image.size())) {
+        return false;
+    }
+    // An existing entry is replaced, so its size no longer counts towards the budget
+    std::error_code sizeEc;
+    const uintmax_t replacedSize = fs::file_size(path, sizeEc);
+    const size_t replacedBytes = sizeEc ? 0 : static_cast<size_t>(replacedSize);
+    fs::rename(temporaryPath, path, ec);
+    if (ec) {
+        TF_WARN("Could not add %s to the texture cache: %s", path.c_str(), ec.message().c_str());
+        fs::remove(temporaryPath, ec);
+        return false;
+    }
+    TF_DEBUG_MSG(FILE_FORMAT_UTIL, "TextureDiskCache: wrote %s\n", path.c_str());
+
+    if (!mMaxBytes) {
+        return true;
+    }
+    const std::lock_guard<std::mutex> lock(mMutex);
+    if (mByteSizeKnown) {
+        mByteSize -= std::min(mByteSize, replacedBytes);
+        mByteSize += image.image.size();
+    } else {
+        // A process starting over a directory left behind by a crashed one cleans it up
+        removeStaleTemporaryFiles();
+        mByteSize = computeByteSize();
+        mByteSizeKnown = true;
+    }
+    if (mByteSize > mMaxBytes) {
+        evictToBudget();
+    }
+    return true;
+}
+
+size_t
+TextureDiskCache::computeByteSize() const
+{
+    size_t size = 0;
+    std::error_code ec;
+    for (fs::directory_iterator it(mDirectory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->is_regular_file(ec) && isEntryFile(it->path())) {
+            size += it->file_size(ec);
+        }
+    }
+    return size;
+}
+
+size_t
+TextureDiskCache::getTrackedByteSize()
+{
+    const std::lock_guard<std::mutex> lock(mMutex);
+    return mByteSize;
+}
+
+void
+TextureDiskCache::removeStaleTemporaryFiles()
+{
+    const fs::file_time_type staleTime = fs::file_time_type::clock::now() - kStaleTemporaryAge;
+    size_t removed = 0;
+    std::error_code ec;
+    for (fs::directory_iterator it(mDirectory, ec), end; !ec && it != end; it.increment(ec)) {
+        std::error_code fileEc;
+        if (!it->is_regular_file(fileEc) || !isTemporaryFile(it->path())) {
+            continue;
+        }
+        const fs::file_time_type time = it->last_write_time(fileEc);
+        // A file removed concurrently by another process is not an error
+        if (!fileEc && time < staleTime && fs::remove(it->path(), fileEc)) {
+            removed++;
+        }
+    }
+    if (removed) {
+        TF_DEBUG_MSG(FILE_FORMAT_UTIL,
+                     "TextureDiskCache: removed %zu stale temporary files in %s\n",
+                     removed,
+                     mDirectory.c_str());
+    }
+}
+
+void
+TextureDiskCache::evictToBudget()
+{
+    removeStaleTemporaryFiles();
+
+    // Other processes may share the directory, so the current files are listed rather than relying
+    // on the writes of this process
+    struct Entry
+    {
+        fs::path path;
+        fs::file_time_type time;
+        size_t size;
+    };
+    std::vector<Entry> entries;
+    size_t total = 0;
+    std::error_code ec;
+    for (fs::directory_iterator it(mDirectory, ec), end; !ec && it != end; it.increment(ec)) {
+        std::error_code entryEc;
+        if (!it->is_regular_file(entryEc) || !isEntryFile(it->path())) {
+            continue;
+        }
+        Entry entry{ it->path(), it->last_write_time(entryEc), it->file_size(entryEc) };
+        if (entryEc) {
+            continue;
+        }
+        total += entry.size;
+        entries.push_back(std::move(entry));
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.time < b.time;
+    });
+
+    size_t evicted = 0;
+    for (const Entry& entry : entries) {
+        if (total <= mMaxBytes) {
+            break;
+        }
+        // An entry removed concurrently by another process no longer counts either
+        fs::remove(entry.path, ec);
+        total -= entry.size;
+        evicted++;
+    }
+    mByteSize = total;
+    TF_DEBUG_MSG(FILE_FORMAT_UTIL,
+                 "TextureDiskCache: evicted %zu entries, %zu bytes remain in %s\n",
+                 evicted,
+                 total,
+                 mDirectory.c_str());
+}
+
+}
@@ -357,6 +357,33 @@ printSkeleton(const std::string& header,
                  skeleton.joints.size());
 }
 
+ImageBuffer::ImageBuffer(std::vector<uint8_t>&& bytes)
+  : mSize(bytes.size())
+{
+    if (!bytes.empty()) {
+        // The aliasing constructor keeps the vector alive while pointing at its bytes
+        auto owner = std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
+        mData = std::shared_ptr<const uint8_t>(owner, owner->data());
+    }
+}
+
+ImageBuffer::ImageBuffer(const std::vector<uint8_t>& bytes)
+  : ImageBuffer(std::vector<uint8_t>(bytes))
+{}
+
+ImageBuffer::ImageBuffer(std::initializer_list<uint8_t> bytes)
+  : ImageBuffer(std::vector<uint8_t>(bytes))
+{}
+
+ImageBuffer::ImageBuffer(const uint8_t* data, size_t size)
+  : ImageBuffer(std::vector<uint8_t>(data, data + size))
+{}
+
+ImageBuffer::ImageBuffer(std::shared_ptr<const uint8_t> data, size_t size)
+  : mData(data && size ? std::move(data) : nullptr)
+  , mSize(mData ? size : 0)
+{}
+
 ImageFormat
 getFormat(const std::string& extension)
 {
@@ -623,6 +650,14 @@ UsdData::addNgp()
     return { index, ngps[index] };
 }
 
+std::pair<int, PointInstancer&>
+UsdData::addPointInstancer()
+{
+    int index = pointInstancers.size();
+    pointInstancers.push_back(PointInstancer());
+    return { index, pointInstancers[index] };
+}
+
 std::string
 _makeValidPrimName(const std::string& name, const std::string& defaultName)
 {
@@ -826,6 +861,18 @@ _uniquifyNode(UsdData& data, Node& node)
         _makeUniqueAndAdd(childPrimNames, light.name, &light.displayName);
     }
 
+    // The meshes of a point instancer are written under its prototype, so they only need to be
+    // unique among themselves
+    if (node.pointInstancer >= 0) {
+        PointInstancer& instancer = data.pointInstancers[node.pointInstancer];
+        auto [name, displayName] =
+          _makeValidPrimName(instancer.name, instancer.displayName, "Instancer");
+        instancer.name = name;
+        instancer.displayName = displayName;
+        _makeUniqueAndAdd(childPrimNames, instancer.name, &instancer.displayName);
+        _uniquifySiblingMeshes(data.meshes, instancer.meshes);
+    }
+
     // _uniquifySiblingMeshes cannot be used here: it owns its own namespace map, so it cannot
     // detect collisions with curves or child nodes. Instanceable meshes write an Xform instance
     // prim directly under the parent (layerWriteSdfData.cpp _writeInstancedMesh), so they occupy
@@ -12,7 +12,10 @@ governing permissions and limitations under the License.
 #include <fileformatutils/test.h>
 #include <gtest/gtest.h>
 
+#include <fileformatutils/assetresolver.h>
+#include <fileformatutils/common.h>
 #include <fileformatutils/featureFlags.h>
+#include <fileformatutils/geometry.h>
 #include <fileformatutils/images.h>
 #include <fileformatutils/layerRead.h>
 #include <fileformatutils/layerReadMaterial.h>
@@ -20,7 +23,10 @@ governing permissions and limitations under the License.
 #include <fileformatutils/layerWriteShared.h>
 #include <fileformatutils/materials.h>
 #include <fileformatutils/naming.h>
+#include <fileformatutils/profiling.h>
+#include <fileformatutils/resolver.h>
 #include <fileformatutils/sdfUtils.h>
+#include <fileformatutils/textureCache.h>
 #include <fileformatutils/usdData.h>
 
 #include <pxr/base/arch/fileSystem.h>
@@ -36,7 +42,15 @@ governing permissions and limitations under the License.
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/sdf/schema.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
 #include <filesystem>
+#include <fstream>
+#include <future>
+#include <thread>
 
 // Set to true to (re-)generate USDA baselines, false to compare against them
 constexpr bool UPDATE_USDA_BASELINES = false;
@@ -828,6 +842,308 @@ TEST(FileFormatUtilsTests, writeNodeCustomPropertiesEmpty)
     EXPECT_TRUE(prim->GetCustomData().empty());
 }
 
+TEST(FileFormatUtilsTests, writeLayerMetadataOnly)
+{
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous("Scene.usda");
+    SdfAbstractDataRefPtr sdfData(new SdfData());
+    UsdData data;
+    data.upAxis = TfToken("Z");
+    data.metersPerUnit = 0.01;
+    data.metadata.SetValueAtPath("generator", VtValue(std::string("test")));
+    fillGeneralTestMaterial(data);
+    auto [rootIdx, root] = data.addNode(-1);
+    root.name = "Root";
+
+    WriteLayerOptions options;
+    options.metadataOnly = true;
+    writeLayer(
+      options, data, &*layer, sdfData, "Test Data", "Testing", TestFileFormat::SetLayerData);
+
+    // The layer metadata is authored as for a full write, but no scene description is
+    EXPECT_EQ(layer->GetDefaultPrim(), TfToken("Scene"));
+    EXPECT_EQ(layer->GetField(SdfPath::AbsoluteRootPath(), TfToken("upAxis")),
+              VtValue(TfToken("Z")));
+    EXPECT_EQ(layer->GetField(SdfPath::AbsoluteRootPath(), TfToken("metersPerUnit")),
+              VtValue(0.01));
+    EXPECT_EQ(layer->GetCustomLayerData()["generator"], VtValue(std::string("test")));
+    SdfPrimSpecHandle scene = layer->GetPrimAtPath(SdfPath("/Scene"));
+    ASSERT_TRUE(scene);
+    EXPECT_TRUE(scene->GetNameChildren().empty());
+}
+
+TEST(FileFormatUtilsTests, profileScopeRecordsPhasesAndCounters)
+{
+    clearProfileStats();
+    {
+        // Without a scope, phases and counters are dropped
+        ProfilePhase phase("orphan");
+        profileAddCounter("orphan", 1);
+    }
+    EXPECT_TRUE(getProfileStats().empty());
+
+    {
+        ProfileScope scope("test", "read", "/profile/test.file");
+        ProfilePhase importPhase("import");
+        {
+            ProfilePhase materialsPhase("materials");
+            profileAddCounter("decodedImages", 1);
+        }
+        {
+            ProfilePhase materialsPhase("materials");
+            profileAddCounter("decodedImages", 2);
+        }
+        importPhase.stop();
+        {
+            // A nested scope collects on its own, and restores the outer one when it ends
+            ProfileScope innerScope("test", "read", "/profile/inner.file");
+            ProfilePhase parsePhase("parse");
+        }
+        ProfilePhase writePhase("writeLayer");
+        writePhase.stop();
+
+        ProfileStats current;
+        ASSERT_TRUE(getCurrentProfileStats(current));
+        EXPECT_EQ(current.path, "/profile/test.file");
+    }
+    EXPECT_FALSE(ProfileScope::current());
+
+    ProfileStats stats;
+    ASSERT_TRUE(getLatestProfileStats("/profile/test.file", stats, "read"));
+    EXPECT_FALSE(getLatestProfileStats("/profile/test.file", stats, "write"));
+    ASSERT_TRUE(getLatestProfileStats("/profile/test.file", stats));
+    ASSERT_EQ(stats.phases.size(), 3u);
+    EXPECT_EQ(stats.phases[0].first, "import/materials");
+    EXPECT_EQ(stats.phases[1].first, "import");
+    EXPECT_EQ(stats.phases[2].first, "writeLayer");
+    EXPECT_EQ(stats.getCounter("decodedImages"), 3);
+    EXPECT_GE(stats.totalMs, stats.getPhaseMs("import"));
+    EXPECT_GE(stats.getPhaseMs("import"), stats.getPhaseMs("import/materials"));
+
+    ProfileStats inner;
+    ASSERT_TRUE(getLatestProfileStats("/profile/inner.file", inner));
+    ASSERT_EQ(inner.phases.size(), 1u);
+    EXPECT_EQ(inner.phases[0].first, "parse");
+
+    clearProfileStats();
+    EXPECT_TRUE(getProfileStats().empty());
+}
+
+TEST(FileFormatUtilsTests, writeLayerProfileStatsCustomData)
+{
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous("Scene.usda");
+    SdfAbstractDataRefPtr sdfData(new SdfData());
+    UsdData data;
+    data.metadata.SetValueAtPath("generator", VtValue(std::string("test")));
+    auto [meshIdx, mesh] = data.addMesh();
+    mesh.name = "Triangle";
+    mesh.points = { GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(0, 1, 0) };
+    mesh.faces = { 3 };
+    mesh.indices = { 0, 1, 2 };
+    auto [rootIdx, root] = data.addNode(-1);
+    root.name = "Root";
+    root.staticMeshes.push_back(meshIdx);
+
+    WriteLayerOptions options;
+    options.writeProfileStats = true;
+    {
+        ProfileScope scope("test", "read", "/profile/scene.file");
+        writeLayer(
+          options, data, &*layer, sdfData, "Test Data", "Testing", TestFileFormat::SetLayerData);
+    }
+
+    // The stats are added next to the existing custom layer data
+    VtDictionary customLayerData = layer->GetCustomLayerData();
+    EXPECT_EQ(customLayerData["generator"], VtValue(std::string("test")));
+    ASSERT_TRUE(customLayerData[kProfileStatsCustomDataKey].IsHolding<VtDictionary>());
+    const VtDictionary& stats =
+      customLayerData[kProfileStatsCustomDataKey].UncheckedGet<VtDictionary>();
+    EXPECT_EQ(stats.at("plugin"), VtValue(std::string("test")));
+    ASSERT_TRUE(stats.at("phasesMs").IsHolding<VtDictionary>());
+    const VtDictionary& phases = stats.at("phasesMs").UncheckedGet<VtDictionary>();
+    EXPECT_TRUE(phases.count("writeLayer"));
+    EXPECT_TRUE(phases.count("writeLayer/nodes"));
+    ASSERT_TRUE(stats.at("counters").IsHolding<VtDictionary>());
+    const VtDictionary& counters = stats.at("counters").UncheckedGet<VtDictionary>();
+    EXPECT_EQ(counters.at("points"), VtValue(int64_t(3)));
+
+    // Reading the layer back for an export leaves the stats behind
+    UsdData readData;
+    ASSERT_TRUE(readLayer(ReadLayerOptions(), *layer, readData, "Testing"));
+    EXPECT_EQ(readData.metadata.count(kProfileStatsCustomDataKey), 0u);
+    EXPECT_EQ(readData.metadata["generator"], VtValue(std::string("test")));
+
+    // Without a scope, nothing is authored even with the option set
+    SdfLayerRefPtr plainLayer = SdfLayer::CreateAnonymous("Scene.usda");
+    SdfAbstractDataRefPtr plainData(new SdfData());
+    writeLayer(
+      options, data, &*plainLayer, plainData, "Test Data", "Testing", TestFileFormat::SetLayerData);
+    EXPECT_EQ(plainLayer->GetCustomLayerData().count(kProfileStatsCustomDataKey), 0u);
+    clearProfileStats();
+}
+
+// A flat grid of cells x cells quads, with the face index as uniform opacity
+Mesh
+makeQuadGrid(int cells)
+{
+    Mesh mesh;
+    mesh.name = "Grid";
+    const int side = cells + 1;
+    for (int y = 0; y < side; y++) {
+        for (int x = 0; x < side; x++) {
+            mesh.points.push_back(GfVec3f(x, y, 0));
+        }
+    }
+    Primvar<float> opacities;
+    opacities.interpolation = UsdGeomTokens->uniform;
+    for (int y = 0; y < cells; y++) {
+        for (int x = 0; x < cells; x++) {
+            mesh.faces.push_back(4);
+            mesh.indices.push_back(y * side + x);
+            mesh.indices.push_back(y * side + x + 1);
+            mesh.indices.push_back((y + 1) * side + x + 1);
+            mesh.indices.push_back((y + 1) * side + x);
+            opacities.values.push_back(y * cells + x);
+        }
+    }
+    mesh.opacities.push_back(opacities);
+    return mesh;
+}
+
+TEST(FileFormatUtilsTests, triangulateLargeMesh)
+{
+    // Enough faces to be split into several ranges that are processed concurrently
+    const int cells = 256;
+    const int numQuads = cells * cells;
+    ASSERT_GT(static_cast<size_t>(numQuads), 2 * kGeometryParallelGrainSize);
+    const Mesh quads = makeQuadGrid(cells);
+    Mesh mesh = quads;
+    Subset subset;
+    for (int q = 0; q < numQuads; q += 2) {
+        subset.faces.push_back(q);
+    }
+    mesh.subsets.push_back(subset);
+
+    ASSERT_TRUE(triangulateMesh(mesh));
+    ASSERT_EQ(mesh.faces.size(), 2u * numQuads);
+    ASSERT_EQ(mesh.indices.size(), 6u * numQuads);
+    EXPECT_TRUE(
+      std::all_of(mesh.faces.begin(), mesh.faces.end(), [](int count) { return count == 3; }));
+    bool fansMatch = true;
+    for (int q = 0; q < numQuads && fansMatch; q++) {
+        const int* quad = &quads.indices[q * 4];
+        const int* tris = &mesh.indices[q * 6];
+        const float* opacities = &mesh.opacities[0].values[q * 2];
+        fansMatch = tris[0] == quad[0] && tris[1] == quad[1] && tris[2] == quad[2] &&
+                    tris[3] == quad[0] && tris[4] == quad[2] && tris[5] == quad[3] &&
+                    opacities[0] == q && opacities[1] == q;
+    }
+    EXPECT_TRUE(fansMatch);
+    ASSERT_EQ(mesh.subsets[0].faces.size(), static_cast<size_t>(numQuads));
+    EXPECT_EQ(mesh.subsets[0].faces[0], 0);
+    EXPECT_EQ(mesh.subsets[0].faces[1], 1);
+    EXPECT_EQ(mesh.subsets[0].faces[2], 4);
+    EXPECT_EQ(mesh.subsets[0].faces.back(), 2 * numQuads - 3);
+
+    // The smooth normals generated for the triangulation of a flat grid all point up
+    ASSERT_EQ(mesh.normals.values.size(), quads.points.size());
+    EXPECT_TRUE(std::all_of(mesh.normals.values.begin(),
+                            mesh.normals.values.end(),
+                            [](const GfVec3f& n) { return GfIsClose(n, GfVec3f(0, 0, 1), 1e-6); }));
+
+    // The uniform opacities force the expansion of every face vertex into its own point
+    Mesh expanded = mesh;
+    forceVertexInterpolation(expanded);
+    ASSERT_EQ(expanded.points.size(), mesh.indices.size());
+    ASSERT_EQ(expanded.opacities[0].values.size(), mesh.indices.size());
+    bool expansionMatches = true;
+    for (size_t i = 0; i < expanded.indices.size() && expansionMatches; i++) {
+        expansionMatches = expanded.indices[i] == static_cast<int>(i) &&
+                           expanded.points[i] == mesh.points[mesh.indices[i]] &&
+                           expanded.opacities[0].values[i] == mesh.opacities[0].values[i / 3];
+    }
+    EXPECT_TRUE(expansionMatches);
+
+    // Repeated runs give the same result
+    Mesh again = quads;
+    again.subsets.push_back(subset);
+    ASSERT_TRUE(triangulateMesh(again));
+    EXPECT_EQ(again.indices, mesh.indices);
+    EXPECT_EQ(again.normals.values, mesh.normals.values);
+    EXPECT_EQ(again.subsets[0].faces, mesh.subsets[0].faces);
+}
+
+TEST(FileFormatUtilsTests, verifyMeshesReportsIssuesInSceneOrder)
+{
+    UsdData data;
+    for (int i = 0; i < 64; i++) {
+        auto [meshIndex, mesh] = data.addMesh();
+        mesh.name = "Mesh" + std::to_string(i);
+        mesh.points = { GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(0, 1, 0) };
+        mesh.faces = { 3 };
+        // Every third mesh references a point that doesn't exist
+        mesh.indices = { 0, 1, i % 3 ? 2 : 3 };
+        auto [nodeIndex, node] = data.addNode(-1);
+        node.path = "/Node" + std::to_string(i);
+        node.staticMeshes.push_back(meshIndex);
+    }
+
+    IssueVector issues;
+    EXPECT_FALSE(verifyMeshes(data, &issues));
+    std::vector<std::string> paths;
+    for (const Issue& issue : issues) {
+        if (paths.empty() || paths.back() != issue.path) {
+            paths.push_back(issue.path);
+        }
+    }
+    std::vector<std::string> expectedPaths;
+    for (int i = 0; i < 64; i += 3) {
+        expectedPaths.push_back("/Node" + std::to_string(i) + "/Mesh" + std::to_string(i));
+    }
+    EXPECT_EQ(paths, expectedPaths);
+}
+
+TEST(FileFormatUtilsTests, writeLayerMeshExtentsAndNodeTimeSamples)
+{
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous("Scene.usda");
+    SdfAbstractDataRefPtr sdfData(new SdfData());
+    UsdData data;
+    for (int i = 0; i < 8; i++) {
+        auto [meshIndex, mesh] = data.addMesh();
+        mesh.name = "Mesh" + std::to_string(i);
+        mesh.points = { GfVec3f(i, 0, 0), GfVec3f(i + 1, 0, 0), GfVec3f(i, 1, -i) };
+        mesh.faces = { 3 };
+        mesh.indices = { 0, 1, 2 };
+        auto [nodeIndex, node] = data.addNode(-1);
+        node.name = "Node" + std::to_string(i);
+        node.staticMeshes.push_back(meshIndex);
+        NodeAnimation animation;
+        animation.translations.times = { 0.0f, 1.0f };
+        animation.translations.values = { GfVec3f(0, 0, 0), GfVec3f(0, i, 0) };
+        node.animations.push_back(animation);
+    }
+
+    writeLayer(WriteLayerOptions(),
+               data,
+               &*layer,
+               sdfData,
+               "Test Data",
+               "Testing",
+               TestFileFormat::SetLayerData);
+
+    for (int i = 0; i < 8; i++) {
+        const std::string nodePath = "/Scene/Node" + std::to_string(i);
+        SdfPath extentPath(nodePath + "/Mesh" + std::to_string(i) + ".extent");
+        EXPECT_EQ(layer->GetField(extentPath, SdfFieldKeys->Default),
+                  VtValue(VtVec3fArray{ GfVec3f(i, 0, -i), GfVec3f(i + 1, 1, 0) }));
+
+        SdfPath translatePath(nodePath + ".xformOp:translate");
+        EXPECT_EQ(layer->GetNumTimeSamplesForPath(translatePath), 2u);
+        VtValue translation;
+        ASSERT_TRUE(layer->QueryTimeSample(translatePath, 1.0, &translation));
+        EXPECT_EQ(translation, VtValue(GfVec3d(0, i, 0)));
+    }
+}
+
 TEST(FileFormatUtilsTests, writeNodeCustomPropertiesAuthorsVerbatim)
 {
     SdfLayerRefPtr layer = SdfLayer::CreateAnonymous("Scene.usda");
@@ -1377,6 +1693,60 @@ TEST(InputTranslatorTests, TranslateMaxImages)
     }
 }
 
+// Combining images of different resolutions bilinearly resamples the smaller one to the size of
+// the larger one.
+TEST(InputTranslatorTests, TranslateProductResamplesSmallerImage)
+{
+    std::vector<ImageAsset> images;
+    InputTranslator translator(/*exportImages=*/true, images, "test");
+
+    // Image A: 4×2 RGB, every pixel = (1, 0.5, 0.25)
+    // Image B: 2×1 single channel read as a scalar, pixels 0.2 and 0.6
+    Image imgA, imgB;
+    imgA.allocate(4, 2, 3);
+    for (int i = 0; i < 8; ++i) {
+        imgA.pixels[i * 3 + 0] = 1.0f;
+        imgA.pixels[i * 3 + 1] = 0.5f;
+        imgA.pixels[i * 3 + 2] = 0.25f;
+    }
+    imgB.allocate(2, 1, 1);
+    imgB.pixels[0] = 0.2f;
+    imgB.pixels[1] = 0.6f;
+
+    Input inA, inB;
+    inA.image = translator.addImage(
+      std::move(imgA), "imgA", "imgA.png", ImageFormatPng, /*intermediate=*/true);
+    inA.channel = AdobeTokens->rgb;
+    inB.image = translator.addImage(
+      std::move(imgB), "imgB", "imgB.png", ImageFormatPng, /*intermediate=*/true);
+    inB.channel = AdobeTokens->r;
+
+    Input out;
+    ASSERT_TRUE(translator.translateProduct("productAB", inA, inB, out));
+    ASSERT_GE(out.image, 0);
+    const std::vector<ImageAsset>& outImages = translator.getImages();
+    ASSERT_EQ(outImages.size(), 1u);
+
+    Image decoded;
+    ASSERT_TRUE(decoded.read(outImages[0]));
+    ASSERT_EQ(decoded.width, 4);
+    ASSERT_EQ(decoded.height, 2);
+    ASSERT_EQ(decoded.channels, 3);
+
+    // The inner columns land a quarter and three quarters of the way between the pixels of B,
+    // and both rows sample the single row of B
+    constexpr float kTol = 0.01f;
+    const float expectedB[2] = { 0.3f, 0.5f };
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 1; x < 3; ++x) {
+            const float* pixel = decoded.pixels.data() + (y * 4 + x) * 3;
+            EXPECT_NEAR(pixel[0], expectedB[x - 1], kTol) << x << "," << y;
+            EXPECT_NEAR(pixel[1], expectedB[x - 1] * 0.5f, kTol) << x << "," << y;
+            EXPECT_NEAR(pixel[2], expectedB[x - 1] * 0.25f, kTol) << x << "," << y;
+        }
+    }
+}
+
 // Verify that intermediate=true results are stored inside the translator and can be
 // consumed by a subsequent operation without appearing in getImages().
 //
@@ -1427,6 +1797,55 @@ TEST(InputTranslatorTests, TranslateIntermediateChaining)
     EXPECT_NEAR(decoded.pixels[2], 0.5f, kTol) << "B";
 }
 
+// Within a batch, images are generated at endBatch, with the indices they would have without the
+// batch, and jobs reading an intermediate image run after the job producing it.
+TEST(InputTranslatorTests, TranslateBatchMatchesUnbatched)
+{
+    std::vector<ImageAsset> images;
+    InputTranslator translator(/*exportImages=*/true, images, "test");
+
+    Image srcImg;
+    srcImg.allocate(2, 1, 3);
+    srcImg.pixels = { 0.5f, 0.5f, 0.5f, 0.2f, 0.4f, 0.6f };
+    Input src;
+    src.image = translator.addImage(
+      std::move(srcImg), "src", "src.png", ImageFormatPng, /*intermediate=*/true);
+    src.channel = AdobeTokens->rgb;
+
+    translator.beginBatch();
+    Input factor;
+    factor.value = VtValue(GfVec3f(0.8f, 0.8f, 0.8f));
+    Input step1;
+    ASSERT_TRUE(translator.translateProduct("step1", src, factor, step1, /*intermediate=*/true));
+    Input floor;
+    floor.value = VtValue(GfVec3f(0.45f, 0.45f, 0.45f));
+    Input maxOut;
+    ASSERT_TRUE(translator.translateMax("step2", step1, floor, maxOut));
+    Input productOut;
+    ASSERT_TRUE(translator.translateProduct("other", src, factor, productOut));
+    EXPECT_EQ(maxOut.image, 0);
+    EXPECT_EQ(productOut.image, 1);
+    ASSERT_TRUE(translator.endBatch());
+
+    const std::vector<ImageAsset>& outImages = translator.getImages();
+    ASSERT_EQ(outImages.size(), 2u);
+    EXPECT_EQ(outImages[0].name, "step2");
+    EXPECT_EQ(outImages[1].name, "other");
+
+    Image maxImage, productImage;
+    ASSERT_TRUE(maxImage.read(outImages[0]));
+    ASSERT_TRUE(productImage.read(outImages[1]));
+    maxImage.convertToFloat();
+    productImage.convertToFloat();
+    const float expectedMax[6] = { 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.48f };
+    const float expectedProduct[6] = { 0.4f, 0.4f, 0.4f, 0.16f, 0.32f, 0.48f };
+    constexpr float kTol = 0.01f;
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_NEAR(maxImage.pixels[i], expectedMax[i], kTol) << i;
+        EXPECT_NEAR(productImage.pixels[i], expectedProduct[i], kTol) << i;
+    }
+}
+
 // Encode an Image into a source ImageAsset (with real encoded bytes) so that the phong-to-PBR
 // bake path, which re-reads source textures from the encoded byte stream, can decode it.
 static ImageAsset
@@ -1518,6 +1937,224 @@ TEST(InputTranslatorTests, Phong2PBROnlyGlossTexture)
     EXPECT_FALSE(decodedRoughness.pixels.empty());
 }
 
+// Translations that leave the pixels unchanged must keep the encoded bytes of the source image
+// instead of decoding and encoding it again.
+TEST(InputTranslatorTests, IdentityTranslationsKeepSourceBytes)
+{
+    Image rgbImg;
+    rgbImg.allocate(2, 2, 3);
+    for (size_t i = 0; i < rgbImg.pixels.size(); ++i)
+        rgbImg.pixels[i] = 0.1f * i;
+    Image grayImg;
+    grayImg.allocate(2, 2, 1);
+    grayImg.pixels = { 0.2f, 0.4f, 0.6f, 0.8f };
+
+    std::vector<ImageAsset> images;
+    images.push_back(makeSourceImage(rgbImg, "color.png"));
+    images.push_back(makeSourceImage(grayImg, "gray.png"));
+    const ImageBuffer colorBytes = images[0].image;
+    const ImageBuffer grayBytes = images[1].image;
+    InputTranslator translator(/*exportImages=*/true, images, "test");
+
+    Input color;
+    color.image = 0;
+    color.channel = AdobeTokens->rgb;
+    Input gray;
+    gray.image = 1;
+    gray.channel = AdobeTokens->r;
+    Input one;
+    one.value = VtValue(1.0f);
+    Input zero;
+    zero.value = VtValue(0.0f);
+
+    Input productOut, lerpOut, affineOut, channelOut;
+    ASSERT_TRUE(translator.translateProduct("product", color, one, productOut));
+    ASSERT_TRUE(translator.translateLerp("lerp", color, one, zero, lerpOut));
+    ASSERT_TRUE(translator.translateAffine("affine", gray, 1.0f, 0.0f, affineOut));
+    ASSERT_TRUE(translator.translateToSingle("channel", gray, channelOut));
+
+    const std::vector<ImageAsset>& outImages = translator.getImages();
+    ASSERT_EQ(outImages.size(), 2u);
+    EXPECT_EQ(productOut.image, lerpOut.image);
+    EXPECT_EQ(productOut.channel, AdobeTokens->rgb);
+    EXPECT_TRUE(outImages[productOut.image].image.sharesWith(colorBytes));
+    EXPECT_EQ(affineOut.image, channelOut.image);
+    EXPECT_TRUE(outImages[affineOut.image].image.sharesWith(grayBytes));
+}
+
+// Translating the same source images again reads the generated texture from the disk cache, and
+// intermediate images key the entries generated from them by their own key.
+TEST(InputTranslatorTests, DiskCacheServesTranslatedTextures)
+{
+    namespace fs = std::filesystem;
+    const fs::path cacheDir = fs::temp_directory_path() / "fileformatutils-texture-disk-cache";
+    fs::remove_all(cacheDir);
+    TextureDiskCache cache(cacheDir.string(), 0);
+
+    Image imgA, imgB;
+    imgA.allocate(4, 4, 3);
+    imgB.allocate(4, 4, 3);
+    for (size_t i = 0; i < imgA.pixels.size(); ++i) {
+        imgA.pixels[i] = (i % 7) / 7.0f;
+        imgB.pixels[i] = (i % 5) / 5.0f;
+    }
+    auto translate = [&](ImageAsset& result) {
+        std::vector<ImageAsset> images;
+        images.push_back(makeSourceImage(imgA, "a.png"));
+        images.push_back(makeSourceImage(imgB, "b.png"));
+        InputTranslator translator(/*exportImages=*/true, images, "test");
+        translator.setTextureDiskCache(&cache);
+        Input inA, inB, maxOut, product, out;
+        inA.image = 0;
+        inA.channel = AdobeTokens->rgb;
+        inB.image = 1;
+        inB.channel = AdobeTokens->rgb;
+        ASSERT_TRUE(translator.translateMax("max", inA, inB, maxOut, /*intermediate=*/true));
+        ASSERT_TRUE(translator.translateProduct("product", maxOut, inB, product));
+        ASSERT_EQ(translator.getImages().size(), 1u);
+        result = translator.getImage(product.image);
+    };
+
+    ProfileScope scope("test", "read", "diskCache");
+    ImageAsset generated;
+    translate(generated);
+    ASSERT_FALSE(generated.image.empty());
+    ImageAsset cached;
+    translate(cached);
+
+    ProfileStats stats;
+    ASSERT_TRUE(getCurrentProfileStats(stats));
+    EXPECT_EQ(stats.getCounter("textureCacheMisses"), 1);
+    EXPECT_EQ(stats.getCounter("textureCacheHits"), 1);
+    EXPECT_EQ(cached.uri, generated.uri);
+    ASSERT_EQ(cached.image.size(), generated.image.size());
+    EXPECT_TRUE(std::equal(cached.image.begin(), cached.image.end(), generated.image.begin()));
+    EXPECT_EQ(cache.computeByteSize(), generated.image.size());
+    fs::remove_all(cacheDir);
+}
+
+TEST(TextureDiskCacheTests, EvictsLeastRecentlyUsedEntries)
+{
+    namespace fs = std::filesystem;
+    const fs::path cacheDir = fs::temp_directory_path() / "fileformatutils-texture-disk-eviction";
+    fs::remove_all(cacheDir);
+    TextureDiskCache cache(cacheDir.string(), 250);
+    EXPECT_FALSE(TextureDiskCache("", 0).isEnabled());
+
+    auto makeEntry = [](uint8_t value) {
+        ImageAsset image;
+        image.format = ImageFormatPng;
+        image.image = ImageBuffer(std::vector<uint8_t>(100, value));
+        return image;
+    };
+    const std::string keyA = TextureDiskCache::makeKey("a");
+    const std::string keyB = TextureDiskCache::makeKey("b");
+    const std::string keyC = TextureDiskCache::makeKey("c");
+    EXPECT_EQ(keyA.size(), 32u);
+    EXPECT_NE(keyA, keyB);
+    ASSERT_TRUE(cache.write(keyA, makeEntry(1)));
+    ASSERT_TRUE(cache.write(keyB, makeEntry(2)));
+
+    // Age both entries, then use the first one, so the second one is the least recently used
+    const auto now = fs::file_time_type::clock::now();
+    fs::last_write_time(cacheDir / (keyA + ".png"), now - std::chrono::hours(2));
+    fs::last_write_time(cacheDir / (keyB + ".png"), now - std::chrono::hours(1));
+    ImageAsset read;
+    read.format = ImageFormatPng;
+    ASSERT_TRUE(cache.read(keyA, read));
+    EXPECT_EQ(read.image.size(), 100u);
+    EXPECT_EQ(read.image[0], 1);
+
+    ASSERT_TRUE(cache.write(keyC, makeEntry(3)));
+    EXPECT_EQ(cache.computeByteSize(), 200u);
+    EXPECT_TRUE(cache.read(keyA, read));
+    EXPECT_FALSE(cache.read(keyB, read));
+    EXPECT_TRUE(cache.read(keyC, read));
+    fs::remove_all(cacheDir);
+}
+
+TEST(TextureDiskCacheTests, OnlyCountsAndEvictsEntries)
+{
+    namespace fs = std::filesystem;
+    const fs::path cacheDir = fs::temp_directory_path() / "fileformatutils-texture-disk-shared";
+    fs::remove_all(cacheDir);
+    fs::create_directories(cacheDir);
+    TextureDiskCache cache(cacheDir.string(), 150);
+
+    // Files of the user in the same directory, older than any entry and over the budget on their
+    // own, are neither counted nor evicted
+    const fs::path unrelated[] = { cacheDir / "notes.png", cacheDir / "data.bin" };
+    for (const fs::path& path : unrelated) {
+        std::ofstream(path, std::ios::binary) << std::string(200, 'x');
+        fs::last_write_time(path, fs::file_time_type::clock::now() - std::chrono::hours(24));
+    }
+
+    ImageAsset image;
+    image.format = ImageFormatPng;
+    image.image = ImageBuffer(std::vector<uint8_t>(100, 1));
+    const std::string key = TextureDiskCache::makeKey("shared");
+    ASSERT_TRUE(cache.write(key, image));
+    EXPECT_EQ(cache.computeByteSize(), 100u);
+
+    // Rewriting an entry replaces it rather than adding to the size of the cache
+    ASSERT_TRUE(cache.write(key, image));
+    EXPECT_EQ(cache.computeByteSize(), 100u);
+    ImageAsset read;
+    read.format = ImageFormatPng;
+    EXPECT_TRUE(cache.read(key, read));
+    for (const fs::path& path : unrelated) {
+        EXPECT_TRUE(fs::exists(path)) << path;
+    }
+    fs::remove_all(cacheDir);
+}
+
+// The size tracked by the writes, which only scan the directory when the budget seems exceeded,
+// follows rewrites and evictions. Temporary files left by a crashed writer are removed on eviction.
+TEST(TextureDiskCacheTests, TracksByteSizeAndRemovesStaleTemporaryFiles)
+{
+    namespace fs = std::filesystem;
+    const fs::path cacheDir = fs::temp_directory_path() / "fileformatutils-texture-disk-tracked";
+    fs::remove_all(cacheDir);
+    TextureDiskCache cache(cacheDir.string(), 250);
+
+    auto makeEntry = [](size_t size) {
+        ImageAsset image;
+        image.format = ImageFormatPng;
+        image.image = ImageBuffer(std::vector<uint8_t>(size, 1));
+        return image;
+    };
+    const std::string keyA = TextureDiskCache::makeKey("a");
+    const std::string keyB = TextureDiskCache::makeKey("b");
+    const std::string keyC = TextureDiskCache::makeKey("c");
+    ASSERT_TRUE(cache.write(keyA, makeEntry(100)));
+    EXPECT_EQ(cache.getTrackedByteSize(), 100u);
+
+    // A rewrite with a different size replaces the size of the entry, without going over budget
+    ASSERT_TRUE(cache.write(keyA, makeEntry(120)));
+    EXPECT_EQ(cache.getTrackedByteSize(), 120u);
+    ASSERT_TRUE(cache.write(keyB, makeEntry(100)));
+    EXPECT_EQ(cache.getTrackedByteSize(), 220u);
+
+    // A temporary file of a writer that crashed long ago, and one of a writer still running
+    const auto now = fs::file_time_type::clock::now();
+    const fs::path stale = cacheDir / (keyC + ".png.tmp1_2_3");
+    const fs::path fresh = cacheDir / (keyC + ".png.tmp4_5_6");
+    for (const fs::path& path : { stale, fresh }) {
+        std::ofstream(path, std::ios::binary) << std::string(100, 'x');
+    }
+    fs::last_write_time(stale, now - std::chrono::hours(24));
+    fs::last_write_time(cacheDir / (keyA + ".png"), now - std::chrono::hours(1));
+
+    // Going over budget evicts the least recently used entry, and the stale temporary file
+    ASSERT_TRUE(cache.write(keyC, makeEntry(100)));
+    EXPECT_EQ(cache.getTrackedByteSize(), 200u);
+    EXPECT_EQ(cache.computeByteSize(), 200u);
+    EXPECT_FALSE(fs::exists(cacheDir / (keyA + ".png")));
+    EXPECT_FALSE(fs::exists(stale));
+    EXPECT_TRUE(fs::exists(fresh));
+    fs::remove_all(cacheDir);
+}
+
 TEST(NamingTest, MakeValidUsdIdentifier)
 {
     using adobe::usd::MakeValidUsdIdentifier;
@@ -1798,6 +2435,311 @@ TEST(ImageTests, AllocateAndTransformValidDimensions)
     EXPECT_EQ(decoded.channels, 4);
 }
 
+// 8 bit images read with keepPixelType stay 8 bit through a channel copy, and are converted to
+// the same float values as a regular read when an operation needs float pixels.
+TEST(ImageTests, KeepPixelTypeThroughChannelExtraction)
+{
+    Image src;
+    ASSERT_TRUE(src.allocate(4, 4, 3, ImagePixelType::UInt8));
+    EXPECT_TRUE(src.pixels.empty());
+    uint8_t* values = src.getPixels<uint8_t>();
+    ASSERT_NE(values, nullptr);
+    EXPECT_EQ(src.getPixels<float>(), nullptr);
+    for (size_t i = 0; i < src.getValueCount(); i++) {
+        values[i] = static_cast<uint8_t>(i * 5);
+    }
+
+    ImageAsset asset;
+    asset.format = ImageFormatPng;
+    ASSERT_TRUE(src.write(asset));
+    Image native;
+    ASSERT_TRUE(native.read(asset, -1, true));
+    EXPECT_EQ(native.pixelType, ImagePixelType::UInt8);
+    EXPECT_EQ(native.nativePixels, src.nativePixels);
+    Image decoded;
+    ASSERT_TRUE(decoded.read(asset));
+    EXPECT_EQ(decoded.pixelType, ImagePixelType::Float);
+
+    Image channel;
+    ASSERT_TRUE(imageExtractChannel(native, 1, 1.0f, 0.0f, channel));
+    EXPECT_EQ(channel.pixelType, ImagePixelType::UInt8);
+    const uint8_t* channelValues = channel.getPixels<uint8_t>();
+    ASSERT_NE(channelValues, nullptr);
+    for (int i = 0; i < 16; i++) {
+        EXPECT_EQ(channelValues[i], values[i * 3 + 1]);
+    }
+
+    Image scaled;
+    ASSERT_TRUE(imageExtractChannel(native, 1, 0.5f, 0.0f, scaled));
+    EXPECT_EQ(scaled.pixelType, ImagePixelType::Float);
+    for (int i = 0; i < 16; i++) {
+        EXPECT_FLOAT_EQ(scaled.pixels[i], decoded.pixels[i * 3 + 1] * 0.5f);
+    }
+
+    auto [nativeMin, nativeMax] = native.computeRange();
+    auto [decodedMin, decodedMax] = decoded.computeRange();
+    EXPECT_EQ(nativeMin, decodedMin);
+    EXPECT_EQ(nativeMax, decodedMax);
+
+    native.convertToFloat();
+    EXPECT_EQ(native.pixelType, ImagePixelType::Float);
+    EXPECT_TRUE(native.nativePixels.empty());
+    EXPECT_EQ(native.pixels, decoded.pixels);
+}
+
+// Images above the parallel grain size are processed in concurrent ranges, which must give exactly
+// the per pixel results.
+TEST(ImageTests, LargeImageKernelsMatchPerPixelResults)
+{
+    const int size = 512;
+    Image src;
+    ASSERT_TRUE(src.allocate(size, size + 1, 3));
+    for (size_t i = 0; i < src.pixels.size(); i++) {
+        src.pixels[i] = static_cast<float>((i * 7919) % 1000) / 999.0f;
+    }
+    src.pixels[12345] = -3.0f;
+    src.pixels[src.pixels.size() - 1] = 5.0f;
+
+    auto [minValues, maxValues] = src.computeRange();
+    EXPECT_EQ(minValues, GfVec4f(-3.0f, 0.0f, 0.0f, FLT_MAX));
+    EXPECT_EQ(maxValues, GfVec4f(1.0f, 1.0f, 5.0f, -FLT_MAX));
+
+    Image channel;
+    ASSERT_TRUE(imageExtractChannel(src, 2, 0.5f, 0.25f, channel));
+    Image scaled;
+    ASSERT_TRUE(imageTransformAffine(src, 2.0f, -1.0f, scaled));
+    Image product;
+    ASSERT_TRUE(imageMult(src, channel, product));
+    for (size_t i = 0; i < channel.pixels.size(); i++) {
+        ASSERT_FLOAT_EQ(channel.pixels[i], src.pixels[i * 3 + 2] * 0.5f + 0.25f);
+        for (int c = 0; c < 3; c++) {
+            ASSERT_FLOAT_EQ(scaled.pixels[i * 3 + c], 2.0f * src.pixels[i * 3 + c] - 1.0f);
+            ASSERT_EQ(product.pixels[i * 3 + c], src.pixels[i * 3 + c] * channel.pixels[i]);
+        }
+    }
+}
+
+TEST(ImageTests, SrgbLinearConversionOfSpansAndImages)
+{
+    std::vector<float> values;
+    for (int i = -10; i <= 1010; i++) {
+        values.push_back(i / 1000.0f + 0.0003f);
+    }
+    std::vector<float> linear = values;
+    srgbToLinear(linear.data(), linear.size());
+    std::vector<float> srgb = values;
+    linearToSRGB(srgb.data(), srgb.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        EXPECT_NEAR(linear[i], srgbToLinear(values[i]), 5e-7f) << values[i];
+        EXPECT_NEAR(srgb[i], linearToSRGB(values[i]), 5e-6f) << values[i];
+    }
+
+    // 8 bit images are converted exactly, and only the requested channels
+    Image image;
+    ASSERT_TRUE(image.allocate(16, 16, 4, ImagePixelType::UInt8));
+    uint8_t* pixels = image.getPixels<uint8_t>();
+    for (size_t i = 0; i < image.getValueCount(); i++) {
+        pixels[i] = static_cast<uint8_t>(i);
+    }
+    Image decoded = image;
+    decoded.convertToFloat();
+    ASSERT_TRUE(imageSrgbToLinear(image, 0, 3));
+    ASSERT_EQ(image.pixelType, ImagePixelType::Float);
+    for (size_t i = 0; i < image.getValueCount(); i++) {
+        const float expected = i % 4 == 3 ? decoded.pixels[i] : srgbToLinear(decoded.pixels[i]);
+        EXPECT_EQ(image.pixels[i], expected) << i;
+    }
+
+    ASSERT_TRUE(imageLinearToSRGB(image, 1, 1));
+    for (size_t i = 0; i < image.getValueCount(); i += 4) {
+        EXPECT_EQ(image.pixels[i], srgbToLinear(decoded.pixels[i]));
+        EXPECT_NEAR(image.pixels[i + 1], decoded.pixels[i + 1], 1e-5f);
+    }
+    EXPECT_FALSE(imageLinearToSRGB(image, 2, 3));
+}
+
+// Copies of an ImageAsset share the encoded bytes, and moving a vector in does not copy it
+TEST(ImageTests, ImageAssetCopiesShareEncodedBytes)
+{
+    std::vector<uint8_t> bytes(1024, 7);
+    const uint8_t* original = bytes.data();
+    ImageAsset asset;
+    asset.image = std::move(bytes);
+    EXPECT_EQ(asset.image.data(), original);
+    EXPECT_EQ(asset.image.size(), 1024u);
+
+    ImageAsset copy = asset;
+    EXPECT_TRUE(copy.image.sharesWith(asset.image));
+    EXPECT_EQ(copy.image.data(), original);
+
+    const std::vector<uint8_t> other = { 1, 2, 3 };
+    copy.image = other;
+    EXPECT_FALSE(copy.image.sharesWith(asset.image));
+    EXPECT_EQ(std::vector<uint8_t>(copy.image.begin(), copy.image.end()), other);
+    EXPECT_EQ(asset.image[1023], 7);
+
+    ImageAsset empty;
+    EXPECT_TRUE(empty.image.empty());
+    EXPECT_EQ(empty.image.begin(), empty.image.end());
+}
+
+TEST(ImageTests, DeduplicateImagesMergesIdenticalBytes)
+{
+    std::vector<ImageAsset> images(5);
+    images[0].uri = "a.png";
+    images[0].image = ImageBuffer({ 1, 2, 3, 4 });
+    images[1].uri = "b.png";
+    images[1].image = ImageBuffer({ 1, 2, 3, 5 });
+    images[2].uri = "c.png";
+    images[2].image = ImageBuffer({ 1, 2, 3, 4 });
+    images[3].uri = "d.png"; // Not read, never merged
+    images[4].uri = "e.png";
+
+    const std::vector<int> remap = deduplicateImages(images);
+    EXPECT_EQ(remap, std::vector<int>({ 0, 1, 0, 2, 3 }));
+    ASSERT_EQ(images.size(), 4u);
+    EXPECT_EQ(images[0].uri, "a.png");
+    EXPECT_EQ(images[1].uri, "b.png");
+    EXPECT_EQ(images[2].uri, "d.png");
+    EXPECT_EQ(images[3].uri, "e.png");
+}
+
+TEST(ImageTests, ProxyImagesFitMaxTextureSize)
+{
+    // Odd dimensions, so the last column of blocks only covers one source column
+    Image image;
+    image.allocate(5, 4, 1);
+    for (int i = 0; i < 20; ++i)
+        image.pixels[i] = static_cast<float>(i % 5);
+    Image reduced;
+    ASSERT_TRUE(imageDownsample(image, 2, reduced));
+    ASSERT_EQ(reduced.width, 3);
+    ASSERT_EQ(reduced.height, 2);
+    EXPECT_FLOAT_EQ(reduced.pixels[0], 0.5f);
+    EXPECT_FLOAT_EQ(reduced.pixels[1], 2.5f);
+    EXPECT_FLOAT_EQ(reduced.pixels[2], 4.0f);
+
+    EXPECT_EQ(getProxyImageUri("textures/wood.png", 512), "textures/wood.proxy512.png");
+    std::string uri;
+    int maxSize = 0;
+    ASSERT_TRUE(parseProxyImageUri("textures/wood.proxy512.png", uri, maxSize));
+    EXPECT_EQ(uri, "textures/wood.png");
+    EXPECT_EQ(maxSize, 512);
+    EXPECT_FALSE(parseProxyImageUri("textures/wood.png", uri, maxSize));
+    EXPECT_FALSE(parseProxyImageUri("textures/wood.proxy.png", uri, maxSize));
+
+    Image large;
+    large.allocate(40, 24, 3);
+    std::vector<ImageAsset> images(2);
+    images[0].uri = "large.png";
+    images[0].format = ImageFormatPng;
+    ASSERT_TRUE(large.write(images[0]));
+    images[1].uri = "small.png";
+    images[1].format = ImageFormatPng;
+    ASSERT_TRUE(reduced.write(images[1]));
+    EXPECT_EQ(makeProxyImages(images, 16), 1u);
+    EXPECT_EQ(images[0].uri, "large.proxy16.png");
+    EXPECT_EQ(images[1].uri, "small.png");
+    int width = 0, height = 0, channels = 0;
+    ASSERT_TRUE(readImageInfo(images[0], width, height, channels));
+    EXPECT_EQ(width, 10);
+    EXPECT_EQ(height, 6);
+    EXPECT_EQ(channels, 3);
+}
+
+// Proxies of srgb colors are averaged in linear space, and proxies of normal maps are renormalized
+TEST(ImageTests, ProxyDownsampleModes)
+{
+    // A black and a white pixel, with half transparent alpha
+    Image color;
+    ASSERT_TRUE(color.allocate(2, 1, 4));
+    for (int c = 0; c < 3; ++c) {
+        color.pixels[c] = 0.0f;
+        color.pixels[4 + c] = 1.0f;
+    }
+    color.pixels[3] = 0.0f;
+    color.pixels[7] = 1.0f;
+    Image reduced;
+    ASSERT_TRUE(imageDownsample(color, 2, reduced, ImageDownsampleMode::Linear));
+    EXPECT_FLOAT_EQ(reduced.pixels[0], 0.5f);
+    ASSERT_TRUE(imageDownsample(color, 2, reduced, ImageDownsampleMode::Srgb));
+    for (int c = 0; c < 3; ++c) {
+        EXPECT_NEAR(reduced.pixels[c], linearToSRGB(0.5f), 1e-5f);
+    }
+    EXPECT_FLOAT_EQ(reduced.pixels[3], 0.5f);
+
+    // The normals (1, 0, 0) and (0, 1, 0), encoded as colors
+    Image normals;
+    ASSERT_TRUE(normals.allocate(1, 2, 3));
+    const float encoded[6] = { 1.0f, 0.5f, 0.5f, 0.5f, 1.0f, 0.5f };
+    std::copy(encoded, encoded + 6, normals.pixels.begin());
+    ASSERT_TRUE(imageDownsample(normals, 2, reduced, ImageDownsampleMode::Normal));
+    const float diagonal = 0.5f * std::sqrt(0.5f) + 0.5f;
+    EXPECT_NEAR(reduced.pixels[0], diagonal, 1e-6f);
+    EXPECT_NEAR(reduced.pixels[1], diagonal, 1e-6f);
+    EXPECT_NEAR(reduced.pixels[2], 0.5f, 1e-6f);
+
+    // The mode is recorded in the uri of the proxy, so that it can be generated again from it
+    EXPECT_EQ(getProxyImageUri("wood.png", 512, ImageDownsampleMode::Srgb), "wood.proxy512s.png");
+    EXPECT_EQ(getProxyImageUri("wood.png", 512, ImageDownsampleMode::Normal), "wood.proxy512n.png");
+    std::string uri;
+    int maxSize = 0;
+    ImageDownsampleMode mode = ImageDownsampleMode::Linear;
+    ASSERT_TRUE(parseProxyImageUri("wood.proxy512n.png", uri, maxSize, mode));
+    EXPECT_EQ(uri, "wood.png");
+    EXPECT_EQ(maxSize, 512);
+    EXPECT_EQ(mode, ImageDownsampleMode::Normal);
+    ASSERT_TRUE(parseProxyImageUri("wood.proxy512.png", uri, maxSize, mode));
+    EXPECT_EQ(mode, ImageDownsampleMode::Linear);
+    EXPECT_FALSE(parseProxyImageUri("wood.proxys.png", uri, maxSize, mode));
+    EXPECT_FALSE(parseProxyImageUri("wood.proxy512x.png", uri, maxSize, mode));
+}
+
+// The range of a large image is computed in parallel, but matches a serial loop of std::min and
+// std::max: a NaN value becomes the range of its channel, and the values after it replace it
+TEST(ImageTests, ComputeRangeMatchesSerialNaNHandling)
+{
+    // Large enough to be split in several ranges
+    Image image;
+    ASSERT_TRUE(image.allocate(512, 512, 2));
+    const size_t pixelCount = 512 * 512;
+    for (size_t i = 0; i < pixelCount; i++) {
+        image.pixels[2 * i] = i < pixelCount / 2 ? 0.0f : 5.0f;
+        image.pixels[2 * i + 1] = 1.0f;
+    }
+    image.pixels[2 * (pixelCount / 2 + 10)] = NAN;
+    image.pixels[2 * (pixelCount - 1)] = 3.0f;
+    image.pixels[2 * (pixelCount - 1) + 1] = NAN;
+
+    auto [minValues, maxValues] = image.computeRange();
+    // Only the values after the NaN count for the first channel
+    EXPECT_EQ(minValues[0], 3.0f);
+    EXPECT_EQ(maxValues[0], 5.0f);
+    // The last value of the second channel is NaN
+    EXPECT_TRUE(std::isnan(minValues[1]));
+    EXPECT_TRUE(std::isnan(maxValues[1]));
+    // Channels the image doesn't have keep their initial values
+    EXPECT_EQ(minValues[2], FLT_MAX);
+    EXPECT_EQ(maxValues[2], -FLT_MAX);
+}
+
+// A malformed integer argument is ignored, and the default is kept
+TEST(FileFormatUtilsTests, ArgReadIntKeepsDefaultOnInvalidValue)
+{
+    SdfFileFormat::FileFormatArguments args;
+    args["maxTextureSize"] = "512";
+    int value = 0;
+    EXPECT_TRUE(argReadInt(args, "maxTextureSize", value, "test"));
+    EXPECT_EQ(value, 512);
+
+    for (const char* invalid : { "", "large", "99999999999999999999" }) {
+        args["maxTextureSize"] = invalid;
+        value = 7;
+        EXPECT_FALSE(argReadInt(args, "maxTextureSize", value, "test")) << invalid;
+        EXPECT_EQ(value, 7) << invalid;
+    }
+}
+
 // A rejected allocate() must leave dimensions/pixels in a consistent empty state, so that
 // downstream calls which don't check the bool return (transformChannel/set) stay no-ops instead
 // of indexing into an empty buffer using stale, oversized dimensions.
@@ -1813,3 +2755,216 @@ TEST(ImageTests, RejectedAllocateStaysSafeForDownstreamOps)
     EXPECT_FALSE(dst.transformChannel(src, 0, 1.0f, 0.0f, 0));
     dst.set(1.0f, 1.0f, 1.0f, 1.0f); // must not crash despite the earlier oversized request
 }
+
+/// Asset cache tests //////////////////////////////////////////////////////////////////////////////
+
+static ImageAsset
+makeCachedImage(const std::string& uri)
+{
+    ImageAsset asset;
+    asset.name = uri;
+    asset.uri = uri;
+    asset.format = ImageFormatPng;
+    asset.image = { 1, 2, 3, 4 };
+    return asset;
+}
+
+// Reading one package must not block reading another. Package A only finishes reading once
+// package B has been read on another thread, which would time out with a cache-wide lock.
+TEST(AssetCacheTests, IndependentPackagesReadConcurrently)
+{
+    AssetCacheSingleton& cache = AssetCacheSingleton::getInstance();
+    const std::string pathA = "concurrentA.test";
+    const std::string pathB = "concurrentB.test";
+    cache.clearCache(pathA);
+    cache.clearCache(pathB);
+
+    std::promise<void> readB;
+    std::shared_future<void> readBDone = readB.get_future().share();
+
+    AssetMapConstPtr mapA;
+    std::thread threadA([&]() {
+        std::stringstream ss;
+        mapA = cache.acquireAssetMap(
+          pathA, "a.png", ss, [&](const std::string&, std::vector<ImageAsset>& images) {
+              EXPECT_EQ(readBDone.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+              images.push_back(makeCachedImage("a.png"));
+          });
+    });
+    std::stringstream ss;
+    AssetMapConstPtr mapB = cache.acquireAssetMap(
+      pathB, "b.png", ss, [&](const std::string&, std::vector<ImageAsset>& images) {
+          images.push_back(makeCachedImage("b.png"));
+          readB.set_value();
+      });
+    threadA.join();
+
+    ASSERT_TRUE(mapA);
+    ASSERT_TRUE(mapB);
+    EXPECT_EQ(mapA->assets.count("a.png"), 1u);
+    EXPECT_EQ(mapB->assets.count("b.png"), 1u);
+    cache.clearCache(pathA);
+    cache.clearCache(pathB);
+}
+
+// Concurrent requests for the same package read it once and share the resulting asset map.
+TEST(AssetCacheTests, SamePackageReadOnce)
+{
+    AssetCacheSingleton& cache = AssetCacheSingleton::getInstance();
+    const std::string path = "readOnce.test";
+    cache.clearCache(path);
+
+    std::atomic<int> readCount{ 0 };
+    std::vector<AssetMapConstPtr> maps(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < maps.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            std::stringstream ss;
+            maps[i] = cache.acquireAssetMap(
+              path, "image.png", ss, [&](const std::string&, std::vector<ImageAsset>& images) {
+                  readCount++;
+                  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                  images.push_back(makeCachedImage("image.png"));
+              });
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(readCount.load(), 1);
+    for (const AssetMapConstPtr& map : maps) {
+        ASSERT_TRUE(map);
+        EXPECT_EQ(map, maps[0]);
+        EXPECT_EQ(map->assets.count("image.png"), 1u);
+    }
+    cache.clearCache(path);
+}
+
+// With a byte budget, populating a package evicts the least recently opened packages first.
+TEST(AssetCacheTests, EvictsLeastRecentlyOpenedPackageOverBudget)
+{
+    AssetCacheSingleton& cache = AssetCacheSingleton::getInstance();
+    const std::string pathA = "budgetA.test";
+    const std::string pathB = "budgetB.test";
+    const std::string pathC = "budgetC.test";
+    for (const std::string& path : { pathA, pathB, pathC }) {
+        cache.clearCache(path);
+    }
+    // Each cached image is 4 bytes, so only two packages fit
+    cache.setMaxByteSize(cache.getCacheByteSize() + 10);
+
+    int readCount = 0;
+    auto readCache = [&](const std::string&, std::vector<ImageAsset>& images) {
+        readCount++;
+        images.push_back(makeCachedImage("image.png"));
+    };
+    auto populate = [&](const std::string& path) {
+        std::vector<ImageAsset> images = { makeCachedImage("image.png") };
+        cache.populateCache(path, std::move(images));
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    };
+
+    populate(pathA);
+    populate(pathB);
+    std::stringstream ss;
+    ASSERT_TRUE(cache.acquireAssetMap(pathA, "image.png", ss, readCache)); // A is now the MRU
+    EXPECT_EQ(readCount, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    populate(pathC);
+
+    // B was evicted and has to be read again, A and C are still cached
+    ASSERT_TRUE(cache.acquireAssetMap(pathA, "image.png", ss, readCache));
+    ASSERT_TRUE(cache.acquireAssetMap(pathC, "image.png", ss, readCache));
+    EXPECT_EQ(readCount, 0);
+    ASSERT_TRUE(cache.acquireAssetMap(pathB, "image.png", ss, readCache));
+    EXPECT_EQ(readCount, 1);
+
+    cache.setMaxByteSize(0);
+    for (const std::string& path : { pathA, pathB, pathC }) {
+        cache.clearCache(path);
+    }
+}
+
+// Resolver that counts how many times a package is read
+class CountingResolver : public Resolver
+{
+public:
+    CountingResolver()
+      : Resolver("CountingResolver")
+    {}
+
+    int readCount = 0;
+
+protected:
+    void readCache(const std::string&, std::vector<ImageAsset>& images) override
+    {
+        readCount++;
+        images.push_back(makeCachedImage("image.png"));
+    }
+};
+
+// Resolver of a package that only holds a full resolution image, like a package read again after
+// its proxies were evicted
+class OriginalImageResolver : public Resolver
+{
+public:
+    OriginalImageResolver()
+      : Resolver("OriginalImageResolver")
+    {}
+
+protected:
+    void readCache(const std::string&, std::vector<ImageAsset>& images) override
+    {
+        Image large;
+        large.allocate(40, 24, 3);
+        ImageAsset asset;
+        asset.uri = "large.png";
+        asset.format = ImageFormatPng;
+        large.write(asset);
+        images.push_back(std::move(asset));
+    }
+};
+
+// A proxy generated again from its original replaces it in the cache
+TEST(AssetCacheTests, RegeneratedProxyReplacesOriginal)
+{
+    const std::string path = "proxy.test";
+    AssetCacheSingleton& cache = AssetCacheSingleton::getInstance();
+    cache.clearCache(path);
+    OriginalImageResolver resolver;
+    EXPECT_TRUE(resolver.OpenAsset(path, "large.proxy16s.png"));
+
+    std::stringstream ss;
+    AssetMapConstPtr assetMap = cache.acquireAssetMap(
+      path, "large.proxy16s.png", ss, [](const std::string&, std::vector<ImageAsset>&) {
+          ADD_FAILURE() << "The package should still be cached";
+      });
+    ASSERT_TRUE(assetMap);
+    EXPECT_EQ(assetMap->assets.count("large.proxy16s.png"), 1u);
+    EXPECT_EQ(assetMap->assets.count("large.png"), 0u);
+    cache.clearCache(path);
+}
+
+// Within a cache scope, opened packages are pinned and served without consulting the shared cache.
+TEST(AssetCacheTests, CacheScopePinsOpenedPackages)
+{
+    const std::string path = "scoped.test";
+    AssetCacheSingleton::getInstance().clearCache(path);
+    CountingResolver resolver;
+
+    VtValue scopeData;
+    resolver.BeginCacheScope(&scopeData);
+    EXPECT_TRUE(resolver.OpenAsset(path, "image.png"));
+    Resolver::clearCache(path);
+    EXPECT_TRUE(resolver.OpenAsset(path, "image.png"));
+    EXPECT_FALSE(resolver.OpenAsset(path, "missing.png"));
+    EXPECT_EQ(resolver.readCount, 1);
+    resolver.EndCacheScope(&scopeData);
+
+    // Outside of the scope the cleared package has to be read again
+    Resolver::clearCache(path);
+    EXPECT_TRUE(resolver.OpenAsset(path, "image.png"));
+    EXPECT_EQ(resolver.readCount, 2);
+    Resolver::clearCache(path);
+}